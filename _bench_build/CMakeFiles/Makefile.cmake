@@ -0,0 +1,175 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/src/cmake/macros/GENBENCH_Frontend.cmake"
+  "/root/repo/src/cmake/macros/SPOIL_Frontend.cmake"
+  "/root/repo/src/cmake/macros/X11_Frontend.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFontconfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFreetype.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindX11.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/OurCoreLib.dir/DependInfo.cmake"
+  "CMakeFiles/OurExecutable.dir/DependInfo.cmake"
+  "CMakeFiles/alltests.dir/DependInfo.cmake"
+  "CMakeFiles/allunittests.dir/DependInfo.cmake"
+  "CMakeFiles/OurUnitTestLib.dir/DependInfo.cmake"
+  "CMakeFiles/unittest1.dir/DependInfo.cmake"
+  "CMakeFiles/unittest2.dir/DependInfo.cmake"
+  "CMakeFiles/unittest3.dir/DependInfo.cmake"
+  "CMakeFiles/unittest4.dir/DependInfo.cmake"
+  "CMakeFiles/unittest5.dir/DependInfo.cmake"
+  "CMakeFiles/unittest6.dir/DependInfo.cmake"
+  "CMakeFiles/unittest7.dir/DependInfo.cmake"
+  "CMakeFiles/unittest8.dir/DependInfo.cmake"
+  "CMakeFiles/unittest9.dir/DependInfo.cmake"
+  "CMakeFiles/unittest10.dir/DependInfo.cmake"
+  "CMakeFiles/unittest11.dir/DependInfo.cmake"
+  "CMakeFiles/unittest12.dir/DependInfo.cmake"
+  "CMakeFiles/unittest13.dir/DependInfo.cmake"
+  "CMakeFiles/unittest14.dir/DependInfo.cmake"
+  "CMakeFiles/unittest15.dir/DependInfo.cmake"
+  "CMakeFiles/unittest16.dir/DependInfo.cmake"
+  "CMakeFiles/unittest17.dir/DependInfo.cmake"
+  "CMakeFiles/unittest18.dir/DependInfo.cmake"
+  "CMakeFiles/unittest19.dir/DependInfo.cmake"
+  "CMakeFiles/unittest20.dir/DependInfo.cmake"
+  "CMakeFiles/unittest21.dir/DependInfo.cmake"
+  "CMakeFiles/unittest22.dir/DependInfo.cmake"
+  "CMakeFiles/unittest23.dir/DependInfo.cmake"
+  "CMakeFiles/unittest24.dir/DependInfo.cmake"
+  "CMakeFiles/unittest25.dir/DependInfo.cmake"
+  "CMakeFiles/unittest26.dir/DependInfo.cmake"
+  "CMakeFiles/unittest27.dir/DependInfo.cmake"
+  "CMakeFiles/unittest28.dir/DependInfo.cmake"
+  "CMakeFiles/unittest29.dir/DependInfo.cmake"
+  "CMakeFiles/unittest30.dir/DependInfo.cmake"
+  "CMakeFiles/unittest31.dir/DependInfo.cmake"
+  "CMakeFiles/unittest32.dir/DependInfo.cmake"
+  "CMakeFiles/unittest33.dir/DependInfo.cmake"
+  "CMakeFiles/unittest34.dir/DependInfo.cmake"
+  "CMakeFiles/unittest35.dir/DependInfo.cmake"
+  "CMakeFiles/unittest36.dir/DependInfo.cmake"
+  "CMakeFiles/unittest37.dir/DependInfo.cmake"
+  "CMakeFiles/unittest38.dir/DependInfo.cmake"
+  "CMakeFiles/unittest39.dir/DependInfo.cmake"
+  "CMakeFiles/unittest40.dir/DependInfo.cmake"
+  "CMakeFiles/unittest41.dir/DependInfo.cmake"
+  "CMakeFiles/unittest42.dir/DependInfo.cmake"
+  "CMakeFiles/unittest43.dir/DependInfo.cmake"
+  "CMakeFiles/unittest44.dir/DependInfo.cmake"
+  "CMakeFiles/unittest45.dir/DependInfo.cmake"
+  "CMakeFiles/unittest46.dir/DependInfo.cmake"
+  "CMakeFiles/unittest47.dir/DependInfo.cmake"
+  "CMakeFiles/unittest48.dir/DependInfo.cmake"
+  "CMakeFiles/unittest49.dir/DependInfo.cmake"
+  "CMakeFiles/unittest50.dir/DependInfo.cmake"
+  "CMakeFiles/unittest51.dir/DependInfo.cmake"
+  "CMakeFiles/unittest52.dir/DependInfo.cmake"
+  "CMakeFiles/unittest53.dir/DependInfo.cmake"
+  "CMakeFiles/unittest54.dir/DependInfo.cmake"
+  )
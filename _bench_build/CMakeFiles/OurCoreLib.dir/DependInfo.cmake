@@ -0,0 +1,178 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/buildid.c" "CMakeFiles/OurCoreLib.dir/src/buildid.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/buildid.c.o.d"
+  "/root/repo/src/c_marksman.c" "CMakeFiles/OurCoreLib.dir/src/c_marksman.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/c_marksman.c.o.d"
+  "/root/repo/src/c_soldier.c" "CMakeFiles/OurCoreLib.dir/src/c_soldier.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/c_soldier.c.o.d"
+  "/root/repo/src/c_tourist.c" "CMakeFiles/OurCoreLib.dir/src/c_tourist.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/c_tourist.c.o.d"
+  "/root/repo/src/cave-map.c" "CMakeFiles/OurCoreLib.dir/src/cave-map.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/cave-map.c.o.d"
+  "/root/repo/src/cave-square.c" "CMakeFiles/OurCoreLib.dir/src/cave-square.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/cave-square.c.o.d"
+  "/root/repo/src/cave-view.c" "CMakeFiles/OurCoreLib.dir/src/cave-view.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/cave-view.c.o.d"
+  "/root/repo/src/cave.c" "CMakeFiles/OurCoreLib.dir/src/cave.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/cave.c.o.d"
+  "/root/repo/src/cmd-cave.c" "CMakeFiles/OurCoreLib.dir/src/cmd-cave.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/cmd-cave.c.o.d"
+  "/root/repo/src/cmd-core.c" "CMakeFiles/OurCoreLib.dir/src/cmd-core.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/cmd-core.c.o.d"
+  "/root/repo/src/cmd-misc.c" "CMakeFiles/OurCoreLib.dir/src/cmd-misc.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/cmd-misc.c.o.d"
+  "/root/repo/src/cmd-obj.c" "CMakeFiles/OurCoreLib.dir/src/cmd-obj.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/cmd-obj.c.o.d"
+  "/root/repo/src/cmd-pickup.c" "CMakeFiles/OurCoreLib.dir/src/cmd-pickup.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/cmd-pickup.c.o.d"
+  "/root/repo/src/cmd-spoil.c" "CMakeFiles/OurCoreLib.dir/src/cmd-spoil.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/cmd-spoil.c.o.d"
+  "/root/repo/src/cmd-wizard.c" "CMakeFiles/OurCoreLib.dir/src/cmd-wizard.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/cmd-wizard.c.o.d"
+  "/root/repo/src/datafile.c" "CMakeFiles/OurCoreLib.dir/src/datafile.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/datafile.c.o.d"
+  "/root/repo/src/debug.c" "CMakeFiles/OurCoreLib.dir/src/debug.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/debug.c.o.d"
+  "/root/repo/src/effect-handler-attack.c" "CMakeFiles/OurCoreLib.dir/src/effect-handler-attack.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/effect-handler-attack.c.o.d"
+  "/root/repo/src/effect-handler-general.c" "CMakeFiles/OurCoreLib.dir/src/effect-handler-general.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/effect-handler-general.c.o.d"
+  "/root/repo/src/effects-info.c" "CMakeFiles/OurCoreLib.dir/src/effects-info.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/effects-info.c.o.d"
+  "/root/repo/src/effects.c" "CMakeFiles/OurCoreLib.dir/src/effects.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/effects.c.o.d"
+  "/root/repo/src/game-event.c" "CMakeFiles/OurCoreLib.dir/src/game-event.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/game-event.c.o.d"
+  "/root/repo/src/game-input.c" "CMakeFiles/OurCoreLib.dir/src/game-input.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/game-input.c.o.d"
+  "/root/repo/src/game-world.c" "CMakeFiles/OurCoreLib.dir/src/game-world.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/game-world.c.o.d"
+  "/root/repo/src/gen-cave.c" "CMakeFiles/OurCoreLib.dir/src/gen-cave.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/gen-cave.c.o.d"
+  "/root/repo/src/gen-chunk.c" "CMakeFiles/OurCoreLib.dir/src/gen-chunk.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/gen-chunk.c.o.d"
+  "/root/repo/src/gen-monster.c" "CMakeFiles/OurCoreLib.dir/src/gen-monster.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/gen-monster.c.o.d"
+  "/root/repo/src/gen-room.c" "CMakeFiles/OurCoreLib.dir/src/gen-room.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/gen-room.c.o.d"
+  "/root/repo/src/gen-util.c" "CMakeFiles/OurCoreLib.dir/src/gen-util.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/gen-util.c.o.d"
+  "/root/repo/src/generate.c" "CMakeFiles/OurCoreLib.dir/src/generate.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/generate.c.o.d"
+  "/root/repo/src/grafmode.c" "CMakeFiles/OurCoreLib.dir/src/grafmode.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/grafmode.c.o.d"
+  "/root/repo/src/guid.c" "CMakeFiles/OurCoreLib.dir/src/guid.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/guid.c.o.d"
+  "/root/repo/src/init.c" "CMakeFiles/OurCoreLib.dir/src/init.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/init.c.o.d"
+  "/root/repo/src/load.c" "CMakeFiles/OurCoreLib.dir/src/load.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/load.c.o.d"
+  "/root/repo/src/message.c" "CMakeFiles/OurCoreLib.dir/src/message.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/message.c.o.d"
+  "/root/repo/src/mon-attack.c" "CMakeFiles/OurCoreLib.dir/src/mon-attack.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-attack.c.o.d"
+  "/root/repo/src/mon-blows.c" "CMakeFiles/OurCoreLib.dir/src/mon-blows.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-blows.c.o.d"
+  "/root/repo/src/mon-desc.c" "CMakeFiles/OurCoreLib.dir/src/mon-desc.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-desc.c.o.d"
+  "/root/repo/src/mon-group.c" "CMakeFiles/OurCoreLib.dir/src/mon-group.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-group.c.o.d"
+  "/root/repo/src/mon-init.c" "CMakeFiles/OurCoreLib.dir/src/mon-init.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-init.c.o.d"
+  "/root/repo/src/mon-list.c" "CMakeFiles/OurCoreLib.dir/src/mon-list.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-list.c.o.d"
+  "/root/repo/src/mon-lore.c" "CMakeFiles/OurCoreLib.dir/src/mon-lore.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-lore.c.o.d"
+  "/root/repo/src/mon-make.c" "CMakeFiles/OurCoreLib.dir/src/mon-make.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-make.c.o.d"
+  "/root/repo/src/mon-move.c" "CMakeFiles/OurCoreLib.dir/src/mon-move.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-move.c.o.d"
+  "/root/repo/src/mon-msg.c" "CMakeFiles/OurCoreLib.dir/src/mon-msg.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-msg.c.o.d"
+  "/root/repo/src/mon-mutant.c" "CMakeFiles/OurCoreLib.dir/src/mon-mutant.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-mutant.c.o.d"
+  "/root/repo/src/mon-pet.c" "CMakeFiles/OurCoreLib.dir/src/mon-pet.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-pet.c.o.d"
+  "/root/repo/src/mon-predicate.c" "CMakeFiles/OurCoreLib.dir/src/mon-predicate.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-predicate.c.o.d"
+  "/root/repo/src/mon-spell.c" "CMakeFiles/OurCoreLib.dir/src/mon-spell.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-spell.c.o.d"
+  "/root/repo/src/mon-summon.c" "CMakeFiles/OurCoreLib.dir/src/mon-summon.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-summon.c.o.d"
+  "/root/repo/src/mon-timed.c" "CMakeFiles/OurCoreLib.dir/src/mon-timed.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-timed.c.o.d"
+  "/root/repo/src/mon-util.c" "CMakeFiles/OurCoreLib.dir/src/mon-util.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/mon-util.c.o.d"
+  "/root/repo/src/obj-chest.c" "CMakeFiles/OurCoreLib.dir/src/obj-chest.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-chest.c.o.d"
+  "/root/repo/src/obj-desc.c" "CMakeFiles/OurCoreLib.dir/src/obj-desc.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-desc.c.o.d"
+  "/root/repo/src/obj-fault.c" "CMakeFiles/OurCoreLib.dir/src/obj-fault.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-fault.c.o.d"
+  "/root/repo/src/obj-gear.c" "CMakeFiles/OurCoreLib.dir/src/obj-gear.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-gear.c.o.d"
+  "/root/repo/src/obj-ignore.c" "CMakeFiles/OurCoreLib.dir/src/obj-ignore.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-ignore.c.o.d"
+  "/root/repo/src/obj-info.c" "CMakeFiles/OurCoreLib.dir/src/obj-info.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-info.c.o.d"
+  "/root/repo/src/obj-init.c" "CMakeFiles/OurCoreLib.dir/src/obj-init.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-init.c.o.d"
+  "/root/repo/src/obj-knowledge.c" "CMakeFiles/OurCoreLib.dir/src/obj-knowledge.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-knowledge.c.o.d"
+  "/root/repo/src/obj-list.c" "CMakeFiles/OurCoreLib.dir/src/obj-list.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-list.c.o.d"
+  "/root/repo/src/obj-make.c" "CMakeFiles/OurCoreLib.dir/src/obj-make.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-make.c.o.d"
+  "/root/repo/src/obj-pile.c" "CMakeFiles/OurCoreLib.dir/src/obj-pile.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-pile.c.o.d"
+  "/root/repo/src/obj-power.c" "CMakeFiles/OurCoreLib.dir/src/obj-power.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-power.c.o.d"
+  "/root/repo/src/obj-properties.c" "CMakeFiles/OurCoreLib.dir/src/obj-properties.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-properties.c.o.d"
+  "/root/repo/src/obj-randart.c" "CMakeFiles/OurCoreLib.dir/src/obj-randart.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-randart.c.o.d"
+  "/root/repo/src/obj-slays.c" "CMakeFiles/OurCoreLib.dir/src/obj-slays.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-slays.c.o.d"
+  "/root/repo/src/obj-tval.c" "CMakeFiles/OurCoreLib.dir/src/obj-tval.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-tval.c.o.d"
+  "/root/repo/src/obj-util.c" "CMakeFiles/OurCoreLib.dir/src/obj-util.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/obj-util.c.o.d"
+  "/root/repo/src/option.c" "CMakeFiles/OurCoreLib.dir/src/option.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/option.c.o.d"
+  "/root/repo/src/parser.c" "CMakeFiles/OurCoreLib.dir/src/parser.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/parser.c.o.d"
+  "/root/repo/src/player-ability.c" "CMakeFiles/OurCoreLib.dir/src/player-ability.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-ability.c.o.d"
+  "/root/repo/src/player-attack.c" "CMakeFiles/OurCoreLib.dir/src/player-attack.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-attack.c.o.d"
+  "/root/repo/src/player-birth.c" "CMakeFiles/OurCoreLib.dir/src/player-birth.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-birth.c.o.d"
+  "/root/repo/src/player-calcs.c" "CMakeFiles/OurCoreLib.dir/src/player-calcs.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-calcs.c.o.d"
+  "/root/repo/src/player-class.c" "CMakeFiles/OurCoreLib.dir/src/player-class.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-class.c.o.d"
+  "/root/repo/src/player-history.c" "CMakeFiles/OurCoreLib.dir/src/player-history.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-history.c.o.d"
+  "/root/repo/src/player-path.c" "CMakeFiles/OurCoreLib.dir/src/player-path.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-path.c.o.d"
+  "/root/repo/src/player-properties.c" "CMakeFiles/OurCoreLib.dir/src/player-properties.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-properties.c.o.d"
+  "/root/repo/src/player-quest.c" "CMakeFiles/OurCoreLib.dir/src/player-quest.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-quest.c.o.d"
+  "/root/repo/src/player-race.c" "CMakeFiles/OurCoreLib.dir/src/player-race.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-race.c.o.d"
+  "/root/repo/src/player-spell.c" "CMakeFiles/OurCoreLib.dir/src/player-spell.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-spell.c.o.d"
+  "/root/repo/src/player-timed.c" "CMakeFiles/OurCoreLib.dir/src/player-timed.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-timed.c.o.d"
+  "/root/repo/src/player-util.c" "CMakeFiles/OurCoreLib.dir/src/player-util.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player-util.c.o.d"
+  "/root/repo/src/player.c" "CMakeFiles/OurCoreLib.dir/src/player.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/player.c.o.d"
+  "/root/repo/src/project-feat.c" "CMakeFiles/OurCoreLib.dir/src/project-feat.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/project-feat.c.o.d"
+  "/root/repo/src/project-mon.c" "CMakeFiles/OurCoreLib.dir/src/project-mon.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/project-mon.c.o.d"
+  "/root/repo/src/project-obj.c" "CMakeFiles/OurCoreLib.dir/src/project-obj.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/project-obj.c.o.d"
+  "/root/repo/src/project-player.c" "CMakeFiles/OurCoreLib.dir/src/project-player.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/project-player.c.o.d"
+  "/root/repo/src/project.c" "CMakeFiles/OurCoreLib.dir/src/project.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/project.c.o.d"
+  "/root/repo/src/r_android.c" "CMakeFiles/OurCoreLib.dir/src/r_android.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/r_android.c.o.d"
+  "/root/repo/src/r_cyborg.c" "CMakeFiles/OurCoreLib.dir/src/r_cyborg.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/r_cyborg.c.o.d"
+  "/root/repo/src/r_mutant.c" "CMakeFiles/OurCoreLib.dir/src/r_mutant.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/r_mutant.c.o.d"
+  "/root/repo/src/r_super.c" "CMakeFiles/OurCoreLib.dir/src/r_super.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/r_super.c.o.d"
+  "/root/repo/src/r_timelord.c" "CMakeFiles/OurCoreLib.dir/src/r_timelord.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/r_timelord.c.o.d"
+  "/root/repo/src/randname.c" "CMakeFiles/OurCoreLib.dir/src/randname.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/randname.c.o.d"
+  "/root/repo/src/save-charoutput.c" "CMakeFiles/OurCoreLib.dir/src/save-charoutput.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/save-charoutput.c.o.d"
+  "/root/repo/src/save.c" "CMakeFiles/OurCoreLib.dir/src/save.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/save.c.o.d"
+  "/root/repo/src/savefile.c" "CMakeFiles/OurCoreLib.dir/src/savefile.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/savefile.c.o.d"
+  "/root/repo/src/score.c" "CMakeFiles/OurCoreLib.dir/src/score.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/score.c.o.d"
+  "/root/repo/src/sound-core.c" "CMakeFiles/OurCoreLib.dir/src/sound-core.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/sound-core.c.o.d"
+  "/root/repo/src/source.c" "CMakeFiles/OurCoreLib.dir/src/source.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/source.c.o.d"
+  "/root/repo/src/store.c" "CMakeFiles/OurCoreLib.dir/src/store.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/store.c.o.d"
+  "/root/repo/src/target.c" "CMakeFiles/OurCoreLib.dir/src/target.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/target.c.o.d"
+  "/root/repo/src/trap.c" "CMakeFiles/OurCoreLib.dir/src/trap.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/trap.c.o.d"
+  "/root/repo/src/ui-birth.c" "CMakeFiles/OurCoreLib.dir/src/ui-birth.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-birth.c.o.d"
+  "/root/repo/src/ui-command.c" "CMakeFiles/OurCoreLib.dir/src/ui-command.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-command.c.o.d"
+  "/root/repo/src/ui-context.c" "CMakeFiles/OurCoreLib.dir/src/ui-context.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-context.c.o.d"
+  "/root/repo/src/ui-death.c" "CMakeFiles/OurCoreLib.dir/src/ui-death.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-death.c.o.d"
+  "/root/repo/src/ui-display.c" "CMakeFiles/OurCoreLib.dir/src/ui-display.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-display.c.o.d"
+  "/root/repo/src/ui-effect.c" "CMakeFiles/OurCoreLib.dir/src/ui-effect.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-effect.c.o.d"
+  "/root/repo/src/ui-entry-combiner.c" "CMakeFiles/OurCoreLib.dir/src/ui-entry-combiner.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-entry-combiner.c.o.d"
+  "/root/repo/src/ui-entry-renderers.c" "CMakeFiles/OurCoreLib.dir/src/ui-entry-renderers.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-entry-renderers.c.o.d"
+  "/root/repo/src/ui-entry.c" "CMakeFiles/OurCoreLib.dir/src/ui-entry.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-entry.c.o.d"
+  "/root/repo/src/ui-equip-cmp.c" "CMakeFiles/OurCoreLib.dir/src/ui-equip-cmp.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-equip-cmp.c.o.d"
+  "/root/repo/src/ui-event.c" "CMakeFiles/OurCoreLib.dir/src/ui-event.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-event.c.o.d"
+  "/root/repo/src/ui-fault.c" "CMakeFiles/OurCoreLib.dir/src/ui-fault.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-fault.c.o.d"
+  "/root/repo/src/ui-game.c" "CMakeFiles/OurCoreLib.dir/src/ui-game.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-game.c.o.d"
+  "/root/repo/src/ui-help.c" "CMakeFiles/OurCoreLib.dir/src/ui-help.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-help.c.o.d"
+  "/root/repo/src/ui-history.c" "CMakeFiles/OurCoreLib.dir/src/ui-history.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-history.c.o.d"
+  "/root/repo/src/ui-init.c" "CMakeFiles/OurCoreLib.dir/src/ui-init.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-init.c.o.d"
+  "/root/repo/src/ui-input.c" "CMakeFiles/OurCoreLib.dir/src/ui-input.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-input.c.o.d"
+  "/root/repo/src/ui-keymap.c" "CMakeFiles/OurCoreLib.dir/src/ui-keymap.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-keymap.c.o.d"
+  "/root/repo/src/ui-knowledge.c" "CMakeFiles/OurCoreLib.dir/src/ui-knowledge.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-knowledge.c.o.d"
+  "/root/repo/src/ui-map.c" "CMakeFiles/OurCoreLib.dir/src/ui-map.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-map.c.o.d"
+  "/root/repo/src/ui-menu.c" "CMakeFiles/OurCoreLib.dir/src/ui-menu.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-menu.c.o.d"
+  "/root/repo/src/ui-mon-list.c" "CMakeFiles/OurCoreLib.dir/src/ui-mon-list.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-mon-list.c.o.d"
+  "/root/repo/src/ui-mon-lore.c" "CMakeFiles/OurCoreLib.dir/src/ui-mon-lore.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-mon-lore.c.o.d"
+  "/root/repo/src/ui-obj-list.c" "CMakeFiles/OurCoreLib.dir/src/ui-obj-list.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-obj-list.c.o.d"
+  "/root/repo/src/ui-object.c" "CMakeFiles/OurCoreLib.dir/src/ui-object.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-object.c.o.d"
+  "/root/repo/src/ui-options.c" "CMakeFiles/OurCoreLib.dir/src/ui-options.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-options.c.o.d"
+  "/root/repo/src/ui-output.c" "CMakeFiles/OurCoreLib.dir/src/ui-output.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-output.c.o.d"
+  "/root/repo/src/ui-player.c" "CMakeFiles/OurCoreLib.dir/src/ui-player.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-player.c.o.d"
+  "/root/repo/src/ui-prefs.c" "CMakeFiles/OurCoreLib.dir/src/ui-prefs.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-prefs.c.o.d"
+  "/root/repo/src/ui-score.c" "CMakeFiles/OurCoreLib.dir/src/ui-score.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-score.c.o.d"
+  "/root/repo/src/ui-signals.c" "CMakeFiles/OurCoreLib.dir/src/ui-signals.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-signals.c.o.d"
+  "/root/repo/src/ui-spell.c" "CMakeFiles/OurCoreLib.dir/src/ui-spell.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-spell.c.o.d"
+  "/root/repo/src/ui-store.c" "CMakeFiles/OurCoreLib.dir/src/ui-store.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-store.c.o.d"
+  "/root/repo/src/ui-target.c" "CMakeFiles/OurCoreLib.dir/src/ui-target.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-target.c.o.d"
+  "/root/repo/src/ui-term.c" "CMakeFiles/OurCoreLib.dir/src/ui-term.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-term.c.o.d"
+  "/root/repo/src/ui-visuals.c" "CMakeFiles/OurCoreLib.dir/src/ui-visuals.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-visuals.c.o.d"
+  "/root/repo/src/ui-wizard.c" "CMakeFiles/OurCoreLib.dir/src/ui-wizard.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/ui-wizard.c.o.d"
+  "/root/repo/src/wiz-debug.c" "CMakeFiles/OurCoreLib.dir/src/wiz-debug.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/wiz-debug.c.o.d"
+  "/root/repo/src/wiz-spoil.c" "CMakeFiles/OurCoreLib.dir/src/wiz-spoil.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/wiz-spoil.c.o.d"
+  "/root/repo/src/wiz-stats.c" "CMakeFiles/OurCoreLib.dir/src/wiz-stats.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/wiz-stats.c.o.d"
+  "/root/repo/src/world.c" "CMakeFiles/OurCoreLib.dir/src/world.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/world.c.o.d"
+  "/root/repo/src/z-bitflag.c" "CMakeFiles/OurCoreLib.dir/src/z-bitflag.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-bitflag.c.o.d"
+  "/root/repo/src/z-color.c" "CMakeFiles/OurCoreLib.dir/src/z-color.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-color.c.o.d"
+  "/root/repo/src/z-dice.c" "CMakeFiles/OurCoreLib.dir/src/z-dice.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-dice.c.o.d"
+  "/root/repo/src/z-expression.c" "CMakeFiles/OurCoreLib.dir/src/z-expression.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-expression.c.o.d"
+  "/root/repo/src/z-file.c" "CMakeFiles/OurCoreLib.dir/src/z-file.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-file.c.o.d"
+  "/root/repo/src/z-form.c" "CMakeFiles/OurCoreLib.dir/src/z-form.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-form.c.o.d"
+  "/root/repo/src/z-quark.c" "CMakeFiles/OurCoreLib.dir/src/z-quark.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-quark.c.o.d"
+  "/root/repo/src/z-queue.c" "CMakeFiles/OurCoreLib.dir/src/z-queue.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-queue.c.o.d"
+  "/root/repo/src/z-rand.c" "CMakeFiles/OurCoreLib.dir/src/z-rand.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-rand.c.o.d"
+  "/root/repo/src/z-set.c" "CMakeFiles/OurCoreLib.dir/src/z-set.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-set.c.o.d"
+  "/root/repo/src/z-textblock.c" "CMakeFiles/OurCoreLib.dir/src/z-textblock.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-textblock.c.o.d"
+  "/root/repo/src/z-type.c" "CMakeFiles/OurCoreLib.dir/src/z-type.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-type.c.o.d"
+  "/root/repo/src/z-util.c" "CMakeFiles/OurCoreLib.dir/src/z-util.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-util.c.o.d"
+  "/root/repo/src/z-virt.c" "CMakeFiles/OurCoreLib.dir/src/z-virt.c.o" "gcc" "CMakeFiles/OurCoreLib.dir/src/z-virt.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,327 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OurCoreLib.dir/src/buildid.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/buildid.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/c_marksman.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/c_marksman.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/c_soldier.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/c_soldier.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/c_tourist.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/c_tourist.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/cave-map.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/cave-map.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/cave-square.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/cave-square.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/cave-view.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/cave-view.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/cave.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/cave.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-cave.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-cave.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-core.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-core.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-misc.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-misc.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-obj.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-obj.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-pickup.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-pickup.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-spoil.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-spoil.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-wizard.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/cmd-wizard.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/datafile.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/datafile.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/debug.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/debug.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/effect-handler-attack.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/effect-handler-attack.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/effect-handler-general.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/effect-handler-general.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/effects-info.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/effects-info.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/effects.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/effects.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/game-event.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/game-event.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/game-input.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/game-input.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/game-world.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/game-world.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/gen-cave.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/gen-cave.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/gen-chunk.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/gen-chunk.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/gen-monster.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/gen-monster.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/gen-room.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/gen-room.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/gen-util.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/gen-util.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/generate.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/generate.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/grafmode.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/grafmode.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/guid.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/guid.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/init.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/init.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/load.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/load.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/message.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/message.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-attack.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-attack.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-blows.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-blows.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-desc.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-desc.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-group.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-group.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-init.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-init.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-list.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-list.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-lore.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-lore.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-make.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-make.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-move.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-move.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-msg.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-msg.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-mutant.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-mutant.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-pet.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-pet.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-predicate.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-predicate.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-spell.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-spell.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-summon.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-summon.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-timed.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-timed.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/mon-util.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/mon-util.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-chest.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-chest.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-desc.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-desc.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-fault.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-fault.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-gear.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-gear.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-ignore.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-ignore.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-info.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-info.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-init.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-init.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-knowledge.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-knowledge.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-list.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-list.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-make.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-make.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-pile.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-pile.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-power.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-power.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-properties.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-properties.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-randart.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-randart.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-slays.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-slays.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-tval.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-tval.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/obj-util.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/obj-util.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/option.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/option.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/parser.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/parser.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-ability.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-ability.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-attack.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-attack.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-birth.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-birth.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-calcs.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-calcs.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-class.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-class.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-history.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-history.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-path.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-path.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-properties.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-properties.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-quest.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-quest.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-race.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-race.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-spell.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-spell.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-timed.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-timed.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player-util.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player-util.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/player.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/player.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/project-feat.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/project-feat.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/project-mon.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/project-mon.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/project-obj.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/project-obj.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/project-player.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/project-player.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/project.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/project.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/r_android.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/r_android.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/r_cyborg.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/r_cyborg.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/r_mutant.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/r_mutant.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/r_super.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/r_super.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/r_timelord.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/r_timelord.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/randname.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/randname.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/save-charoutput.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/save-charoutput.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/save.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/save.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/savefile.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/savefile.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/score.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/score.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/sound-core.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/sound-core.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/source.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/source.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/store.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/store.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/target.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/target.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/trap.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/trap.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-birth.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-birth.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-command.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-command.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-context.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-context.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-death.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-death.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-display.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-display.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-effect.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-effect.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-entry-combiner.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-entry-combiner.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-entry-renderers.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-entry-renderers.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-entry.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-entry.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-equip-cmp.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-equip-cmp.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-event.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-event.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-fault.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-fault.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-game.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-game.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-help.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-help.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-history.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-history.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-init.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-init.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-input.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-input.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-keymap.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-keymap.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-knowledge.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-knowledge.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-map.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-map.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-menu.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-menu.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-mon-list.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-mon-list.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-mon-lore.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-mon-lore.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-obj-list.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-obj-list.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-object.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-object.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-options.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-options.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-output.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-output.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-player.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-player.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-prefs.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-prefs.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-score.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-score.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-signals.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-signals.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-spell.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-spell.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-store.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-store.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-target.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-target.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-term.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-term.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-visuals.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-visuals.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/ui-wizard.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/ui-wizard.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/wiz-debug.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/wiz-debug.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/wiz-spoil.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/wiz-spoil.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/wiz-stats.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/wiz-stats.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/world.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/world.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-bitflag.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-bitflag.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-color.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-color.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-dice.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-dice.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-expression.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-expression.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-file.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-file.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-form.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-form.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-quark.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-quark.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-queue.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-queue.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-rand.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-rand.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-set.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-set.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-textblock.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-textblock.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-type.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-type.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-util.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-util.c.o.d"
+  "CMakeFiles/OurCoreLib.dir/src/z-virt.c.o"
+  "CMakeFiles/OurCoreLib.dir/src/z-virt.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/OurCoreLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
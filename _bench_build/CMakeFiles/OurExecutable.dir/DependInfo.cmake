@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/main-genbench.c" "CMakeFiles/OurExecutable.dir/src/main-genbench.c.o" "gcc" "CMakeFiles/OurExecutable.dir/src/main-genbench.c.o.d"
+  "/root/repo/src/main-spoil.c" "CMakeFiles/OurExecutable.dir/src/main-spoil.c.o" "gcc" "CMakeFiles/OurExecutable.dir/src/main-spoil.c.o.d"
+  "/root/repo/src/main-x11.c" "CMakeFiles/OurExecutable.dir/src/main-x11.c.o" "gcc" "CMakeFiles/OurExecutable.dir/src/main-x11.c.o.d"
+  "/root/repo/src/main.c" "CMakeFiles/OurExecutable.dir/src/main.c.o" "gcc" "CMakeFiles/OurExecutable.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
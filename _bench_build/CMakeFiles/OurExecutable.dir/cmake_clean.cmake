@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OurExecutable.dir/src/main-genbench.c.o"
+  "CMakeFiles/OurExecutable.dir/src/main-genbench.c.o.d"
+  "CMakeFiles/OurExecutable.dir/src/main-spoil.c.o"
+  "CMakeFiles/OurExecutable.dir/src/main-spoil.c.o.d"
+  "CMakeFiles/OurExecutable.dir/src/main-x11.c.o"
+  "CMakeFiles/OurExecutable.dir/src/main-x11.c.o.d"
+  "CMakeFiles/OurExecutable.dir/src/main.c.o"
+  "CMakeFiles/OurExecutable.dir/src/main.c.o.d"
+  "Xygos"
+  "Xygos.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/OurExecutable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
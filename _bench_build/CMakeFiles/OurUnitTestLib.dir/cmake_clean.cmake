@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OurUnitTestLib.dir/src/tests/test-utils.c.o"
+  "CMakeFiles/OurUnitTestLib.dir/src/tests/test-utils.c.o.d"
+  "CMakeFiles/OurUnitTestLib.dir/src/tests/unit-test.c.o"
+  "CMakeFiles/OurUnitTestLib.dir/src/tests/unit-test.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/OurUnitTestLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
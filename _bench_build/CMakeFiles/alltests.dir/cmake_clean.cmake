@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/alltests"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/alltests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/allunittests"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/allunittests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
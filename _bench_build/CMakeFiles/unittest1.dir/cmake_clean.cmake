@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest1.dir/src/tests/effects/chain.c.o"
+  "CMakeFiles/unittest1.dir/src/tests/effects/chain.c.o.d"
+  "unittests/effects/chain"
+  "unittests/effects/chain.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest10.dir/src/tests/object/wish.c.o"
+  "CMakeFiles/unittest10.dir/src/tests/object/wish.c.o.d"
+  "unittests/object/wish"
+  "unittests/object/wish.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest10.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
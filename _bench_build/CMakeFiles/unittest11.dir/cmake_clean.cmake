@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest11.dir/src/tests/z-quark/quark.c.o"
+  "CMakeFiles/unittest11.dir/src/tests/z-quark/quark.c.o.d"
+  "unittests/z-quark/quark"
+  "unittests/z-quark/quark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest11.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest12.dir/src/tests/game/basic.c.o"
+  "CMakeFiles/unittest12.dir/src/tests/game/basic.c.o.d"
+  "unittests/game/basic"
+  "unittests/game/basic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest12.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
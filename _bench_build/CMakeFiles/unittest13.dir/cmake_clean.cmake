@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest13.dir/src/tests/game/mage.c.o"
+  "CMakeFiles/unittest13.dir/src/tests/game/mage.c.o.d"
+  "unittests/game/mage"
+  "unittests/game/mage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest13.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
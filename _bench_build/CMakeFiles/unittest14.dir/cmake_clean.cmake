@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest14.dir/src/tests/z-textblock/textblock.c.o"
+  "CMakeFiles/unittest14.dir/src/tests/z-textblock/textblock.c.o.d"
+  "unittests/z-textblock/textblock"
+  "unittests/z-textblock/textblock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest14.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
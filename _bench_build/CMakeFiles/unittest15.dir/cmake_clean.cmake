@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest15.dir/src/tests/z-util/util.c.o"
+  "CMakeFiles/unittest15.dir/src/tests/z-util/util.c.o.d"
+  "unittests/z-util/util"
+  "unittests/z-util/util.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest15.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
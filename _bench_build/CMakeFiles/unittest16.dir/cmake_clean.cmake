@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest16.dir/src/tests/z-expression/expression.c.o"
+  "CMakeFiles/unittest16.dir/src/tests/z-expression/expression.c.o.d"
+  "unittests/z-expression/expression"
+  "unittests/z-expression/expression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest16.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest17.dir/src/tests/command/lookup.c.o"
+  "CMakeFiles/unittest17.dir/src/tests/command/lookup.c.o.d"
+  "unittests/command/lookup"
+  "unittests/command/lookup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest17.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest18.dir/src/tests/message/message.c.o"
+  "CMakeFiles/unittest18.dir/src/tests/message/message.c.o.d"
+  "unittests/message/message"
+  "unittests/message/message.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest18.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
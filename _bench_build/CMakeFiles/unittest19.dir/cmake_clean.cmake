@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest19.dir/src/tests/cave/floors.c.o"
+  "CMakeFiles/unittest19.dir/src/tests/cave/floors.c.o.d"
+  "unittests/cave/floors"
+  "unittests/cave/floors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest19.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest2.dir/src/tests/effects/destruction.c.o"
+  "CMakeFiles/unittest2.dir/src/tests/effects/destruction.c.o.d"
+  "unittests/effects/destruction"
+  "unittests/effects/destruction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
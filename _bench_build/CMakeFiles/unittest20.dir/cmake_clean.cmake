@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest20.dir/src/tests/cave/flow.c.o"
+  "CMakeFiles/unittest20.dir/src/tests/cave/flow.c.o.d"
+  "unittests/cave/flow"
+  "unittests/cave/flow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest20.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest21.dir/src/tests/cave/mon-index.c.o"
+  "CMakeFiles/unittest21.dir/src/tests/cave/mon-index.c.o.d"
+  "unittests/cave/mon-index"
+  "unittests/cave/mon-index.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest21.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
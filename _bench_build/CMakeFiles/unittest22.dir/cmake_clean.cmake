@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest22.dir/src/tests/cave/ray.c.o"
+  "CMakeFiles/unittest22.dir/src/tests/cave/ray.c.o.d"
+  "unittests/cave/ray"
+  "unittests/cave/ray.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest22.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
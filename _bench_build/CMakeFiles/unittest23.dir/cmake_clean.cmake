@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest23.dir/src/tests/cave/scatter.c.o"
+  "CMakeFiles/unittest23.dir/src/tests/cave/scatter.c.o.d"
+  "unittests/cave/scatter"
+  "unittests/cave/scatter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest23.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest24.dir/src/tests/cave/scent.c.o"
+  "CMakeFiles/unittest24.dir/src/tests/cave/scent.c.o.d"
+  "unittests/cave/scent"
+  "unittests/cave/scent.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest24.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest25.dir/src/tests/monster/attack.c.o"
+  "CMakeFiles/unittest25.dir/src/tests/monster/attack.c.o.d"
+  "unittests/monster/attack"
+  "unittests/monster/attack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest25.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest26.dir/src/tests/monster/monster.c.o"
+  "CMakeFiles/unittest26.dir/src/tests/monster/monster.c.o.d"
+  "unittests/monster/monster"
+  "unittests/monster/monster.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest26.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest27.dir/src/tests/monster/schedule.c.o"
+  "CMakeFiles/unittest27.dir/src/tests/monster/schedule.c.o.d"
+  "unittests/monster/schedule"
+  "unittests/monster/schedule.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest27.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
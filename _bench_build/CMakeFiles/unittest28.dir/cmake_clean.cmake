@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest28.dir/src/tests/parse/a-info.c.o"
+  "CMakeFiles/unittest28.dir/src/tests/parse/a-info.c.o.d"
+  "unittests/parse/a-info"
+  "unittests/parse/a-info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest28.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
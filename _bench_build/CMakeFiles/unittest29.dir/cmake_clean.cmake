@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest29.dir/src/tests/parse/c-info.c.o"
+  "CMakeFiles/unittest29.dir/src/tests/parse/c-info.c.o.d"
+  "unittests/parse/c-info"
+  "unittests/parse/c-info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest29.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
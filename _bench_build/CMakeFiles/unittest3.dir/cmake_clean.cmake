@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest3.dir/src/tests/effects/earthquake.c.o"
+  "CMakeFiles/unittest3.dir/src/tests/effects/earthquake.c.o.d"
+  "unittests/effects/earthquake"
+  "unittests/effects/earthquake.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
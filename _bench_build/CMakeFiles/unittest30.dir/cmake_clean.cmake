@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest30.dir/src/tests/parse/e-info.c.o"
+  "CMakeFiles/unittest30.dir/src/tests/parse/e-info.c.o.d"
+  "unittests/parse/e-info"
+  "unittests/parse/e-info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest30.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
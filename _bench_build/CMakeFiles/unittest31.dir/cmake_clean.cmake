@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest31.dir/src/tests/parse/f-info.c.o"
+  "CMakeFiles/unittest31.dir/src/tests/parse/f-info.c.o.d"
+  "unittests/parse/f-info"
+  "unittests/parse/f-info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest31.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
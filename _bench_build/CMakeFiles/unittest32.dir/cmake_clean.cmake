@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest32.dir/src/tests/parse/flavor.c.o"
+  "CMakeFiles/unittest32.dir/src/tests/parse/flavor.c.o.d"
+  "unittests/parse/flavor"
+  "unittests/parse/flavor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest33.dir/src/tests/parse/h-info.c.o"
+  "CMakeFiles/unittest33.dir/src/tests/parse/h-info.c.o.d"
+  "unittests/parse/h-info"
+  "unittests/parse/h-info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest33.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
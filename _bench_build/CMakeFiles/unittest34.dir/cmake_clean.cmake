@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest34.dir/src/tests/parse/k-info.c.o"
+  "CMakeFiles/unittest34.dir/src/tests/parse/k-info.c.o.d"
+  "unittests/parse/k-info"
+  "unittests/parse/k-info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest34.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest35.dir/src/tests/parse/lore.c.o"
+  "CMakeFiles/unittest35.dir/src/tests/parse/lore.c.o.d"
+  "unittests/parse/lore"
+  "unittests/parse/lore.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest35.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest36.dir/src/tests/parse/names.c.o"
+  "CMakeFiles/unittest36.dir/src/tests/parse/names.c.o.d"
+  "unittests/parse/names"
+  "unittests/parse/names.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest36.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
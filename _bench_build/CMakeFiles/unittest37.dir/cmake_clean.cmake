@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest37.dir/src/tests/parse/p-info.c.o"
+  "CMakeFiles/unittest37.dir/src/tests/parse/p-info.c.o.d"
+  "unittests/parse/p-info"
+  "unittests/parse/p-info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest37.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
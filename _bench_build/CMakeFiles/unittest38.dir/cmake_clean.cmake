@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest38.dir/src/tests/parse/parse.c.o"
+  "CMakeFiles/unittest38.dir/src/tests/parse/parse.c.o.d"
+  "unittests/parse/parse"
+  "unittests/parse/parse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest38.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
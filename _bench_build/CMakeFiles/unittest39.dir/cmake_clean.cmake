@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest39.dir/src/tests/parse/r-info.c.o"
+  "CMakeFiles/unittest39.dir/src/tests/parse/r-info.c.o.d"
+  "unittests/parse/r-info"
+  "unittests/parse/r-info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest39.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest4.dir/src/tests/effects/info.c.o"
+  "CMakeFiles/unittest4.dir/src/tests/effects/info.c.o.d"
+  "unittests/effects/info"
+  "unittests/effects/info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest40.dir/src/tests/parse/readstore.c.o"
+  "CMakeFiles/unittest40.dir/src/tests/parse/readstore.c.o.d"
+  "unittests/parse/readstore"
+  "unittests/parse/readstore.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest40.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
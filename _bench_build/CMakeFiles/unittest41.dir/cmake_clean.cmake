@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest41.dir/src/tests/parse/v-info.c.o"
+  "CMakeFiles/unittest41.dir/src/tests/parse/v-info.c.o.d"
+  "unittests/parse/v-info"
+  "unittests/parse/v-info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest41.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
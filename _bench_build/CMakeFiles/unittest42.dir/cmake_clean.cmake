@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest42.dir/src/tests/parse/z-info.c.o"
+  "CMakeFiles/unittest42.dir/src/tests/parse/z-info.c.o.d"
+  "unittests/parse/z-info"
+  "unittests/parse/z-info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest42.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
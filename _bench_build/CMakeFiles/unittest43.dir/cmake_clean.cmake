@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest43.dir/src/tests/artifact/name.c.o"
+  "CMakeFiles/unittest43.dir/src/tests/artifact/name.c.o.d"
+  "unittests/artifact/name"
+  "unittests/artifact/name.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest43.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest44.dir/src/tests/z-dice/dice.c.o"
+  "CMakeFiles/unittest44.dir/src/tests/z-dice/dice.c.o.d"
+  "unittests/z-dice/dice"
+  "unittests/z-dice/dice.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest44.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
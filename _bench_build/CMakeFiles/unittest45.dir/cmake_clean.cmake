@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest45.dir/src/tests/trivial/trivial.c.o"
+  "CMakeFiles/unittest45.dir/src/tests/trivial/trivial.c.o.d"
+  "unittests/trivial/trivial"
+  "unittests/trivial/trivial.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest45.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
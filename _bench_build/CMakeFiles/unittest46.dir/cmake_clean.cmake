@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest46.dir/src/tests/z-virt/mem.c.o"
+  "CMakeFiles/unittest46.dir/src/tests/z-virt/mem.c.o.d"
+  "unittests/z-virt/mem"
+  "unittests/z-virt/mem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest46.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest47.dir/src/tests/z-virt/string.c.o"
+  "CMakeFiles/unittest47.dir/src/tests/z-virt/string.c.o.d"
+  "unittests/z-virt/string"
+  "unittests/z-virt/string.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest47.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
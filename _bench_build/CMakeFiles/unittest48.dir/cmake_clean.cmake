@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest48.dir/src/tests/player/birth.c.o"
+  "CMakeFiles/unittest48.dir/src/tests/player/birth.c.o.d"
+  "unittests/player/birth"
+  "unittests/player/birth.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest48.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest49.dir/src/tests/player/calc-inventory.c.o"
+  "CMakeFiles/unittest49.dir/src/tests/player/calc-inventory.c.o.d"
+  "unittests/player/calc-inventory"
+  "unittests/player/calc-inventory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest49.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
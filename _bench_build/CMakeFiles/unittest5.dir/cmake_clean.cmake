@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest5.dir/src/tests/object/alloc.c.o"
+  "CMakeFiles/unittest5.dir/src/tests/object/alloc.c.o.d"
+  "unittests/object/alloc"
+  "unittests/object/alloc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest50.dir/src/tests/player/history.c.o"
+  "CMakeFiles/unittest50.dir/src/tests/player/history.c.o.d"
+  "unittests/player/history"
+  "unittests/player/history.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest50.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest51.dir/src/tests/player/inven-carry-num.c.o"
+  "CMakeFiles/unittest51.dir/src/tests/player/inven-carry-num.c.o.d"
+  "unittests/player/inven-carry-num"
+  "unittests/player/inven-carry-num.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest51.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest52.dir/src/tests/player/inven-wield.c.o"
+  "CMakeFiles/unittest52.dir/src/tests/player/inven-wield.c.o.d"
+  "unittests/player/inven-wield"
+  "unittests/player/inven-wield.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest52.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
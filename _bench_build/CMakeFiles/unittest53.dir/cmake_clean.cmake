@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest53.dir/src/tests/player/pathfind.c.o"
+  "CMakeFiles/unittest53.dir/src/tests/player/pathfind.c.o.d"
+  "unittests/player/pathfind"
+  "unittests/player/pathfind.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest53.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest54.dir/src/tests/player/playerstat.c.o"
+  "CMakeFiles/unittest54.dir/src/tests/player/playerstat.c.o.d"
+  "unittests/player/playerstat"
+  "unittests/player/playerstat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest54.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
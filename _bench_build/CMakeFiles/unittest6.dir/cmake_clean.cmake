@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest6.dir/src/tests/object/attack.c.o"
+  "CMakeFiles/unittest6.dir/src/tests/object/attack.c.o.d"
+  "unittests/object/attack"
+  "unittests/object/attack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
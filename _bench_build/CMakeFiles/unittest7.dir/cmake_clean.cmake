@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest7.dir/src/tests/object/util.c.o"
+  "CMakeFiles/unittest7.dir/src/tests/object/util.c.o.d"
+  "unittests/object/util"
+  "unittests/object/util.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest8.dir/src/tests/object/pile.c.o"
+  "CMakeFiles/unittest8.dir/src/tests/object/pile.c.o.d"
+  "unittests/object/pile"
+  "unittests/object/pile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittest9.dir/src/tests/object/slays.c.o"
+  "CMakeFiles/unittest9.dir/src/tests/object/slays.c.o.d"
+  "unittests/object/slays"
+  "unittests/object/slays.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittest9.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
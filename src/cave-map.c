@@ -1,6 +1,6 @@
 /**
  * \file cave-map.c
- * \brief Lighting and map management functions
+ * \brief Lighting, map management and flow field functions
  *
  * Copyright (c) 1997 Ben Harrison, James E. Wilson, Robert A. Koeneke
  *
@@ -647,3 +647,134 @@ void cave_known(struct player *p)
 		}
 	}
 }
+
+/**
+ * Whether a mover of the given kind can get into a grid on its way to a
+ * flow field's target.
+ */
+static bool flow_passes(struct chunk *c, struct loc grid, int kind)
+{
+	switch (kind) {
+		case FLOW_WALLS:
+			return !square_isperm(c, grid);
+		case FLOW_ANY_TERRAIN:
+			return square_ispassable(c, grid) || square_iscloseddoor(c, grid);
+		default:
+			return (square_ispassable(c, grid) ||
+					square_iscloseddoor(c, grid)) &&
+				!square_isdamaging(c, grid);
+	}
+}
+
+/**
+ * Work out a flow field from its target outwards, as make_noise() does for
+ * the player.
+ */
+static void flow_fill(struct chunk *c, struct flow_field *flow)
+{
+	struct grid_list *reach = &flow->reach;
+	int head, d;
+
+	/* Clear the grids reached last time */
+	for (head = 0; head < reach->count; head++) {
+		struct loc grid = reach->grids[head];
+		flow->steps.grids[grid.y][grid.x] = 0;
+	}
+
+	flow->steps.grids[flow->target.y][flow->target.x] = 1;
+	reach->grids[0] = flow->target;
+	reach->count = 1;
+
+	for (head = 0; head < reach->count; head++) {
+		struct loc next = reach->grids[head];
+		int steps = flow->steps.grids[next.y][next.x] + 1;
+
+		/* Grids are reached in order of steps, so the rest are too far */
+		if (steps > FLOW_DEPTH + 1) break;
+
+		for (d = 0; d < 8; d++) {
+			struct loc grid = loc_sum(next, ddgrid_ddd[d]);
+
+			if (!square_in_bounds(c, grid)) continue;
+			if (flow->steps.grids[grid.y][grid.x]) continue;
+			if (!flow_passes(c, grid, flow->kind)) continue;
+
+			flow->steps.grids[grid.y][grid.x] = steps;
+			reach->grids[reach->count++] = grid;
+		}
+	}
+
+	flow->terrain_changes = c->terrain_changes;
+}
+
+/**
+ * Get the flow field toward a target for a kind of mover, working it out
+ * only if no monster has needed it since the terrain last changed.
+ *
+ * Fields are kept in a few slots per level, with the one used least
+ * recently making way for a new target, so monsters chasing the same
+ * thing share one search however many of them there are.
+ */
+const struct flow_field *cave_flow_field(struct chunk *c, struct loc target,
+		int kind)
+{
+	struct flow_field *flow = NULL;
+	int i;
+
+	if (!c->flows) {
+		c->flows = mem_zalloc(FLOW_FIELDS * sizeof(struct flow_field));
+	}
+
+	for (i = 0; i < FLOW_FIELDS; i++) {
+		struct flow_field *slot = &c->flows[i];
+
+		if (slot->steps.grids && slot->kind == kind &&
+			loc_eq(slot->target, target)) {
+			flow = slot;
+			break;
+		}
+		if (!flow || slot->last_used < flow->last_used) flow = slot;
+	}
+
+	if (!flow->steps.grids) {
+		int y;
+
+		flow->steps.grids = mem_zalloc(c->height * sizeof(uint16_t*));
+		flow->steps.grids[0] = mem_zalloc(c->height * c->width *
+			sizeof(uint16_t));
+		for (y = 1; y < c->height; y++) {
+			flow->steps.grids[y] = flow->steps.grids[y - 1] + c->width;
+		}
+		flow->reach.size = c->height * c->width;
+		flow->reach.grids = mem_zalloc(flow->reach.size * sizeof(struct loc));
+	}
+
+	if (i == FLOW_FIELDS || flow->terrain_changes != c->terrain_changes) {
+		flow->target = target;
+		flow->kind = kind;
+		flow_fill(c, flow);
+	}
+
+	flow->last_used = ++c->flow_uses;
+	return flow;
+}
+
+/**
+ * Free the flow fields kept for a level.
+ */
+void cave_forget_flow(struct chunk *c)
+{
+	int i;
+
+	if (!c->flows) return;
+
+	for (i = 0; i < FLOW_FIELDS; i++) {
+		if (c->flows[i].steps.grids) {
+			mem_free(c->flows[i].steps.grids[0]);
+			mem_free(c->flows[i].steps.grids);
+		}
+		mem_free(c->flows[i].reach.grids);
+	}
+	mem_free(c->flows);
+	c->flows = NULL;
+}
@@ -435,14 +435,6 @@ bool square_isnotknown(struct chunk *c, struct loc grid) {
  * about its location or status.
  */
 
-/**
- * True if the given flag is true
- */
-bool square_hasflag(struct chunk *c, struct loc grid, unsigned flag) {
-	if (!square_in_bounds(c, grid)) return false;
-	return tf_has(f_info[square(c, grid)->feat].flags, flag);
-}
-
 /**
  * True if the square is marked
  */
@@ -451,14 +443,6 @@ bool square_ismark(struct chunk *c, struct loc grid) {
 	return sqinfo_has(square(c, grid)->info, SQUARE_MARK);
 }
 
-/**
- * True if the square is lit
- */
-bool square_isglow(struct chunk *c, struct loc grid) {
-	assert(square_in_bounds(c, grid));
-	return sqinfo_has(square(c, grid)->info, SQUARE_GLOW);
-}
-
 /**
  * True if the square is part of a vault.
  *
@@ -477,30 +461,6 @@ bool square_isroom(struct chunk *c, struct loc grid) {
 	return sqinfo_has(square(c, grid)->info, SQUARE_ROOM);
 }
 
-/**
- * True if the square has been seen by the player
- */
-bool square_isseen(struct chunk *c, struct loc grid) {
-	assert(square_in_bounds(c, grid));
-	return sqinfo_has(square(c, grid)->info, SQUARE_SEEN);
-}
-
-/**
- * True if the cave square is currently viewable by the player
- */
-bool square_isview(struct chunk *c, struct loc grid) {
-	assert(square_in_bounds(c, grid));
-	return sqinfo_has(square(c, grid)->info, SQUARE_VIEW);
-}
-
-/**
- * True if the cave square was seen before the current update
- */
-bool square_wasseen(struct chunk *c, struct loc grid) {
-	assert(square_in_bounds(c, grid));
-	return sqinfo_has(square(c, grid)->info, SQUARE_WASSEEN);
-}
-
 /**
  * True if cave square is a feeling trigger square 
  */
@@ -683,30 +643,6 @@ bool square_is_monster_walkable(struct chunk *c, struct loc grid)
 	return feat_is_monster_walkable(square(c, grid)->feat);
 }
 
-/**
- * True if the square is passable by the player.
- */
-bool square_ispassable(struct chunk *c, struct loc grid) {
-	assert(square_in_bounds(c, grid));
-	return feat_is_passable(square(c, grid)->feat);
-}
-
-/**
- * True if any projectable can pass through the square.
- */
-bool square_isprojectable(struct chunk *c, struct loc grid) {
-	if (!square_in_bounds(c, grid)) return false;
-	return feat_is_projectable(square(c, grid)->feat);
-}
-
-/**
- * True if the square allows line-of-sight.
- */
-bool square_allowslos(struct chunk *c, struct loc grid) {
-	assert(square_in_bounds(c, grid));
-	return feat_is_los(square(c, grid)->feat);
-}
-
 /**
  * True if the square is a permanent wall or one of the "stronger" walls.
  *
@@ -928,21 +864,6 @@ bool square_changeable(struct chunk *c, struct loc grid)
 	return (true);
 }
 
-
-bool square_in_bounds(struct chunk *c, struct loc grid)
-{
-	assert(c);
-	return grid.x >= 0 && grid.x < c->width &&
-		grid.y >= 0 && grid.y < c->height;
-}
-
-bool square_in_bounds_fully(struct chunk *c, struct loc grid)
-{
-	assert(c);
-	return grid.x > 0 && grid.x < c->width - 1 &&
-		grid.y > 0 && grid.y < c->height - 1;
-}
-
 /**
  * Checks if a square is thought by the player to block projections
  */
@@ -985,20 +906,12 @@ bool square_allows_summon(struct chunk *c, struct loc grid)
 		&& !square_isdecoyed(c, grid);
 }
 
-
-
 /**
  * OTHER SQUARE FUNCTIONS
  *
  * Below are various square-specific functions which are not predicates
  */
 
-const struct square *square(struct chunk *c, struct loc grid)
-{
-	assert(square_in_bounds(c, grid));
-	return &c->squares[grid.y][grid.x];
-}
-
 uint8_t square_tag(struct chunk *c, struct loc grid)
 {
 	assert(square_in_bounds(c, grid));
@@ -1011,12 +924,6 @@ struct feature *square_feat(struct chunk *c, struct loc grid)
 	return &f_info[square(c, grid)->feat];
 }
 
-int square_light(struct chunk *c, struct loc grid)
-{
-	assert(square_in_bounds(c, grid));
-	return square(c, grid)->light;
-}
-
 /**
  * Get a monster on the current level by its position.
  */
@@ -1217,6 +1124,13 @@ void square_set_feat(struct chunk *c, struct loc grid, int feat)
 
 	/* Make the change */
 	c->squares[grid.y][grid.x].feat = feat;
+	c->terrain_changes++;
+	cave_note_floor(c, grid);
+
+	/* The occupant may now be standing on damaging terrain, or not */
+	if (square(c, grid)->mon > 0) {
+		cave_monster_file(c, grid, square(c, grid)->mon);
+	}
 
 	/* Light bright terrain */
 	if (feat_is_bright(feat)) {
@@ -1253,6 +1167,7 @@ static void square_set_known_feat(struct chunk *c, struct loc grid, int feat)
  */
 void square_set_mon(struct chunk *c, struct loc grid, int midx)
 {
+	cave_monster_file(c, grid, midx);
 	c->squares[grid.y][grid.x].mon = midx;
 }
 
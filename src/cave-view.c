@@ -48,6 +48,19 @@ int distance(struct loc grid1, struct loc grid2)
 	return ay > ax ? ay + (ax >> 1) : ax + (ay >> 1);
 }
 
+/**
+ * Help los_walk():  test one grid on the way, or record it when tracing.
+ */
+static bool los_test(struct chunk *c, struct loc grid, unsigned flag,
+		struct loc *trace, int *n_trace)
+{
+	if (trace) {
+		trace[(*n_trace)++] = grid;
+		return true;
+	}
+	return square_hasflag(c, grid, flag);
+}
+
 /**
  * A simple, fast, integer-based line-of-sight algorithm.  By Joseph Hall,
  * 4116 Brewster Drive, Raleigh NC 27606.  Email to jnh@ecemwl.ncsu.edu.
@@ -83,8 +96,14 @@ int distance(struct loc grid1, struct loc grid2)
  * are "viewable" by the player, which is used for many things, such as
  * determining which grids are illuminated by the player's torch, and which
  * grids and monsters can be "seen" by the player, etc).
+ *
+ * If trace is not NULL, no grids are tested; instead every grid that would
+ * be tested (other than for the "knight move" case) is appended to trace,
+ * with n_trace holding the count.  That is how the ray table used by
+ * los_flag() is built.
  */
-bool los_flag(struct chunk *c, struct loc grid1, struct loc grid2, unsigned flag)
+static bool los_walk(struct chunk *c, struct loc grid1, struct loc grid2,
+		unsigned flag, struct loc *trace, int *n_trace)
 {
 	/* Delta */
 	int dx, dy;
@@ -123,10 +142,12 @@ bool los_flag(struct chunk *c, struct loc grid1, struct loc grid2, unsigned flag
 		/* South -- check for walls */
 		if (dy > 0) {
 			for (ty = grid1.y + 1; ty < grid2.y; ty++)
-				if (!square_hasflag(c, loc(grid1.x, ty), flag)) return (false);
+				if (!los_test(c, loc(grid1.x, ty), flag, trace, n_trace))
+					return (false);
 		} else { /* North -- check for walls */
 			for (ty = grid1.y - 1; ty > grid2.y; ty--)
-				if (!square_hasflag(c, loc(grid1.x, ty), flag)) return (false);
+				if (!los_test(c, loc(grid1.x, ty), flag, trace, n_trace))
+					return (false);
 		}
 
 		/* Assume los */
@@ -138,10 +159,12 @@ bool los_flag(struct chunk *c, struct loc grid1, struct loc grid2, unsigned flag
 		/* East -- check for walls */
 		if (dx > 0) {
 			for (tx = grid1.x + 1; tx < grid2.x; tx++)
-				if (!square_hasflag(c, loc(tx, grid1.y), flag)) return (false);
+				if (!los_test(c, loc(tx, grid1.y), flag, trace, n_trace))
+					return (false);
 		} else { /* West -- check for walls */
 			for (tx = grid1.x - 1; tx > grid2.x; tx--)
-				if (!square_hasflag(c, loc(tx, grid1.y), flag)) return (false);
+				if (!los_test(c, loc(tx, grid1.y), flag, trace, n_trace))
+					return (false);
 		}
 
 		/* Assume los */
@@ -153,11 +176,11 @@ bool los_flag(struct chunk *c, struct loc grid1, struct loc grid2, unsigned flag
 	sx = (dx < 0) ? -1 : 1;
 	sy = (dy < 0) ? -1 : 1;
 
-	/* Vertical and horizontal "knights" */
-	if ((ax == 1) && (ay == 2) &&
+	/* Vertical and horizontal "knights" (never when tracing) */
+	if (!trace && (ax == 1) && (ay == 2) &&
 		square_hasflag(c, loc(grid1.x, grid1.y + sy), flag)) {
 		return (true);
-	} else if ((ay == 1) && (ax == 2) &&
+	} else if (!trace && (ay == 1) && (ax == 2) &&
 			   square_hasflag(c, loc(grid1.x + sx, grid1.y), flag)) {
 		return (true);
 	}
@@ -188,7 +211,7 @@ bool los_flag(struct chunk *c, struct loc grid1, struct loc grid2, unsigned flag
 		/* Note (below) the case (qy == f2), where */
 		/* the LOS exactly meets the corner of a tile. */
 		while (grid2.x - tx) {
-			if (!square_hasflag(c, loc(tx, ty), flag))
+			if (!los_test(c, loc(tx, ty), flag, trace, n_trace))
 				return (false);
 
 			qy += m;
@@ -197,7 +220,7 @@ bool los_flag(struct chunk *c, struct loc grid1, struct loc grid2, unsigned flag
 				tx += sx;
 			} else if (qy > f2) {
 				ty += sy;
-				if (!square_hasflag(c, loc(tx, ty), flag))
+				if (!los_test(c, loc(tx, ty), flag, trace, n_trace))
 					return (false);
 				qy -= f1;
 				tx += sx;
@@ -224,7 +247,7 @@ bool los_flag(struct chunk *c, struct loc grid1, struct loc grid2, unsigned flag
 		/* Note (below) the case (qx == f2), where */
 		/* the LOS exactly meets the corner of a tile. */
 		while (grid2.y - ty) {
-			if (!square_hasflag(c, loc(tx, ty), flag))
+			if (!los_test(c, loc(tx, ty), flag, trace, n_trace))
 				return (false);
 
 			qx += m;
@@ -233,7 +256,7 @@ bool los_flag(struct chunk *c, struct loc grid1, struct loc grid2, unsigned flag
 				ty += sy;
 			} else if (qx > f2) {
 				tx += sx;
-				if (!square_hasflag(c, loc(tx, ty), flag))
+				if (!los_test(c, loc(tx, ty), flag, trace, n_trace))
 					return (false);
 				qx -= f1;
 				ty += sy;
@@ -249,6 +272,107 @@ bool los_flag(struct chunk *c, struct loc grid1, struct loc grid2, unsigned flag
 	return (true);
 }
 
+/**
+ * Precomputed line-of-sight rays.  For each offset of up to los_ray_range
+ * grids in either direction, the grids (relative to the start) that
+ * los_walk() would test; a line of sight exists when all of them allow it,
+ * apart from the "knight move" shortcut.
+ */
+struct los_ray {
+	int start;	/* Index of the first grid in los_ray_grids */
+	int len;	/* Number of grids */
+};
+
+static struct los_ray *los_rays;
+static struct loc *los_ray_grids;
+static int los_ray_range;
+
+/**
+ * Get the index of the ray for an offset, or -1 if it is out of range
+ */
+static int los_ray_index(int dx, int dy)
+{
+	if (!los_rays || ABS(dx) > los_ray_range || ABS(dy) > los_ray_range)
+		return -1;
+	return (dy + los_ray_range) * (2 * los_ray_range + 1) + dx +
+		los_ray_range;
+}
+
+/**
+ * Build the ray table, covering z_info->max_range
+ */
+static void init_los_rays(void)
+{
+	int size, dx, dy, n = 0, alloc;
+
+	los_ray_range = z_info->max_range;
+	size = 2 * los_ray_range + 1;
+	los_rays = mem_zalloc(size * size * sizeof(*los_rays));
+
+	/* No ray tests more than two grids per step along its major axis */
+	alloc = size * size * 2 * los_ray_range;
+	los_ray_grids = mem_zalloc(alloc * sizeof(*los_ray_grids));
+
+	for (dy = -los_ray_range; dy <= los_ray_range; dy++) {
+		for (dx = -los_ray_range; dx <= los_ray_range; dx++) {
+			struct los_ray *ray = &los_rays[los_ray_index(dx, dy)];
+			int len = 0;
+
+			ray->start = n;
+			los_walk(NULL, loc(0, 0), loc(dx, dy), 0,
+				los_ray_grids + n, &len);
+			ray->len = len;
+			n += len;
+			assert(n <= alloc);
+		}
+	}
+}
+
+static void cleanup_los_rays(void)
+{
+	mem_free(los_rays);
+	los_rays = NULL;
+	mem_free(los_ray_grids);
+	los_ray_grids = NULL;
+	los_ray_range = 0;
+}
+
+struct init_module view_module = {
+	.name = "view",
+	.init = init_los_rays,
+	.cleanup = cleanup_los_rays
+};
+
+/**
+ * Check for a line of sight from grid1 to grid2 along which every grid in
+ * between has the terrain flag flag (see los_walk() for the details).  Nearby
+ * pairs of grids use the precomputed ray table.
+ */
+bool los_flag(struct chunk *c, struct loc grid1, struct loc grid2, unsigned flag)
+{
+	int dx = grid2.x - grid1.x, dy = grid2.y - grid1.y;
+	int idx = los_ray_index(dx, dy);
+	const struct loc *grid;
+	int i;
+
+	if (idx < 0) return los_walk(c, grid1, grid2, flag, NULL, NULL);
+
+	/* Vertical and horizontal "knights" */
+	if ((ABS(dx) == 1) && (ABS(dy) == 2) &&
+		square_hasflag(c, loc(grid1.x, grid1.y + dy / 2), flag)) {
+		return true;
+	} else if ((ABS(dy) == 1) && (ABS(dx) == 2) &&
+			   square_hasflag(c, loc(grid1.x + dx / 2, grid1.y), flag)) {
+		return true;
+	}
+
+	grid = los_ray_grids + los_rays[idx].start;
+	for (i = 0; i < los_rays[idx].len; i++) {
+		if (!square_hasflag(c, loc_sum(grid1, grid[i]), flag)) return false;
+	}
+	return true;
+}
+
 bool los(struct chunk *c, struct loc grid1, struct loc grid2)
 {
 	return los_flag(c, grid1, grid2, TF_PROJECT);
@@ -437,21 +561,60 @@ bool los(struct chunk *c, struct loc grid1, struct loc grid2)
 
 
 /**
- * Mark the currently seen grids, then wipe in preparation for recalculating
+ * Add a grid to a grid list, growing the list as needed
+ */
+static void grid_list_add(struct grid_list *list, struct loc grid)
+{
+	if (list->count == list->size) {
+		list->size = list->size ? list->size * 2 : 256;
+		list->grids = mem_realloc(list->grids,
+			list->size * sizeof(*list->grids));
+	}
+	list->grids[list->count++] = grid;
+}
+
+/**
+ * Mark the currently seen grids, then wipe in preparation for recalculating.
+ *
+ * Only the grids remembered from the last update are touched; the first
+ * update on a chunk (or after it has been copied or loaded) has no such
+ * record and so scans the whole level for view flags instead.  Either way,
+ * the wiped grids are left in c->old_view and c->view is emptied.
  */
 static void mark_wasseen(struct chunk *c)
 {
-	int x, y;
-	/* Save the old "view" grids for later */
-	for (y = 0; y < c->height; y++) {
-		for (x = 0; x < c->width; x++) {
-			struct loc grid = loc(x, y);
-			if (square_isseen(c, grid))
-				sqinfo_on(square(c, grid)->info, SQUARE_WASSEEN);
-			sqinfo_off(square(c, grid)->info, SQUARE_VIEW);
-			sqinfo_off(square(c, grid)->info, SQUARE_SEEN);
-			sqinfo_off(square(c, grid)->info, SQUARE_CLOSE_PLAYER);
+	struct grid_list tmp = c->old_view;
+	int i;
+
+	/* The last view becomes the old view */
+	c->old_view = c->view;
+	c->view = tmp;
+	c->view.count = 0;
+
+	if (!c->view_valid) {
+		int x, y;
+
+		c->old_view.count = 0;
+		for (y = 0; y < c->height; y++) {
+			for (x = 0; x < c->width; x++) {
+				struct loc grid = loc(x, y);
+				if (square_isview(c, grid) || square_isseen(c, grid) ||
+					sqinfo_has(square(c, grid)->info,
+							   SQUARE_CLOSE_PLAYER))
+					grid_list_add(&c->old_view, grid);
+			}
 		}
+		c->view_valid = true;
+	}
+
+	/* Save the old "view" grids for later */
+	for (i = 0; i < c->old_view.count; i++) {
+		struct loc grid = c->old_view.grids[i];
+		if (square_isseen(c, grid))
+			sqinfo_on(square(c, grid)->info, SQUARE_WASSEEN);
+		sqinfo_off(square(c, grid)->info, SQUARE_VIEW);
+		sqinfo_off(square(c, grid)->info, SQUARE_SEEN);
+		sqinfo_off(square(c, grid)->info, SQUARE_CLOSE_PLAYER);
 	}
 }
 
@@ -617,21 +780,25 @@ static bool glow_can_light_wall(struct chunk *c, struct player *p,
 }
 
 /**
- * Help calc_lighting():  add in the effect of a light source.
+ * Help add_light():  find the grids reached by a light source, keeping the
+ * result in the source's cache entry.
  * \param c Is the chunk to use.
- * \param p Is the player to use.
+ * \param ls Is the cache entry for the source.
  * \param sgrid Is the location of the light source.
  * \param radius Is the radius, in grids, of the light source.
- * \param inten Is the intensity of the light source.
- * This is a brute force approach.  Some computation probably could be saved by
- * propagating the light out from the source and terminating paths when they
- * reach a wall.
+ * This is a brute force approach, but it only needs redoing when the source
+ * moves, its radius changes or the terrain of the level changes.
  */
-static void add_light(struct chunk *c, struct player *p, struct loc sgrid,
-		int radius, int inten)
+static void find_light_grids(struct chunk *c, struct light_source *ls,
+		struct loc sgrid, int radius)
 {
 	int y;
 
+	ls->grid = sgrid;
+	ls->radius = radius;
+	ls->terrain_changes = c->terrain_changes;
+	ls->count = 0;
+
 	for (y = -radius; y <= radius; y++) {
 		int x;
 
@@ -642,28 +809,74 @@ static void add_light(struct chunk *c, struct player *p, struct loc sgrid,
 			if (dist > radius) continue;
 			/* Don't propagate the light through walls. */
 			if (!los(c, sgrid, grid)) continue;
-			/*
-			 * Only light a wall if the face lit is possibly visible
-			 * to the player.
-			 */
-			if (!square_allowslos(c, grid) && !source_can_light_wall(c,
-					p, sgrid, grid)) continue;
-			/* Adjust the light level */
-			if (inten > 0) {
-				/* Light getting less further away */
-				c->squares[grid.y][grid.x].light +=
-					inten - dist;
-			} else {
-				/* Light getting greater further away */
-				c->squares[grid.y][grid.x].light +=
-					inten + dist;
+			if (ls->count == ls->size) {
+				ls->size = ls->size ? ls->size * 2 : 16;
+				ls->grids = mem_realloc(ls->grids,
+					ls->size * sizeof(*ls->grids));
 			}
+			ls->grids[ls->count].grid = grid;
+			ls->grids[ls->count].dist = dist;
+			ls->grids[ls->count].wall = !square_allowslos(c, grid);
+			ls->count++;
+		}
+	}
+}
+
+/**
+ * Help calc_lighting():  add in the effect of a light source.
+ * \param c Is the chunk to use.
+ * \param p Is the player to use.
+ * \param idx Is the index of the source in c->light_sources (0 for the
+ * player, otherwise the monster index).
+ * \param sgrid Is the location of the light source.
+ * \param radius Is the radius, in grids, of the light source.
+ * \param inten Is the intensity of the light source.
+ * Only grids in the area calc_lighting() is working on are changed.
+ */
+static void add_light(struct chunk *c, struct player *p, int idx,
+		struct loc sgrid, int radius, int inten)
+{
+	struct light_source *ls = &c->light_sources[idx];
+	int i;
+
+	if (radius < 0) return;
+
+	/* Refresh the cached grids if they may be out of date */
+	if (!ls->grids || !loc_eq(ls->grid, sgrid) || ls->radius != radius ||
+			ls->terrain_changes != c->terrain_changes)
+		find_light_grids(c, ls, sgrid, radius);
+
+	for (i = 0; i < ls->count; i++) {
+		struct loc grid = ls->grids[i].grid;
+		int dist = ls->grids[i].dist;
+
+		if (grid.x < c->light_tl.x || grid.x > c->light_br.x ||
+				grid.y < c->light_tl.y || grid.y > c->light_br.y)
+			continue;
+		/*
+		 * Only light a wall if the face lit is possibly visible
+		 * to the player.
+		 */
+		if (ls->grids[i].wall && !source_can_light_wall(c, p, sgrid,
+				grid)) continue;
+		/* Adjust the light level */
+		if (inten > 0) {
+			/* Light getting less further away */
+			c->squares[grid.y][grid.x].light += inten - dist;
+		} else {
+			/* Light getting greater further away */
+			c->squares[grid.y][grid.x].light += inten + dist;
 		}
 	}
 }
 
 /**
  * Calculate light level for every grid in view - stolen from Sil
+ *
+ * Light is only ever looked at for grids the player can view, so only the
+ * area within z_info->max_sight of the player (plus a border of one grid,
+ * so bright terrain just outside is accounted for) is worked out.  The
+ * area done last time is cleared first so no stale light is left behind.
  */
 static void calc_lighting(struct chunk *c, struct player *p)
 {
@@ -672,17 +885,31 @@ static void calc_lighting(struct chunk *c, struct player *p)
 	int old_light = square_light(c, p->grid);
 	bool sunlit = (c->depth == 0) && is_daytime();
 
+	if (!c->light_sources) {
+		c->light_sources = mem_zalloc(z_info->level_monster_max *
+			sizeof(*c->light_sources));
+	} else {
+		/* Clear the area done last time */
+		for (y = c->light_tl.y; y <= c->light_br.y; y++)
+			for (x = c->light_tl.x; x <= c->light_br.x; x++)
+				c->squares[y][x].light = 0;
+	}
+
+	/* Work out the area to do */
+	c->light_tl.y = MAX(p->grid.y - z_info->max_sight - 1, 0);
+	c->light_tl.x = MAX(p->grid.x - z_info->max_sight - 1, 0);
+	c->light_br.y = MIN(p->grid.y + z_info->max_sight + 1, c->height - 1);
+	c->light_br.x = MIN(p->grid.x + z_info->max_sight + 1, c->width - 1);
+
 	/* Starting values based on permanent light */
-	for (y = 0; y < c->height; y++) {
-		for (x = 0; x < c->width; x++) {
+	for (y = c->light_tl.y; y <= c->light_br.y; y++) {
+		for (x = c->light_tl.x; x <= c->light_br.x; x++) {
 			struct loc grid = loc(x, y);
 
 			if (square_isglow(c, grid) &&
 					(square_allowslos(c, grid) ||
 					glow_can_light_wall(c, p, grid, sunlit))) {
-				c->squares[y][x].light = 1;
-			} else {
-				c->squares[y][x].light = 0;
+				c->squares[y][x].light += 1;
 			}
 
 			/* Squares with bright terrain have intensity 2 */
@@ -690,7 +917,11 @@ static void calc_lighting(struct chunk *c, struct player *p)
 				c->squares[y][x].light += 2;
 				for (dir = 0; dir < 8; dir++) {
 					struct loc adj_grid = loc_sum(grid, ddgrid_ddd[dir]);
-					if (!square_in_bounds(c, adj_grid)) continue;
+					if (adj_grid.x < c->light_tl.x ||
+							adj_grid.x > c->light_br.x ||
+							adj_grid.y < c->light_tl.y ||
+							adj_grid.y > c->light_br.y)
+						continue;
 					/*
 					 * Only brighten a wall if the player
 					 * is in position to view the face
@@ -707,7 +938,7 @@ static void calc_lighting(struct chunk *c, struct player *p)
 	}
 
 	/* Light around the player */
-	add_light(c, p, p->grid, radius, light);
+	add_light(c, p, 0, p->grid, radius, light);
 
 	/* Scan monster list and add monster light or darkness */
 	for (k = 1; k < cave_monster_max(c); k++) {
@@ -731,7 +962,7 @@ static void calc_lighting(struct chunk *c, struct player *p)
 		if (distance(p->grid, mon->grid) - radius > z_info->max_sight)
 			continue;
 
-		add_light(c, p, mon->grid, radius, light);
+		add_light(c, p, k, mon->grid, radius, light);
 	}
 
 	/* Update light level indicator */
@@ -803,6 +1034,7 @@ static void become_viewable(struct chunk *c, struct loc grid, struct player *p,
 
 	/* Add the grid to the view, make seen if it's close enough to the player */
 	sqinfo_on(square(c, grid)->info, SQUARE_VIEW);
+	grid_list_add(&c->view, grid);
 	if (close) {
 		sqinfo_on(square(c, grid)->info, SQUARE_SEEN);
 		sqinfo_on(square(c, grid)->info, SQUARE_CLOSE_PLAYER);
@@ -934,10 +1166,14 @@ static void update_one(struct chunk *c, struct loc grid, struct player *p)
 
 /**
  * Update the player's current view
+ *
+ * Only grids within z_info->max_sight of the player can come into view, so
+ * the line of sight checks are confined to that window, and the seen/unseen
+ * bookkeeping visits only the grids in the new and the previous view.
  */
 void update_view(struct chunk *c, struct player *p)
 {
-	int x, y;
+	int x, y, x1, y1, x2, y2, i;
 
 	if (!c)
 		return;
@@ -950,15 +1186,13 @@ void update_view(struct chunk *c, struct player *p)
 
 	/* Assume we can view the player grid */
 	sqinfo_on(square(c, p->grid)->info, SQUARE_VIEW);
+	grid_list_add(&c->view, p->grid);
 	if (p->state.cur_light > 0 || square_islit(c, p->grid) ||
 		player_has(p, PF_UNLIGHT)) {
 		sqinfo_on(square(c, p->grid)->info, SQUARE_SEEN);
 		sqinfo_on(square(c, p->grid)->info, SQUARE_CLOSE_PLAYER);
 	}
 
-	/* Calculate light levels */
-	calc_lighting(c, p);
-
 	/* Detect metal.
 	 * This is more difficult than detecting moving metal (monsters).
 	 * So you need to be unimpaired (mentally: blindness doesn't matter, as
@@ -977,14 +1211,24 @@ void update_view(struct chunk *c, struct player *p)
 	}
 
 	/* Squares we have LOS to get marked as in the view, and perhaps seen */
-	for (y = 0; y < c->height; y++)
-		for (x = 0; x < c->width; x++)
+	y1 = MAX(p->grid.y - z_info->max_sight, 0);
+	y2 = MIN(p->grid.y + z_info->max_sight, c->height - 1);
+	x1 = MAX(p->grid.x - z_info->max_sight, 0);
+	x2 = MIN(p->grid.x + z_info->max_sight, c->width - 1);
+	for (y = y1; y <= y2; y++)
+		for (x = x1; x <= x2; x++)
 			update_view_one(c, loc(x, y), p);
 
-	/* Update each grid */
-	for (y = 0; y < c->height; y++)
-		for (x = 0; x < c->width; x++)
-			update_one(c, loc(x, y), p);
+	/* Update each grid now in view */
+	for (i = 0; i < c->view.count; i++)
+		update_one(c, c->view.grids[i], p);
+
+	/* Update each grid that has dropped out of view */
+	for (i = 0; i < c->old_view.count; i++) {
+		struct loc grid = c->old_view.grids[i];
+		if (!square_isview(c, grid))
+			update_one(c, grid, p);
+	}
 }
 
 
@@ -32,6 +32,13 @@
 #include "object.h"
 #include "player-timed.h"
 #include "trap.h"
+#include "z-strmap.h"
+
+/**
+ * Monsters are filed by position in buckets of MON_BUCKET_SIZE grids square
+ */
+#define MON_BUCKET_SHIFT	3
+#define MON_BUCKET_SIZE		(1 << MON_BUCKET_SHIFT)
 
 struct feature *f_info;
 struct chunk *cave = NULL;
@@ -331,12 +338,43 @@ struct loc next_grid(struct loc grid, int dir)
 	return loc(grid.x + ddgrid[dir].x, grid.y + ddgrid[dir].y);
 }
 
+/**
+ * Terrain features by name
+ */
+static struct strmap *feat_names;
+
+/**
+ * Index the terrain features by name, once terrain.txt has been read
+ */
+void index_feat_names(void)
+{
+	int i;
+
+	free_feat_names();
+	feat_names = strmap_new(false);
+	for (i = 0; i < z_info->f_max; i++) {
+		if (f_info[i].name)
+			strmap_add(feat_names, f_info[i].name, i);
+	}
+}
+
+void free_feat_names(void)
+{
+	strmap_free(feat_names);
+	feat_names = NULL;
+}
+
 /**
  * Find a terrain feature index by name
  */
 int lookup_feat(const char *name)
 {
-	int i;
+	int i = strmap_get(feat_names, name);
+
+	/* Check the index first */
+	if (i >= 0 && i < z_info->f_max && f_info[i].name &&
+		streq(name, f_info[i].name))
+		return i;
 
 	/* Look for it */
 	for (i = 0; i < z_info->f_max; i++) {
@@ -386,27 +424,152 @@ void set_terrain(void)
 }
 
 /**
- * Allocate a new chunk of the world
+ * Grids of a packed level with objects, traps or an occupant
  */
-struct chunk *cave_new(int height, int width) {
-	int y, x;
+struct packed_square {
+	int grid;			/* y * width + x */
+	struct object *obj;
+	struct trap *trap;
+	int16_t mon;
+};
 
-	struct chunk *c = mem_zalloc(sizeof *c);
-	c->height = height;
-	c->width = width;
-	c->feat_count = mem_zalloc((z_info->f_max + 1) * sizeof(int));
+/**
+ * A stored level squeezed down while the player is elsewhere
+ */
+struct packed_cave {
+	uint8_t *planes;		/* Run-length coded info, feat and tag */
+	size_t planes_size;
+	struct packed_square *squares;
+	int num_squares;
+};
+
+/**
+ * Allocate the grid planes of a chunk.  Each plane is one block, with row
+ * pointers into it so grids can still be addressed as [y][x].
+ */
+static void cave_alloc_planes(struct chunk *c)
+{
+	int y;
 
 	c->squares = mem_zalloc(c->height * sizeof(struct square*));
 	c->noise.grids = mem_zalloc(c->height * sizeof(uint16_t*));
 	c->scent.grids = mem_zalloc(c->height * sizeof(uint16_t*));
-	for (y = 0; y < c->height; y++) {
-		c->squares[y] = mem_zalloc(c->width * sizeof(struct square));
-		for (x = 0; x < c->width; x++) {
-			c->squares[y][x].info = mem_zalloc(SQUARE_SIZE * sizeof(bitflag));
-		}
-		c->noise.grids[y] = mem_zalloc(c->width * sizeof(uint16_t));
-		c->scent.grids[y] = mem_zalloc(c->width * sizeof(uint16_t));
+	c->squares[0] = mem_zalloc(c->height * c->width * sizeof(struct square));
+	c->noise.grids[0] = mem_zalloc(c->height * c->width * sizeof(uint16_t));
+	c->scent.grids[0] = mem_zalloc(c->height * c->width * sizeof(uint16_t));
+	for (y = 1; y < c->height; y++) {
+		c->squares[y] = c->squares[y - 1] + c->width;
+		c->noise.grids[y] = c->noise.grids[y - 1] + c->width;
+		c->scent.grids[y] = c->scent.grids[y - 1] + c->width;
 	}
+}
+
+static void cave_free_planes(struct chunk *c)
+{
+	mem_free(c->squares[0]);
+	mem_free(c->noise.grids[0]);
+	mem_free(c->scent.grids[0]);
+	mem_free(c->squares);
+	mem_free(c->noise.grids);
+	mem_free(c->scent.grids);
+	c->squares = NULL;
+	c->noise.grids = NULL;
+	c->scent.grids = NULL;
+}
+
+/**
+ * Allocate the indexes of the monsters on a level: the buckets they are
+ * filed in by grid, the list of those on damaging terrain, and the wheel
+ * they are scheduled on.
+ */
+static void cave_alloc_monster_index(struct chunk *c)
+{
+	int i;
+
+	c->mon_bucket = mem_zalloc(((c->height + MON_BUCKET_SIZE - 1)
+		>> MON_BUCKET_SHIFT) * ((c->width + MON_BUCKET_SIZE - 1)
+		>> MON_BUCKET_SHIFT) * sizeof(uint16_t));
+	c->mon_next = mem_zalloc(z_info->level_monster_max * sizeof(uint16_t));
+	c->mon_prev = mem_zalloc(z_info->level_monster_max * sizeof(uint16_t));
+	c->mon_filed = mem_alloc(z_info->level_monster_max * sizeof(struct loc));
+	for (i = 0; i < z_info->level_monster_max; i++) {
+		c->mon_filed[i] = loc(-1, -1);
+	}
+	c->mon_hazard = mem_zalloc(z_info->level_monster_max * sizeof(uint16_t));
+	c->mon_hazard_pos = mem_zalloc(z_info->level_monster_max *
+								   sizeof(uint16_t));
+	c->mon_wheel = mem_zalloc(MON_WHEEL_SIZE * sizeof(uint16_t));
+	c->mon_due_next = mem_zalloc(z_info->level_monster_max * sizeof(uint16_t));
+	c->mon_due_prev = mem_zalloc(z_info->level_monster_max * sizeof(uint16_t));
+	c->mon_due = mem_zalloc(z_info->level_monster_max * sizeof(int32_t));
+	c->mon_acting = mem_zalloc(z_info->level_monster_max * sizeof(uint16_t));
+	c->mon_dormant = mem_zalloc(z_info->level_monster_max * sizeof(bool));
+}
+
+static void cave_free_monster_index(struct chunk *c)
+{
+	mem_free(c->mon_bucket);
+	mem_free(c->mon_next);
+	mem_free(c->mon_prev);
+	mem_free(c->mon_filed);
+	mem_free(c->mon_hazard);
+	mem_free(c->mon_hazard_pos);
+	mem_free(c->mon_wheel);
+	mem_free(c->mon_due_next);
+	mem_free(c->mon_due_prev);
+	mem_free(c->mon_due);
+	mem_free(c->mon_acting);
+	mem_free(c->mon_dormant);
+	c->mon_bucket = c->mon_next = c->mon_prev = NULL;
+	c->mon_filed = NULL;
+	c->mon_hazard = c->mon_hazard_pos = NULL;
+	c->mon_hazard_cnt = 0;
+	c->mon_wheel = c->mon_due_next = c->mon_due_prev = NULL;
+	c->mon_due = NULL;
+	c->mon_acting = NULL;
+	c->mon_dormant = NULL;
+	c->mon_dormant_cnt = 0;
+}
+
+/**
+ * Free what is only kept to save work during play, and is rebuilt when it
+ * is next wanted: the view and light lists, the noise and flow fields and
+ * the floor index.
+ */
+static void cave_free_caches(struct chunk *c)
+{
+	int i;
+
+	mem_free(c->view.grids);
+	mem_free(c->old_view.grids);
+	memset(&c->view, 0, sizeof(c->view));
+	memset(&c->old_view, 0, sizeof(c->old_view));
+	c->view_valid = false;
+	if (c->light_sources) {
+		for (i = 0; i < z_info->level_monster_max; i++)
+			mem_free(c->light_sources[i].grids);
+		mem_free(c->light_sources);
+		c->light_sources = NULL;
+	}
+	mem_free(c->noise_reach.grids);
+	memset(&c->noise_reach, 0, sizeof(c->noise_reach));
+	cave_forget_flow(c);
+	mem_free(c->floor_grids);
+	mem_free(c->floor_pos);
+	c->floor_grids = NULL;
+	c->floor_pos = NULL;
+	c->floor_cnt = 0;
+}
+
+/**
+ * Allocate a new chunk of the world
+ */
+struct chunk *cave_new(int height, int width) {
+	struct chunk *c = mem_zalloc(sizeof *c);
+	c->height = height;
+	c->width = width;
+	c->feat_count = mem_zalloc((z_info->f_max + 1) * sizeof(int));
+	cave_alloc_planes(c);
 
 	c->objects = mem_zalloc(OBJECT_LIST_SIZE * sizeof(struct object*));
 	c->obj_max = OBJECT_LIST_SIZE - 1;
@@ -414,6 +577,7 @@ struct chunk *cave_new(int height, int width) {
 	c->monsters = mem_zalloc(z_info->level_monster_max *sizeof(struct monster));
 	c->mon_max = 1;
 	c->mon_current = -1;
+	cave_alloc_monster_index(c);
 
 	c->monster_groups = mem_zalloc(z_info->level_monster_max *
 								   sizeof(struct monster_group*));
@@ -445,6 +609,9 @@ void cave_free(struct chunk *c) {
 
 	cave_connectors_free(c->join);
 
+	/* The objects and traps of a packed level are found on its grids */
+	cave_unpack(c);
+
 	/* Look for orphaned objects and delete them. */
 	for (i = 1; i < c->obj_max; i++) {
 		if (c->objects[i] && loc_is_zero(c->objects[i]->grid)) {
@@ -454,23 +621,18 @@ void cave_free(struct chunk *c) {
 
 	for (y = 0; y < c->height; y++) {
 		for (x = 0; x < c->width; x++) {
-			mem_free(c->squares[y][x].info);
 			if (c->squares[y][x].trap)
 				square_free_trap(c, loc(x, y));
 			if (c->squares[y][x].obj)
 				object_pile_free(c, p_c, c->squares[y][x].obj);
 		}
-		mem_free(c->squares[y]);
-		mem_free(c->noise.grids[y]);
-		mem_free(c->scent.grids[y]);
 	}
-	mem_free(c->squares);
-	mem_free(c->noise.grids);
-	mem_free(c->scent.grids);
-
+	cave_free_planes(c);
+	cave_free_caches(c);
 	mem_free(c->feat_count);
 	mem_free(c->objects);
 	mem_free(c->monsters);
+	cave_free_monster_index(c);
 	mem_free(c->monster_groups);
 	if (c->name)
 		string_free(c->name);
@@ -478,6 +640,153 @@ void cave_free(struct chunk *c) {
 	mem_free(c);
 }
 
+/**
+ * Add one plane of grid bytes, offset bytes into struct square, to a packed
+ * level as (count, byte) runs, the way wr_dungeon_aux() saves them
+ */
+static void pack_plane(struct chunk *c, struct packed_cave *pc, size_t *alloc,
+		size_t offset)
+{
+	const uint8_t *base = (const uint8_t *) c->squares[0] + offset;
+	int n = 0, grids = c->height * c->width;
+
+	while (n < grids) {
+		uint8_t byte = base[n * sizeof(struct square)];
+		int count = 1;
+
+		while (n + count < grids && count < UCHAR_MAX &&
+				base[(n + count) * sizeof(struct square)] == byte) {
+			count++;
+		}
+		if (pc->planes_size + 2 > *alloc) {
+			*alloc *= 2;
+			pc->planes = mem_realloc(pc->planes, *alloc);
+		}
+		pc->planes[pc->planes_size++] = count;
+		pc->planes[pc->planes_size++] = byte;
+		n += count;
+	}
+}
+
+/**
+ * Fill in one plane of grid bytes from the runs at pos in a packed level,
+ * and return where the next plane starts
+ */
+static size_t unpack_plane(struct chunk *c, const struct packed_cave *pc,
+		size_t pos, size_t offset)
+{
+	uint8_t *base = (uint8_t *) c->squares[0] + offset;
+	int n = 0, grids = c->height * c->width;
+
+	while (n < grids) {
+		int count = pc->planes[pos++];
+		uint8_t byte = pc->planes[pos++];
+
+		assert(count > 0 && n + count <= grids);
+		while (count--) {
+			base[n++ * sizeof(struct square)] = byte;
+		}
+	}
+	return pos;
+}
+
+/**
+ * Squeeze a level down to be stored while the player is elsewhere.
+ *
+ * The info, terrain and tag planes are kept run-length coded, and of the
+ * rest of each grid only the objects, traps and occupants there are kept.
+ * The noise and scent planes, the caches and the monster indexes are let
+ * go, as they are when the level is saved, and the monster list is cut
+ * down to the monsters in use.  Nothing may look at the grids or monsters
+ * of a packed level until cave_unpack() has opened it out again.
+ */
+void cave_pack(struct chunk *c)
+{
+	struct packed_cave *pc;
+	size_t alloc = 1024;
+	int i, n, grids = c->height * c->width;
+
+	if (c->packed) return;
+	pc = mem_zalloc(sizeof(*pc));
+
+	/* Planes */
+	pc->planes = mem_alloc(alloc);
+	for (i = 0; i < (int) SQUARE_SIZE; i++) {
+		pack_plane(c, pc, &alloc, offsetof(struct square, info) + i);
+	}
+	pack_plane(c, pc, &alloc, offsetof(struct square, feat));
+	pack_plane(c, pc, &alloc, offsetof(struct square, tag));
+	pc->planes = mem_realloc(pc->planes, pc->planes_size);
+
+	/* Grids with something on them */
+	for (n = 0; n < grids; n++) {
+		const struct square *sq = &c->squares[0][n];
+
+		if (sq->obj || sq->trap || sq->mon) pc->num_squares++;
+	}
+	pc->squares = mem_alloc(pc->num_squares * sizeof(*pc->squares));
+	for (i = 0, n = 0; n < grids; n++) {
+		const struct square *sq = &c->squares[0][n];
+
+		if (!sq->obj && !sq->trap && !sq->mon) continue;
+		pc->squares[i].grid = n;
+		pc->squares[i].obj = sq->obj;
+		pc->squares[i].trap = sq->trap;
+		pc->squares[i].mon = sq->mon;
+		i++;
+	}
+
+	cave_free_planes(c);
+	cave_free_caches(c);
+	cave_free_monster_index(c);
+	c->monsters = mem_realloc(c->monsters,
+		c->mon_max * sizeof(struct monster));
+	c->packed = pc;
+}
+
+/**
+ * Open out a level packed by cave_pack(), ready to be played on
+ */
+void cave_unpack(struct chunk *c)
+{
+	struct packed_cave *pc = c->packed;
+	size_t pos = 0;
+	int i;
+
+	if (!pc) return;
+	c->packed = NULL;
+
+	/* Planes */
+	cave_alloc_planes(c);
+	for (i = 0; i < (int) SQUARE_SIZE; i++) {
+		pos = unpack_plane(c, pc, pos, offsetof(struct square, info) + i);
+	}
+	pos = unpack_plane(c, pc, pos, offsetof(struct square, feat));
+	pos = unpack_plane(c, pc, pos, offsetof(struct square, tag));
+	assert(pos == pc->planes_size);
+
+	/* Monsters, filed again as they are put back */
+	c->monsters = mem_realloc(c->monsters,
+		z_info->level_monster_max * sizeof(struct monster));
+	memset(c->monsters + c->mon_max, 0,
+		(z_info->level_monster_max - c->mon_max) * sizeof(struct monster));
+	cave_alloc_monster_index(c);
+
+	/* Grids with something on them */
+	for (i = 0; i < pc->num_squares; i++) {
+		const struct packed_square *ps = &pc->squares[i];
+		struct loc grid = loc(ps->grid % c->width, ps->grid / c->width);
+
+		c->squares[grid.y][grid.x].obj = ps->obj;
+		c->squares[grid.y][grid.x].trap = ps->trap;
+		square_set_mon(c, grid, ps->mon);
+	}
+
+	mem_free(pc->planes);
+	mem_free(pc->squares);
+	mem_free(pc);
+}
+
 
 /**
  * Enter an object in the list of objects for the current level/chunk.  This
@@ -682,6 +991,221 @@ int cave_monster_count(struct chunk *c) {
 	return c->mon_cnt;
 }
 
+/**
+ * The bucket a grid's monster is filed in.
+ */
+static int mon_bucket_index(struct chunk *c, struct loc grid)
+{
+	int width = (c->width + MON_BUCKET_SIZE - 1) >> MON_BUCKET_SHIFT;
+
+	return (grid.y >> MON_BUCKET_SHIFT) * width + (grid.x >> MON_BUCKET_SHIFT);
+}
+
+/**
+ * Note whether a monster is standing on terrain which hurts it every turn.
+ */
+static void cave_monster_hazard(struct chunk *c, int midx, bool hazard)
+{
+	int pos = c->mon_hazard_pos[midx];
+
+	if (hazard && !pos) {
+		c->mon_hazard[c->mon_hazard_cnt++] = midx;
+		c->mon_hazard_pos[midx] = c->mon_hazard_cnt;
+	} else if (!hazard && pos) {
+		int last = c->mon_hazard[--c->mon_hazard_cnt];
+
+		c->mon_hazard[pos - 1] = last;
+		c->mon_hazard_pos[last] = pos;
+		c->mon_hazard_pos[midx] = 0;
+	}
+}
+
+/**
+ * Take a monster out of its bucket, if it is in one.
+ */
+static void cave_monster_unfile(struct chunk *c, int midx)
+{
+	int prev = c->mon_prev[midx], next = c->mon_next[midx];
+
+	if (c->mon_filed[midx].x < 0) return;
+	cave_monster_hazard(c, midx, false);
+
+	if (prev) {
+		c->mon_next[prev] = next;
+	} else {
+		c->mon_bucket[mon_bucket_index(c, c->mon_filed[midx])] = next;
+	}
+	if (next) c->mon_prev[next] = prev;
+
+	c->mon_next[midx] = 0;
+	c->mon_prev[midx] = 0;
+	c->mon_filed[midx] = loc(-1, -1);
+}
+
+/**
+ * Keep the monster buckets in step with a grid being given occupant midx.
+ *
+ * This is called by square_set_mon() before the grid changes, so whatever
+ * monster is filed at the grid now is leaving it.  A monster being moved
+ * in may still be filed at its old grid (monster_swap() sets both grids one
+ * after the other), so it is taken out of there first.
+ *
+ * square_set_feat() also calls this for the occupant of a grid whose
+ * terrain changes, to keep the list of monsters on damaging terrain right.
+ */
+void cave_monster_file(struct chunk *c, struct loc grid, int midx)
+{
+	int old = c->squares[grid.y][grid.x].mon;
+
+	if (old > 0 && loc_eq(c->mon_filed[old], grid)) {
+		cave_monster_unfile(c, old);
+	}
+
+	if (midx > 0) {
+		int bucket = mon_bucket_index(c, grid), head;
+
+		cave_monster_unfile(c, midx);
+		head = c->mon_bucket[bucket];
+		c->mon_next[midx] = head;
+		if (head) c->mon_prev[head] = midx;
+		c->mon_bucket[bucket] = midx;
+		c->mon_filed[midx] = grid;
+		cave_monster_hazard(c, midx, square_isfiery(c, grid) ||
+			square_isradioactive(c, grid) || square_iswater(c, grid));
+	}
+}
+
+/**
+ * Call visit() on each monster in the rectangle from top_left to
+ * bottom_right, and within radius of centre if radius is not negative,
+ * until it returns true.
+ */
+static struct monster *visit_monster_buckets(struct chunk *c,
+		struct loc top_left, struct loc bottom_right, struct loc centre,
+		int radius, monster_visitor visit, void *data)
+{
+	struct loc bucket;
+
+	top_left.x = MAX(top_left.x, 0);
+	top_left.y = MAX(top_left.y, 0);
+	bottom_right.x = MIN(bottom_right.x, c->width - 1);
+	bottom_right.y = MIN(bottom_right.y, c->height - 1);
+
+	for (bucket.y = top_left.y >> MON_BUCKET_SHIFT;
+		 bucket.y <= bottom_right.y >> MON_BUCKET_SHIFT; bucket.y++) {
+		for (bucket.x = top_left.x >> MON_BUCKET_SHIFT;
+			 bucket.x <= bottom_right.x >> MON_BUCKET_SHIFT; bucket.x++) {
+			int midx = c->mon_bucket[mon_bucket_index(c,
+				loc(bucket.x << MON_BUCKET_SHIFT,
+					bucket.y << MON_BUCKET_SHIFT))];
+
+			while (midx) {
+				struct monster *mon = cave_monster(c, midx);
+				struct loc grid = c->mon_filed[midx];
+
+				midx = c->mon_next[midx];
+				if (grid.x < top_left.x || grid.x > bottom_right.x ||
+					grid.y < top_left.y || grid.y > bottom_right.y)
+					continue;
+				if (radius >= 0 && distance(centre, grid) > radius)
+					continue;
+				if (visit(c, mon, data)) return mon;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Visit the monsters in a rectangle until visit() returns true, and return
+ * the monster it stopped at (or NULL).  visit() must not move or remove
+ * monsters.
+ */
+struct monster *cave_monsters_in_rect(struct chunk *c, struct loc top_left,
+		struct loc bottom_right, monster_visitor visit, void *data)
+{
+	return visit_monster_buckets(c, top_left, bottom_right, loc(0, 0), -1,
+								 visit, data);
+}
+
+/**
+ * Visit the monsters within distance() radius of a grid until visit()
+ * returns true, and return the monster it stopped at (or NULL).  visit()
+ * must not move or remove monsters.
+ */
+struct monster *cave_monsters_in_radius(struct chunk *c, struct loc grid,
+		int radius, monster_visitor visit, void *data)
+{
+	return visit_monster_buckets(c, loc(grid.x - radius, grid.y - radius),
+								 loc(grid.x + radius, grid.y + radius), grid,
+								 radius, visit, data);
+}
+
+/**
+ * Find the monster nearest to a grid (by straight line distance, the lowest
+ * index winning ties) which accept() is true for.
+ *
+ * Buckets are searched in rings outwards from the grid, stopping when no
+ * bucket further out could hold anything nearer than the best so far, and
+ * accept() is only asked about monsters at least as near as that.
+ */
+struct monster *cave_monster_nearest(struct chunk *c, struct loc grid,
+		monster_visitor accept, void *data)
+{
+	struct monster *best = NULL;
+	int best_dist = 0;
+	int width = (c->width + MON_BUCKET_SIZE - 1) >> MON_BUCKET_SHIFT;
+	int height = (c->height + MON_BUCKET_SIZE - 1) >> MON_BUCKET_SHIFT;
+	struct loc centre = loc(grid.x >> MON_BUCKET_SHIFT,
+							grid.y >> MON_BUCKET_SHIFT);
+	int ring, rings = MAX(MAX(centre.x, width - 1 - centre.x),
+						  MAX(centre.y, height - 1 - centre.y));
+
+	for (ring = 0; ring <= rings; ring++) {
+		struct loc bucket;
+
+		/* Everything in this ring is at least this far away on one axis */
+		if (best && ring > 0) {
+			int near = (ring - 1) * MON_BUCKET_SIZE + 1;
+			if (best_dist < near * near) break;
+		}
+
+		for (bucket.y = centre.y - ring; bucket.y <= centre.y + ring;
+			 bucket.y++) {
+			if (bucket.y < 0 || bucket.y >= height) continue;
+			for (bucket.x = centre.x - ring; bucket.x <= centre.x + ring;
+				 bucket.x++) {
+				int midx;
+
+				if (bucket.x < 0 || bucket.x >= width) continue;
+
+				/* Only the edge of the ring is new */
+				if (ABS(bucket.y - centre.y) < ring &&
+					ABS(bucket.x - centre.x) < ring)
+					continue;
+
+				midx = c->mon_bucket[bucket.y * width + bucket.x];
+				while (midx) {
+					struct monster *mon = cave_monster(c, midx);
+					struct loc d = loc_diff(c->mon_filed[midx], grid);
+					int dist = d.x * d.x + d.y * d.y;
+
+					midx = c->mon_next[midx];
+					if (best && (dist > best_dist ||
+						(dist == best_dist && mon->midx > best->midx)))
+						continue;
+					if (!accept(c, mon, data)) continue;
+					best = mon;
+					best_dist = dist;
+				}
+			}
+		}
+	}
+
+	return best;
+}
+
 /**
  * Return the number of matching grids around (or under) the character.
  * \param grid If not NULL, *grid is set to the location of the last match.
@@ -768,3 +1292,81 @@ struct loc cave_find_decoy(struct chunk *c)
 {
 	return c->decoy;
 }
+
+/**
+ * Keep the index of floor grids in step with a change to a grid's terrain.
+ *
+ * The index is only made when something first searches the floor of a
+ * level (see cave_floor_grids()); until then there is nothing to do.
+ */
+void cave_note_floor(struct chunk *c, struct loc grid)
+{
+	int n, pos;
+
+	if (!c->floor_pos) return;
+	n = grid.y * c->width + grid.x;
+	pos = c->floor_pos[n];
+	if (square_isfloor(c, grid) && !pos) {
+		c->floor_grids[c->floor_cnt++] = n;
+		c->floor_pos[n] = c->floor_cnt;
+	} else if (!square_isfloor(c, grid) && pos) {
+		int last = c->floor_grids[--c->floor_cnt];
+
+		c->floor_grids[pos - 1] = last;
+		c->floor_pos[last] = pos;
+		c->floor_pos[n] = 0;
+	}
+}
+
+/**
+ * Make the index of floor grids if there isn't one yet.
+ * \return the number of floor grids on the level
+ */
+int cave_floor_grids(struct chunk *c)
+{
+	struct loc grid;
+
+	if (c->floor_pos) return c->floor_cnt;
+	c->floor_grids = mem_alloc(c->height * c->width * sizeof(int));
+	c->floor_pos = mem_zalloc(c->height * c->width * sizeof(int));
+	c->floor_cnt = 0;
+	for (grid.y = 0; grid.y < c->height; grid.y++) {
+		for (grid.x = 0; grid.x < c->width; grid.x++) {
+			cave_note_floor(c, grid);
+		}
+	}
+	return c->floor_cnt;
+}
+
+/**
+ * Locate a floor grid which satisfies the given predicate, with every such
+ * grid equally likely.
+ * \param c is the current chunk
+ * \param grid is the grid found
+ * \param pred is what the grid must satisfy, as well as being floor
+ * \return success
+ *
+ * The floor grids are shuffled in place only as far as the first one which
+ * passes, so the cost is in the grids tried rather than the size of the level.
+ * pred must not change the terrain.
+ */
+bool cave_find_floor(struct chunk *c, struct loc *grid,
+		bool (*pred)(struct chunk *c, struct loc grid))
+{
+	int n = cave_floor_grids(c);
+	int i;
+
+	for (i = 0; i < n; i++) {
+		int j = randint0(n - i) + i;
+		int k = c->floor_grids[j];
+
+		c->floor_grids[j] = c->floor_grids[i];
+		c->floor_grids[i] = k;
+		c->floor_pos[c->floor_grids[j]] = j + 1;
+		c->floor_pos[k] = i + 1;
+
+		*grid = loc(k % c->width, k / c->width);
+		if (pred(c, *grid)) return true;
+	}
+	return false;
+}
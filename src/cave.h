@@ -164,17 +164,90 @@ struct grid_data {
 struct square {
 	struct object *obj;
 	struct trap *trap;
-	bitflag *info;
 	int light;
 	int16_t mon;
 	uint8_t feat;
 	uint8_t tag;
+	bitflag info[SQUARE_SIZE];
 };
 
 struct heatmap {
 	uint16_t **grids;
 };
 
+/**
+ * A growable list of grids
+ */
+struct grid_list {
+	struct loc *grids;
+	int count;
+	int size;
+};
+
+/**
+ * A grid within reach of a light source
+ */
+struct light_grid {
+	struct loc grid;
+	int dist;
+	bool wall;
+};
+
+/**
+ * The grids a light source reaches, kept until the source moves, its radius
+ * changes or the terrain changes
+ */
+struct light_source {
+	struct loc grid;
+	int radius;
+	uint32_t terrain_changes;
+	struct light_grid *grids;
+	int count;
+	int size;
+};
+
+/**
+ * Kinds of mover a flow field can be worked out for
+ */
+enum {
+	FLOW_WALK,		/* Open ground and doors, but not damaging terrain */
+	FLOW_ANY_TERRAIN,	/* Open ground and doors, damaging or not */
+	FLOW_WALLS,		/* Anything but permanent walls */
+	FLOW_MAX
+};
+
+/**
+ * Number of flow fields kept for a level, and the most steps from its
+ * target that a flow field reaches
+ */
+#define FLOW_FIELDS	8
+#define FLOW_DEPTH	60
+
+/**
+ * Steps to a target, plus one, from each grid within FLOW_DEPTH steps that
+ * a mover of the given kind could get there from; 0 for other grids.  It is
+ * kept for any monsters heading for the same target until the terrain
+ * changes or the slot is wanted for another target.
+ */
+struct flow_field {
+	struct loc target;
+	int kind;
+	uint32_t terrain_changes;
+	uint32_t last_used;
+	struct heatmap steps;
+	struct grid_list reach;		/* Grids given steps, nearest first */
+};
+
+/**
+ * Number of game turns ahead the monster scheduling wheel covers
+ */
+#define MON_WHEEL_SIZE	128
+
+/**
+ * The compact form of a stored level, while nobody is on it (see cave_pack())
+ */
+struct packed_cave;
+
 struct connector {
 	struct loc grid;
 	uint8_t feat;
@@ -203,6 +276,24 @@ struct chunk {
 	struct heatmap scent;
 	struct loc decoy;
 
+	struct grid_list view;		/* Grids marked in view by update_view() */
+	struct grid_list old_view;	/* Scratch list for the previous view */
+	bool view_valid;		/* Whether view lists all the view flags */
+
+	uint32_t terrain_changes;	/* Count of terrain changes on the level */
+	struct light_source *light_sources; /* Light cache, player first */
+	struct loc light_tl;		/* Top left of the area with valid light */
+	struct loc light_br;		/* Bottom right of that area */
+
+	struct grid_list noise_reach;	/* Grids given noise, quietest first */
+	struct loc noise_origin;	/* Grid the noise was last made from */
+	int noise_step;			/* Noise added for each step from there */
+	int noise_limit;		/* Loudest noise value propagated */
+	uint32_t noise_terrain;		/* terrain_changes when the noise was made */
+	uint16_t scent_clock;		/* Player turns of scent laid on the level */
+	struct flow_field *flows;	/* Flow fields toward monster targets */
+	uint32_t flow_uses;
+
 	struct object **objects;
 	uint16_t obj_max;
 
@@ -210,11 +301,37 @@ struct chunk {
 	uint16_t mon_max;
 	uint16_t mon_cnt;
 	int mon_current;
+	uint16_t *mon_bucket;		/* First monster filed in each bucket */
+	uint16_t *mon_next;		/* Next monster in the same bucket */
+	uint16_t *mon_prev;		/* Previous monster in the same bucket */
+	struct loc *mon_filed;		/* Grid each monster is filed under */
+	uint16_t *mon_hazard;		/* Monsters standing on damaging terrain */
+	uint16_t *mon_hazard_pos;	/* Place in mon_hazard of each monster, +1 */
+	uint16_t mon_hazard_cnt;
+	uint16_t *mon_wheel;		/* First monster due on each wheel turn */
+	uint16_t *mon_due_next;		/* Next monster due on the same wheel turn */
+	uint16_t *mon_due_prev;		/* Previous monster on the same wheel turn */
+	int32_t *mon_due;		/* Game turn each monster can next act */
+	uint16_t *mon_acting;		/* Scratch list for process_monsters() */
+	int32_t mon_clock;		/* First game turn monsters have not all had */
+	bool *mon_dormant;		/* Monsters left off the wheel while out of reach */
+	uint16_t mon_dormant_cnt;
+	int mon_dormant_hearing;	/* Keenest hearing of any dormant monster */
+	int mon_dormant_wall_hearing;	/* ... and of any that passes walls */
+	struct loc mon_dormant_grid;	/* Player grid and stealth when dormant */
+	int mon_dormant_stealth;	/* monsters were last checked */
 	int num_repro;
 
+	int *floor_grids;		/* Floor grids, as y * width + x */
+	int *floor_pos;			/* Place in floor_grids of each grid, +1 */
+	int floor_cnt;
+
 	struct monster_group **monster_groups;
 
 	struct connector *join;
+
+	struct packed_cave *packed;	/* Compact form while stored, or NULL */
+	char *spill;			/* Side file while stored, or NULL */
 };
 
 /*** Feature Indexes (see "lib/gamedata/terrain.txt") ***/
@@ -267,6 +384,7 @@ extern uint16_t chunk_list_max;
 
 /* cave-view.c */
 int distance(struct loc grid1, struct loc grid2);
+bool los_flag(struct chunk *c, struct loc grid1, struct loc grid2, unsigned flag);
 bool los(struct chunk *c, struct loc grid1, struct loc grid2);
 void update_view(struct chunk *c, struct player *p);
 bool no_light(struct player *p);
@@ -280,7 +398,8 @@ void wiz_light(struct chunk *c, struct player *p, bool full);
 void wiz_dark(struct chunk *c, struct player *p, bool full);
 void cave_illuminate(struct chunk *c, bool daytime);
 void expose_to_sun(struct chunk *c, struct loc grid, bool daytime);
-void cave_update_flow(struct chunk *c);
+const struct flow_field *cave_flow_field(struct chunk *c, struct loc target,
+		int kind);
 void cave_forget_flow(struct chunk *c);
 
 /* cave-square.c */
@@ -314,7 +433,6 @@ bool feat_is_no_scent(int feat);
 bool feat_is_smooth(int feat);
 
 /* SQUARE FEATURE PREDICATES */
-bool square_hasflag(struct chunk *c, struct loc grid, unsigned flag);
 bool square_isfloor(struct chunk *c, struct loc grid);
 bool square_istrappable(struct chunk *c, struct loc grid);
 bool square_isobjectholding(struct chunk *c, struct loc grid);
@@ -342,12 +460,8 @@ bool square_isnotknown(struct chunk *c, struct loc grid);
 
 /* SQUARE INFO PREDICATES */
 bool square_ismark(struct chunk *c, struct loc grid);
-bool square_isglow(struct chunk *c, struct loc grid);
 bool square_isvault(struct chunk *c, struct loc grid);
 bool square_isroom(struct chunk *c, struct loc grid);
-bool square_isseen(struct chunk *c, struct loc grid);
-bool square_isview(struct chunk *c, struct loc grid);
-bool square_wasseen(struct chunk *c, struct loc grid);
 bool square_isfeel(struct chunk *c, struct loc grid);
 bool square_istrap(struct chunk *c, struct loc grid);
 bool square_isinvis(struct chunk *c, struct loc grid);
@@ -370,9 +484,6 @@ bool square_canputitem(struct chunk *c, struct loc grid);
 bool square_isdiggable(struct chunk *c, struct loc grid);
 bool square_iswebbable(struct chunk *c, struct loc grid);
 bool square_is_monster_walkable(struct chunk *c, struct loc grid);
-bool square_ispassable(struct chunk *c, struct loc grid);
-bool square_isprojectable(struct chunk *c, struct loc grid);
-bool square_allowslos(struct chunk *c, struct loc grid);
 bool square_isstrongwall(struct chunk *c, struct loc grid);
 bool square_isbright(struct chunk *c, struct loc grid);
 bool square_isfiery(struct chunk *c, struct loc grid);
@@ -395,18 +506,14 @@ bool square_isdisabledtrap(struct chunk *c, struct loc grid);
 bool square_isdisarmabletrap(struct chunk *c, struct loc grid);
 bool square_dtrap_edge(struct chunk *c, struct loc grid);
 bool square_changeable(struct chunk *c, struct loc grid);
-bool square_in_bounds(struct chunk *c, struct loc grid);
-bool square_in_bounds_fully(struct chunk *c, struct loc grid);
 bool square_isbelievedwall(struct chunk *c, struct loc grid);
 bool square_suits_stairs_well(struct chunk *c, struct loc grid);
 bool square_suits_stairs_ok(struct chunk *c, struct loc grid);
 bool square_allows_summon(struct chunk *c, struct loc grid);
 
 
-const struct square *square(struct chunk *c, struct loc grid);
 struct feature *square_feat(struct chunk *c, struct loc grid);
 uint8_t square_tag(struct chunk *c, struct loc grid);
-int square_light(struct chunk *c, struct loc grid);
 struct monster *square_monster(struct chunk *c, struct loc grid);
 struct object *square_object(struct chunk *c, struct loc grid);
 struct trap *square_trap(struct chunk *c, struct loc grid);
@@ -420,6 +527,126 @@ int square_num_walls_adjacent(struct chunk *c, struct loc grid);
 int square_num_walls_diagonal(struct chunk *c, struct loc grid);
 
 
+/**
+ * Accessors and predicates used in the inner loops of view, light, flow and
+ * projection code, defined here so they can be inlined.  The square storage
+ * of a chunk is one contiguous block (see cave_new()), so these are simple
+ * index calculations.
+ */
+#define square_info_has(sq, flag) \
+	(((sq)->info[FLAG_OFFSET(flag)] & FLAG_BINARY(flag)) != 0)
+#define feat_has_flag(feat, flag) \
+	((f_info[feat].flags[FLAG_OFFSET(flag)] & FLAG_BINARY(flag)) != 0)
+
+static inline bool square_in_bounds(struct chunk *c, struct loc grid)
+{
+	assert(c);
+	return grid.x >= 0 && grid.x < c->width &&
+		grid.y >= 0 && grid.y < c->height;
+}
+
+static inline bool square_in_bounds_fully(struct chunk *c, struct loc grid)
+{
+	assert(c);
+	return grid.x > 0 && grid.x < c->width - 1 &&
+		grid.y > 0 && grid.y < c->height - 1;
+}
+
+static inline struct square *square(struct chunk *c, struct loc grid)
+{
+	assert(square_in_bounds(c, grid));
+	return &c->squares[grid.y][grid.x];
+}
+
+/**
+ * True if the square's terrain has the given terrain flag; false for grids
+ * outside the chunk.
+ */
+static inline bool square_hasflag(struct chunk *c, struct loc grid,
+		unsigned flag)
+{
+	if (!square_in_bounds(c, grid)) return false;
+	return feat_has_flag(square(c, grid)->feat, flag);
+}
+
+/**
+ * True if the square is lit
+ */
+static inline bool square_isglow(struct chunk *c, struct loc grid)
+{
+	return square_info_has(square(c, grid), SQUARE_GLOW);
+}
+
+/**
+ * True if the square has been seen by the player
+ */
+static inline bool square_isseen(struct chunk *c, struct loc grid)
+{
+	return square_info_has(square(c, grid), SQUARE_SEEN);
+}
+
+/**
+ * True if the cave square is currently viewable by the player
+ */
+static inline bool square_isview(struct chunk *c, struct loc grid)
+{
+	return square_info_has(square(c, grid), SQUARE_VIEW);
+}
+
+/**
+ * True if the cave square was seen before the current update
+ */
+static inline bool square_wasseen(struct chunk *c, struct loc grid)
+{
+	return square_info_has(square(c, grid), SQUARE_WASSEEN);
+}
+
+/**
+ * True if the square is passable by the player.
+ */
+static inline bool square_ispassable(struct chunk *c, struct loc grid)
+{
+	return feat_has_flag(square(c, grid)->feat, TF_PASSABLE);
+}
+
+/**
+ * True if any projectable can pass through the square.
+ */
+static inline bool square_isprojectable(struct chunk *c, struct loc grid)
+{
+	if (!square_in_bounds(c, grid)) return false;
+	return feat_has_flag(square(c, grid)->feat, TF_PROJECT);
+}
+
+/**
+ * True if the square allows line-of-sight.
+ */
+static inline bool square_allowslos(struct chunk *c, struct loc grid)
+{
+	return feat_has_flag(square(c, grid)->feat, TF_LOS);
+}
+
+/**
+ * Get the light level of a square
+ */
+static inline int square_light(struct chunk *c, struct loc grid)
+{
+	return square(c, grid)->light;
+}
+
+/**
+ * Get the age of the player's scent on a square, or 0 if there is none
+ *
+ * Scent is stored as the reading of the chunk's scent clock at which it
+ * would have been laid with strength 2, so it ages without being touched.
+ */
+static inline int square_scent(struct chunk *c, struct loc grid)
+{
+	int laid = c->scent.grids[grid.y][grid.x];
+	return laid ? c->scent_clock + 2 - laid : 0;
+}
+
+
 /* Feature placers */
 void square_set_feat(struct chunk *c, struct loc grid, int feat);
 void square_set_mon(struct chunk *c, struct loc grid, int midx);
@@ -466,11 +693,15 @@ void square_unmark(struct chunk *c, struct loc grid);
 /* cave.c */
 int motion_dir(struct loc source, struct loc target);
 struct loc next_grid(struct loc grid, int dir);
+void index_feat_names(void);
+void free_feat_names(void);
 int lookup_feat(const char *name);
 void set_terrain(void);
 struct chunk *cave_new(int height, int width);
 void cave_connectors_free(struct connector *join);
 void cave_free(struct chunk *c);
+void cave_pack(struct chunk *c);
+void cave_unpack(struct chunk *c);
 void list_object(struct chunk *c, struct object *obj);
 void delist_object(struct chunk *c, struct object *obj);
 void object_lists_check_integrity(struct chunk *c, struct chunk *c_k);
@@ -483,11 +714,29 @@ struct monster *cave_monster(struct chunk *c, int idx);
 int cave_monster_max(struct chunk *c);
 int cave_monster_count(struct chunk *c);
 
+/**
+ * monster_visitor is called on each monster found by a neighbourhood query;
+ * returning true stops the query at that monster.
+ */
+typedef bool (*monster_visitor)(struct chunk *c, struct monster *mon,
+								void *data);
+void cave_monster_file(struct chunk *c, struct loc grid, int midx);
+struct monster *cave_monsters_in_rect(struct chunk *c, struct loc top_left,
+		struct loc bottom_right, monster_visitor visit, void *data);
+struct monster *cave_monsters_in_radius(struct chunk *c, struct loc grid,
+		int radius, monster_visitor visit, void *data);
+struct monster *cave_monster_nearest(struct chunk *c, struct loc grid,
+		monster_visitor accept, void *data);
+
 int count_feats(struct loc *grid,
 				bool (*test)(struct chunk *c, struct loc grid), bool under);
 int count_neighbors(struct loc *match, struct chunk *c, struct loc grid,
 	bool (*test)(struct chunk *c, struct loc grid), bool under);
 struct loc cave_find_decoy(struct chunk *c);
+void cave_note_floor(struct chunk *c, struct loc grid);
+int cave_floor_grids(struct chunk *c);
+bool cave_find_floor(struct chunk *c, struct loc *grid,
+	bool (*pred)(struct chunk *c, struct loc grid));
 
 void cave_known(struct player *p);
 
@@ -0,0 +1,6 @@
+MACRO(CONFIGURE_GENBENCH_FRONTEND _NAME_TARGET)
+
+    TARGET_COMPILE_DEFINITIONS(${_NAME_TARGET} PRIVATE -D USE_GENBENCH)
+    MESSAGE(STATUS "Support for generation benchmark front end - Ready")
+
+ENDMACRO()
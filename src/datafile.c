@@ -20,10 +20,12 @@
  */
 
 #include "angband.h"
+#include "buildid.h"
 #include "datafile.h"
 #include "game-world.h"
 #include "init.h"
 #include "parser.h"
+#include "z-strmap.h"
 
 /**
  * Hold a prefix to distinguish files from different users when the archive
@@ -51,9 +53,297 @@ static void print_error(struct file_parser *fp, struct parser *p) {
 	quit_fmt("Parse error in %s line %d column %d: %s: %s.", fp->name, s.line, s.col, s.msg, parser_error_str[s.error]);
 }
 
+/**
+ * Find the data file of the given name, the player's customised one in the
+ * user directory if there is one
+ */
+static ang_file *open_data_file(const char *filename)
+{
+	char path[1024];
+	ang_file *fh;
+
+	/* The player can put a customised file in the user directory */
+	path_build(path, sizeof(path), ANGBAND_DIR_USER, format("%s.txt",
+															filename));
+	fh = file_open(path, MODE_READ, FTYPE_TEXT);
+
+	/* If no custom file, just load the standard one */
+	if (!fh) {
+		path_build(path, sizeof(path), ANGBAND_DIR_GAMEDATA,
+				   format("%s.txt", filename));
+		fh = file_open(path, MODE_READ, FTYPE_TEXT);
+	}
+
+	return fh;
+}
+
+/**
+ * ------------------------------------------------------------------------
+ * Compiled caches of data files
+ *
+ * A parser with cache hooks has what it parsed written out to the cache
+ * directory, with a key made from the text of its data file, the game
+ * constants, the names of the flags it writes as bits and the version of
+ * the game and of the cache.  While the key matches, the cache is read
+ * instead of the data file being parsed.
+ * ------------------------------------------------------------------------ */
+
+#define DATA_CACHE_MAGIC	"xdc1"
+
+/**
+ * Fold the text of a data file into a hash
+ */
+static bool hash_data_file(const char *filename, uint32_t *hash)
+{
+	ang_file *fh = open_data_file(filename);
+	char buf[4096];
+	int len, i;
+
+	if (!fh) return false;
+	while ((len = file_read(fh, buf, sizeof(buf))) > 0) {
+		for (i = 0; i < len; i++) {
+			*hash = (*hash ^ (uint8_t) buf[i]) * 16777619;
+		}
+	}
+	file_close(fh);
+	return len == 0;
+}
+
+/**
+ * Make the key for the cache of a parser, or 0 if there can't be one
+ */
+static uint32_t data_cache_key(const struct file_parser *fp)
+{
+	uint32_t key = 2166136261u;
+	const char **flag;
+	const char *c;
+
+	for (c = buildver; *c; c++) {
+		key = (key ^ (uint8_t) *c) * 16777619;
+	}
+	key = (key ^ fp->cache_version) * 16777619;
+
+	/* Flag bits mean nothing once the names, or their order, change */
+	for (flag = fp->cache_flags; flag && *flag; flag++) {
+		for (c = *flag; *c; c++) {
+			key = (key ^ (uint8_t) *c) * 16777619;
+		}
+		key *= 16777619;
+	}
+	if (!hash_data_file("constants", &key) ||
+			!hash_data_file(fp->name, &key)) {
+		return 0;
+	}
+	return key ? key : 1;
+}
+
+static void data_cache_path(char *buf, size_t len, const struct file_parser *fp)
+{
+	char dir[1024];
+
+	path_build(dir, sizeof(dir), ANGBAND_DIR_USER, "cache");
+	path_build(buf, len, dir, format("%s.dat", fp->name));
+}
+
+/**
+ * Set up what a parser parses from its cache, if the cache is up to date
+ */
+static bool data_cache_load(struct file_parser *fp, uint32_t key)
+{
+	char path[1024];
+	uint8_t head[12];
+	struct data_cache dc = { NULL, 0, 0, 0, false };
+	ang_file *fh;
+	bool loaded = false;
+
+	data_cache_path(path, sizeof(path), fp);
+	fh = file_open(path, MODE_READ, FTYPE_RAW);
+	if (!fh) return false;
+
+	/* The magic, then the key and the size of what follows */
+	if (file_read(fh, (char *) head, sizeof(head)) == sizeof(head) &&
+			!memcmp(head, DATA_CACHE_MAGIC, 4)) {
+		dc.data = head + 4;
+		dc.size = 8;
+		if (cache_get_u32(&dc) == key) {
+			dc.size = cache_get_u32(&dc);
+			dc.data = mem_alloc(MAX(dc.size, 1));
+			dc.pos = 0;
+			loaded = file_read(fh, (char *) dc.data, dc.size) ==
+				(int) dc.size;
+		} else {
+			dc.data = NULL;
+		}
+	}
+	file_close(fh);
+
+	if (loaded) {
+		loaded = fp->cache_read(&dc) && !dc.failed && dc.pos == dc.size;
+
+		/* Throw away whatever was half set up */
+		if (!loaded) fp->cleanup();
+	}
+	mem_free(dc.data);
+	return loaded;
+}
+
+/**
+ * Write out the cache of a parser that has just parsed its data file; the
+ * cache is only there to save time, so failing to write it doesn't matter
+ */
+static void data_cache_save(struct file_parser *fp, uint32_t key)
+{
+	char path[1024], dir[1024], tmp[1024];
+	struct data_cache dc = { NULL, 0, 0, 0, false };
+	ang_file *fh;
+	uint32_t size;
+	bool written;
+
+	path_build(dir, sizeof(dir), ANGBAND_DIR_USER, "cache");
+	if (!dir_create(dir)) return;
+	data_cache_path(path, sizeof(path), fp);
+
+	cache_put_byte(&dc, DATA_CACHE_MAGIC[0]);
+	cache_put_byte(&dc, DATA_CACHE_MAGIC[1]);
+	cache_put_byte(&dc, DATA_CACHE_MAGIC[2]);
+	cache_put_byte(&dc, DATA_CACHE_MAGIC[3]);
+	cache_put_u32(&dc, key);
+	cache_put_u32(&dc, 0);
+	fp->cache_write(&dc);
+
+	/* Fill in the size now it is known */
+	size = (uint32_t) (dc.size - 12);
+	dc.data[8] = size & 0xFF;
+	dc.data[9] = (size >> 8) & 0xFF;
+	dc.data[10] = (size >> 16) & 0xFF;
+	dc.data[11] = (size >> 24) & 0xFF;
+
+	/* Write it under another name and move it into place, so that a
+	 * game starting meanwhile never reads half of it */
+#ifdef UNIX
+	strnfmt(tmp, sizeof(tmp), "%s.%ld", path, (long) getpid());
+#else
+	strnfmt(tmp, sizeof(tmp), "%s.new", path);
+#endif
+	fh = file_open(tmp, MODE_WRITE, FTYPE_RAW);
+	if (fh) {
+		written = file_write(fh, (const char *) dc.data, dc.size);
+		if (!file_close(fh)) written = false;
+		if (!written || !file_move(tmp, path)) file_delete(tmp);
+	}
+	mem_free(dc.data);
+}
+
+void cache_put_byte(struct data_cache *dc, uint8_t v)
+{
+	if (dc->size == dc->alloc) {
+		dc->alloc = dc->alloc ? dc->alloc * 2 : 1024;
+		dc->data = mem_realloc(dc->data, dc->alloc);
+	}
+	dc->data[dc->size++] = v;
+}
+
+void cache_put_u32(struct data_cache *dc, uint32_t v)
+{
+	cache_put_byte(dc, v & 0xFF);
+	cache_put_byte(dc, (v >> 8) & 0xFF);
+	cache_put_byte(dc, (v >> 16) & 0xFF);
+	cache_put_byte(dc, (v >> 24) & 0xFF);
+}
+
+void cache_put_flags(struct data_cache *dc, const bitflag *flags, size_t size)
+{
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		cache_put_byte(dc, flags[i]);
+	}
+}
+
+/**
+ * Put a string, which may be NULL, into a cache
+ */
+void cache_put_string(struct data_cache *dc, const char *str)
+{
+	if (str) {
+		size_t len = strlen(str);
+
+		cache_put_u32(dc, (uint32_t) len + 1);
+		while (len--) {
+			cache_put_byte(dc, (uint8_t) *str++);
+		}
+	} else {
+		cache_put_u32(dc, 0);
+	}
+}
+
+uint8_t cache_get_byte(struct data_cache *dc)
+{
+	if (dc->pos >= dc->size) {
+		dc->failed = true;
+		return 0;
+	}
+	return dc->data[dc->pos++];
+}
+
+uint32_t cache_get_u32(struct data_cache *dc)
+{
+	uint32_t v = cache_get_byte(dc);
+
+	v |= (uint32_t) cache_get_byte(dc) << 8;
+	v |= (uint32_t) cache_get_byte(dc) << 16;
+	v |= (uint32_t) cache_get_byte(dc) << 24;
+	return v;
+}
+
+void cache_get_flags(struct data_cache *dc, bitflag *flags, size_t size)
+{
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		flags[i] = cache_get_byte(dc);
+	}
+}
+
+/**
+ * Get a string, or NULL, back from a cache; the caller frees it
+ */
+char *cache_get_string(struct data_cache *dc)
+{
+	uint32_t len = cache_get_u32(dc);
+	char *str;
+
+	if (!len) return NULL;
+	if (len - 1 > dc->size - dc->pos) {
+		dc->failed = true;
+		return NULL;
+	}
+	str = mem_alloc(len);
+	memcpy(str, dc->data + dc->pos, len - 1);
+	str[len - 1] = '\0';
+	dc->pos += len - 1;
+	return str;
+}
+
+/**
+ * ------------------------------------------------------------------------
+ * Running parsers
+ * ------------------------------------------------------------------------ */
+
 errr run_parser(struct file_parser *fp) {
-	struct parser *p = fp->init();
+	struct parser *p;
+	uint32_t key = 0;
 	errr r;
+
+	/* Read the compiled cache instead, if it is up to date */
+	if (fp->cache_read) {
+		key = data_cache_key(fp);
+		if (key && data_cache_load(fp, key)) {
+			return 0;
+		}
+	}
+
+	p = fp->init();
 	if (!p) {
 		return PARSE_ERROR_GENERIC;
 	}
@@ -63,8 +353,11 @@ errr run_parser(struct file_parser *fp) {
 		return r;
 	}
 	r = fp->finish(p);
-	if (r)
+	if (r) {
 		print_error(fp, p);
+	} else if (key) {
+		data_cache_save(fp, key);
+	}
 	return r;
 }
 
@@ -85,34 +378,75 @@ errr parse_file_quit_not_found(struct parser *p, const char *filename) {
  * The basic file parsing function.
  */
 errr parse_file(struct parser *p, const char *filename) {
-	char path[1024];
-	char buf[1024];
-	ang_file *fh;
+	ang_file *fh = open_data_file(filename);
+	char *text, *line, *end, *tabbed = NULL;
+	size_t size = 0, alloc = 65536, tabbed_size = 0;
+	int len;
 	errr r = 0;
 
-	/* The player can put a customised file in the user directory */
-	path_build(path, sizeof(path), ANGBAND_DIR_USER, format("%s.txt",
-															filename));
-	fh = file_open(path, MODE_READ, FTYPE_TEXT);
-
-	/* If no custom file, just load the standard one */
-	if (!fh) {
-		path_build(path, sizeof(path), ANGBAND_DIR_GAMEDATA,
-				   format("%s.txt", filename));
-		fh = file_open(path, MODE_READ, FTYPE_TEXT);
-	}
-
 	/* File wasn't found, return the error */
 	if (!fh)
 		return PARSE_ERROR_NO_FILE_FOUND;
 
-	/* Parse it */
-	while (file_getl(fh, buf, sizeof(buf))) {
-		r = parser_parse(p, buf);
+	/* Read it all in, to be split into lines where it lies */
+	text = mem_alloc(alloc);
+	while ((len = file_read(fh, text + size, alloc - size - 1)) > 0) {
+		size += len;
+		if (alloc - size - 1 == 0) {
+			alloc *= 2;
+			text = mem_realloc(text, alloc);
+		}
+	}
+	file_close(fh);
+	text[size] = '\0';
+	end = text + size;
+
+	/* Parse it, a line at a time; lines end with \n, \r\n or \r */
+	for (line = text; line < end; ) {
+		char *next = line;
+		bool has_tab = false;
+
+		while (next < end && *next != '\n' && *next != '\r') {
+			if (*next == '\t') has_tab = true;
+			next++;
+		}
+		if (next < end) {
+			if (*next == '\r' && next + 1 < end && next[1] == '\n')
+				*next++ = '\0';
+			*next++ = '\0';
+		}
+
+		/* Tabs are spaced out to the next stop, as by file_getl() */
+		if (has_tab) {
+			size_t i = 0, need = strlen(line) * TAB_COLUMNS + 1;
+			char *c;
+
+			if (need > tabbed_size) {
+				tabbed_size = need;
+				tabbed = mem_realloc(tabbed, tabbed_size);
+			}
+			for (c = line; *c; c++) {
+				if (*c == '\t') {
+					size_t tabstop = ((i + TAB_COLUMNS) / TAB_COLUMNS)
+						* TAB_COLUMNS;
+					while (i < tabstop)
+						tabbed[i++] = ' ';
+				} else {
+					tabbed[i++] = *c;
+				}
+			}
+			tabbed[i] = '\0';
+			r = parser_parse_line(p, tabbed);
+		} else {
+			r = parser_parse_line(p, line);
+		}
 		if (r)
 			break;
+		line = next;
 	}
-	file_close(fh);
+
+	mem_free(tabbed);
+	mem_free(text);
 	return r;
 }
 
@@ -121,8 +455,62 @@ void cleanup_parser(struct file_parser *fp)
 	fp->cleanup();
 }
 
+/**
+ * Flag tables that have been looked up in, each with its names indexed
+ */
+#define MAX_FLAG_INDEXES 32
+
+static struct {
+	const char **table;
+	struct strmap *names;
+} flag_indexes[MAX_FLAG_INDEXES];
+
+/**
+ * Find the index of a flag table, making it the first time the table is seen;
+ * returns NULL if there is no room for another.
+ */
+static struct strmap *flag_index(const char **flag_table)
+{
+	int n, i;
+
+	for (n = 0; n < MAX_FLAG_INDEXES && flag_indexes[n].table; n++) {
+		if (flag_indexes[n].table == flag_table)
+			return flag_indexes[n].names;
+	}
+	if (n == MAX_FLAG_INDEXES) return NULL;
+
+	flag_indexes[n].table = flag_table;
+	flag_indexes[n].names = strmap_new(false);
+	for (i = FLAG_START; flag_table[i]; i++) {
+		strmap_add(flag_indexes[n].names, flag_table[i], i);
+	}
+	return flag_indexes[n].names;
+}
+
+void cleanup_flag_indexes(void)
+{
+	int n;
+
+	for (n = 0; n < MAX_FLAG_INDEXES && flag_indexes[n].table; n++) {
+		strmap_free(flag_indexes[n].names);
+		flag_indexes[n].names = NULL;
+		flag_indexes[n].table = NULL;
+	}
+}
+
 int lookup_flag(const char **flag_table, const char *flag_name) {
-	int i = FLAG_START;
+	struct strmap *names = flag_index(flag_table);
+	int i;
+
+	if (names) {
+		i = strmap_get(names, flag_name);
+
+		/* Check the index against the table */
+		if (i < 0) return FLAG_END;
+		if (flag_table[i] && streq(flag_table[i], flag_name)) return i;
+	}
+
+	i = FLAG_START;
 
 	while (flag_table[i] && !streq(flag_table[i], flag_name))
 		i++;
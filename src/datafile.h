@@ -22,12 +22,37 @@
 #include "object.h"
 #include "parser.h"
 
+/**
+ * A compiled form of what was parsed from a data file, as it is written out
+ * or read back in
+ */
+struct data_cache {
+	uint8_t *data;
+	size_t size;
+	size_t alloc;
+	size_t pos;
+	bool failed;
+};
+
 struct file_parser {
 	const char *name;
 	struct parser *(*init)(void);
 	errr (*run)(struct parser *p);
 	errr (*finish)(struct parser *p);
 	void (*cleanup)(void);
+
+	/**
+	 * Optional compiled cache, for a parser named for its data file:
+	 * cache_write() puts what finish() left into the cache, and
+	 * cache_read() sets it all up again from the cache instead of
+	 * parsing.  cache_version changes whenever what is written does.
+	 * cache_flags, if not NULL, is the NULL-terminated table of names of
+	 * any flags written as bits, so the cache goes stale if it changes.
+	 */
+	uint32_t cache_version;
+	void (*cache_write)(struct data_cache *dc);
+	bool (*cache_read)(struct data_cache *dc);
+	const char **cache_flags;
 };
 
 extern const char *parser_error_str[PARSE_ERROR_MAX];
@@ -36,7 +61,16 @@ errr run_parser(struct file_parser *fp);
 errr parse_file_quit_not_found(struct parser *p, const char *filename);
 errr parse_file(struct parser *p, const char *filename);
 void cleanup_parser(struct file_parser *fp);
+void cache_put_byte(struct data_cache *dc, uint8_t v);
+void cache_put_u32(struct data_cache *dc, uint32_t v);
+void cache_put_flags(struct data_cache *dc, const bitflag *flags, size_t size);
+void cache_put_string(struct data_cache *dc, const char *str);
+uint8_t cache_get_byte(struct data_cache *dc);
+uint32_t cache_get_u32(struct data_cache *dc);
+void cache_get_flags(struct data_cache *dc, bitflag *flags, size_t size);
+char *cache_get_string(struct data_cache *dc);
 int lookup_flag(const char **flag_table, const char *flag_name);
+void cleanup_flag_indexes(void);
 int code_index_in_array(const char *code_name[], const char *code);
 errr grab_rand_value(random_value *value, const char **value_type,
 					 const char *name_and_value);
@@ -2046,68 +2046,63 @@ bool effect_handler_DETECT_OBJECTS(effect_handler_context_t *context)
 }
 
 /**
- * Detect monsters which satisfy the given predicate around the player.
- * The height to detect above and below the player is y_dist,
- * the width either side of the player x_dist.
+ * Context for detect_monsters()
  */
-static bool detect_monsters(int y_dist, int x_dist, monster_predicate pred)
-{
-	int i, x, y;
-	int x1, x2, y1, y2;
-
-	bool monsters = false;
-
-	/* Set the detection area */
-	y1 = player->grid.y - y_dist;
-	y2 = player->grid.y + y_dist;
-	x1 = player->grid.x - x_dist;
-	x2 = player->grid.x + x_dist;
-
-	if (y1 < 0) y1 = 0;
-	if (x1 < 0) x1 = 0;
-	if (y2 > cave->height - 1) y2 = cave->height - 1;
-	if (x2 > cave->width - 1) x2 = cave->width - 1;
+struct detect_monsters_context {
+	monster_predicate pred;
+	bool monsters;
+};
 
-	/* Scan monsters */
-	for (i = 1; i < cave_monster_max(cave); i++) {
-		struct monster *mon = cave_monster(cave, i);
+/**
+ * Detect one monster for detect_monsters(), if it is appropriate.
+ */
+static bool detect_monster_visit(struct chunk *c, struct monster *mon,
+								 void *data)
+{
+	struct detect_monsters_context *detect = data;
 
-		/* Skip dead monsters */
-		if (!mon->race) continue;
+	/* Detect all appropriate, obvious monsters */
+	if (detect->pred(mon) && !monster_is_camouflaged(mon)) {
+		/* Detect the monster */
+		mflag_on(mon->mflag, MFLAG_MARK);
+		mflag_on(mon->mflag, MFLAG_SHOW);
 
-		/* Location */
-		y = mon->grid.y;
-		x = mon->grid.x;
+		/* Note invisible monsters */
+		if (monster_is_invisible(mon)) {
+			struct monster_lore *lore = get_lore(mon->race);
+			rf_on(lore->flags, RF_INVISIBLE);
+		}
 
-		/* Only detect nearby monsters */
-		if (x < x1 || y < y1 || x > x2 || y > y2) continue;
+		/* Update monster recall window */
+		if (player->upkeep->monster_race == mon->race)
+			/* Redraw stuff */
+			player->upkeep->redraw |= (PR_MONSTER);
 
-		/* Detect all appropriate, obvious monsters */
-		if (pred(mon) && !monster_is_camouflaged(mon)) {
-			/* Detect the monster */
-			mflag_on(mon->mflag, MFLAG_MARK);
-			mflag_on(mon->mflag, MFLAG_SHOW);
+		/* Update the monster */
+		update_mon(mon, c, false);
 
-			/* Note invisible monsters */
-			if (monster_is_invisible(mon)) {
-				struct monster_lore *lore = get_lore(mon->race);
-				rf_on(lore->flags, RF_INVISIBLE);
-			}
+		/* Detect */
+		detect->monsters = true;
+	}
 
-			/* Update monster recall window */
-			if (player->upkeep->monster_race == mon->race)
-				/* Redraw stuff */
-				player->upkeep->redraw |= (PR_MONSTER);
+	return false;
+}
 
-			/* Update the monster */
-			update_mon(mon, cave, false);
+/**
+ * Detect monsters which satisfy the given predicate around the player.
+ * The height to detect above and below the player is y_dist,
+ * the width either side of the player x_dist.
+ */
+static bool detect_monsters(int y_dist, int x_dist, monster_predicate pred)
+{
+	struct detect_monsters_context detect = { pred, false };
 
-			/* Detect */
-			monsters = true;
-		}
-	}
+	/* Scan nearby monsters */
+	cave_monsters_in_rect(cave, loc_diff(player->grid, loc(x_dist, y_dist)),
+		loc_sum(player->grid, loc(x_dist, y_dist)), detect_monster_visit,
+		&detect);
 
-	return monsters;
+	return detect.monsters;
 }
 
 /**
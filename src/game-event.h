@@ -94,11 +94,14 @@ typedef enum game_event_type
 	/* Events for introspection into dungeon generation */
 	EVENT_GEN_LEVEL_START, /* has string in event data for profile name */
 	EVENT_GEN_LEVEL_END, /* has flag in event data indicating success */
+	EVENT_GEN_LEVEL_RETRY, /* has string in event data with the reason */
 	EVENT_GEN_ROOM_START, /* has string in event data for room type */
 	EVENT_GEN_ROOM_CHOOSE_SIZE, /* has size in event data */
 	EVENT_GEN_ROOM_CHOOSE_SUBTYPE, /* has string in event data with name */
 	EVENT_GEN_ROOM_END, /* has flag in event data indicating success */
 	EVENT_GEN_TUNNEL_FINISHED, /* has tunnel in event data with results */
+	EVENT_GEN_TUNNELING_START, /* no event data; rooms are being joined */
+	EVENT_GEN_TUNNELING_END, /* no event data */
 
 	EVENT_END  /* Can be sent at the end of a series of events */
 } game_event_type;
@@ -39,6 +39,7 @@
 #include "player-quest.h"
 #include "player-timed.h"
 #include "player-util.h"
+#include "savefile.h"
 #include "source.h"
 #include "store.h"
 #include "target.h"
@@ -46,7 +47,6 @@
 #include "ui-game.h"
 #include "ui-term.h"
 #include "world.h"
-#include "z-queue.h"
 
 #include <math.h>
 
@@ -467,6 +467,31 @@ static void decrease_timeouts(void)
 }
 
 
+/**
+ * Find the loudest noise value any monster on the level could make use of.
+ *
+ * Monsters can hear noise below their hearing less a third of the player's
+ * stealth, and sleeping monsters are disturbed by any noise below 50 (see
+ * process_monster_timed()).  One further step is allowed so that a monster
+ * at the edge of its hearing still sees the grids around it correctly.
+ */
+static int noise_limit(struct chunk *c, struct player *p, int noise_increment)
+{
+	int limit = 50;
+	int i;
+
+	for (i = 1; i < cave_monster_max(c); i++) {
+		struct monster *mon = cave_monster(c, i);
+		int hearing;
+
+		if (!mon->race) continue;
+		hearing = mon->race->hearing - p->state.skills[SKILL_STEALTH] / 3;
+		limit = MAX(limit, hearing);
+	}
+
+	return limit + noise_increment;
+}
+
 /**
  * Every turn, the character makes enough noise that nearby monsters can use
  * it to home in.
@@ -482,38 +507,54 @@ static void decrease_timeouts(void)
  * values, thereby homing in on the player even though twisty tunnels and
  * mazes.  Monsters have a hearing value, which is the largest sound value
  * they can detect.
+ *
+ * Noise is only propagated as far as any monster on the level could hear it;
+ * grids beyond that are left silent, as are grids the noise can't reach.
+ * The only readers that look at noise out of earshot are the distance check
+ * in get_move_find_safety() and the scoring in get_move_flee(), for monsters
+ * fleeing from terrain or by scent; get_move_find_hiding() reads no noise.
+ * The grids given noise are remembered in the order they were reached, which
+ * serves both as the queue for the propagation and as the list of grids to
+ * silence next time.  If the player hasn't moved and nothing that affects
+ * the noise has changed, the previous noise is still correct and is kept.
  */
 static void make_noise(struct player *p)
 {
-	struct loc next = p->grid;
-	int y, x, d;
-	int noise = 0;
+	struct grid_list *reach = &cave->noise_reach;
 	int noise_increment = p->timed[TMD_COVERTRACKS] ? 4 : 1;
-    struct queue *queue = q_new(cave->height * cave->width);
+	int limit = noise_limit(cave, p, noise_increment);
+	int head, d;
+
+	/* Nothing has changed since the noise was last made */
+	if (reach->grids && loc_eq(cave->noise_origin, p->grid) &&
+		cave->noise_step == noise_increment &&
+		cave->noise_terrain == cave->terrain_changes &&
+		cave->noise_limit >= limit) {
+		return;
+	}
 
-	/* Set all the grids to silence */
-	for (y = 1; y < cave->height - 1; y++) {
-		for (x = 1; x < cave->width - 1; x++) {
-			cave->noise.grids[y][x] = 0;
-		}
+	/* Set the grids which had noise to silence */
+	if (!reach->grids) {
+		reach->size = cave->height * cave->width;
+		reach->grids = mem_zalloc(reach->size * sizeof(struct loc));
+	}
+	for (head = 0; head < reach->count; head++) {
+		struct loc grid = reach->grids[head];
+		cave->noise.grids[grid.y][grid.x] = 0;
 	}
 
 	/* Player makes noise */
-	cave->noise.grids[next.y][next.x] = noise;
-	q_push_int(queue, grid_to_i(next, cave->width));
-	noise += noise_increment;
+	cave->noise.grids[p->grid.y][p->grid.x] = 0;
+	reach->grids[0] = p->grid;
+	reach->count = 1;
 
 	/* Propagate noise */
-	while (q_len(queue) > 0) {
-		/* Get the next grid */
-		i_to_grid(q_pop_int(queue), cave->width, &next);
-
-		/* If we've reached the current noise level, put it back and step */
-		if (cave->noise.grids[next.y][next.x] == noise) {
-			q_push_int(queue, grid_to_i(next, cave->width));
-			noise += noise_increment;
-			continue;
-		}
+	for (head = 0; head < reach->count; head++) {
+		struct loc next = reach->grids[head];
+		int noise = cave->noise.grids[next.y][next.x] + noise_increment;
+
+		/* Grids are reached in order of noise, so all the rest are too far */
+		if (noise > limit) break;
 
 		/* Assign noise to the children and enqueue them */
 		for (d = 0; d < 8; d++)	{
@@ -535,11 +576,14 @@ static void make_noise(struct player *p)
 			cave->noise.grids[grid.y][grid.x] = noise;
 
 			/* Enqueue that entry */
-			q_push_int(queue, grid_to_i(grid, cave->width));
+			reach->grids[reach->count++] = grid;
 		}
 	}
 
-	q_free(queue);
+	cave->noise_origin = p->grid;
+	cave->noise_step = noise_increment;
+	cave->noise_limit = limit;
+	cave->noise_terrain = cave->terrain_changes;
 }
 
 /**
@@ -555,8 +599,13 @@ static void make_noise(struct player *p)
  * value which indicates the oldest scent they can detect.  Grids where the
  * player has never been will have scent 0.  The player's grid will also have
  * scent 0, but this is OK as no monster will ever be smelling it.
+ *
+ * Ageing is done by advancing the level's scent clock, which square_scent()
+ * measures the age against, so only the grids around the player are written.
+ * Just before the clock runs out the stored scent is rebased, and any scent
+ * older than half the clock's range is kept at that age.
  */
-static void update_scent(void)
+void update_scent(struct chunk *c, struct player *p)
 {
 	int y, x;
 	static const uint8_t scent_strength[5][5] = {
@@ -567,17 +616,25 @@ static void update_scent(void)
 		{2, 2, 2, 2, 2},
 	};
 
-	/* Update scent for all grids */
-	for (y = 1; y < cave->height - 1; y++) {
-		for (x = 1; x < cave->width - 1; x++) {
-			if (cave->scent.grids[y][x] > 0) {
-				cave->scent.grids[y][x]++;
+	/* Rebase the scent before the clock overflows */
+	if (c->scent_clock >= 0xFFFF - 2) {
+		uint16_t clock = 0x8000;
+		for (y = 0; y < c->height; y++) {
+			for (x = 0; x < c->width; x++) {
+				int age = square_scent(c, loc(x, y));
+				if (!age) continue;
+				age = MIN(age, clock + 1);
+				c->scent.grids[y][x] = clock + 2 - age;
 			}
 		}
+		c->scent_clock = clock;
 	}
 
+	/* Age the scent for all grids */
+	c->scent_clock++;
+
 	/* Scentless player */
-	if (player->timed[TMD_COVERTRACKS]) return;
+	if (p->timed[TMD_COVERTRACKS]) return;
 
 	/* Lay down new scent around the player */
 	for (y = 0; y < 5; y++) {
@@ -588,18 +645,18 @@ static void update_scent(void)
 			bool add_scent = false;
 
 			/* Initialize */
-			scent.y = y + player->grid.y - 2;
-			scent.x = x + player->grid.x - 2;
+			scent.y = y + p->grid.y - 2;
+			scent.x = x + p->grid.x - 2;
 
 			/* Ignore invalid or non-scent-carrying grids */
-			if (!square_in_bounds(cave, scent)) continue;
-			if (square_isnoscent(cave, scent)) continue;
+			if (!square_in_bounds(c, scent)) continue;
+			if (square_isnoscent(c, scent)) continue;
 
 			/* Check scent is spreading on floors, not going through walls */
 			for (d = 0; d < 8; d++)	{
 				struct loc adj = loc_sum(scent, ddgrid_ddd[d]);
 
-				if (!square_in_bounds(cave, adj)) {
+				if (!square_in_bounds(c, adj)) {
 					continue;
 				}
 
@@ -609,7 +666,7 @@ static void update_scent(void)
 				}
 
 				/* Adjacent to a closer grid, so valid */
-				if (cave->scent.grids[adj.y][adj.x] == new_scent - 1) {
+				if (square_scent(c, adj) == new_scent - 1) {
 					add_scent = true;
 				}
 			}
@@ -620,7 +677,12 @@ static void update_scent(void)
 			}
 
 			/* Mark the scent */
-			cave->scent.grids[scent.y][scent.x] = new_scent;
+			c->scent.grids[scent.y][scent.x] = new_scent ?
+				c->scent_clock + 2 - new_scent : 0;
+
+			/* Bring back a dormant monster which may now smell it */
+			if (square(c, scent)->mon > 0)
+				monster_promote(c, square_monster(c, scent));
 		}
 	}
 }
@@ -980,7 +1042,7 @@ void process_world(struct chunk *c)
 	/* Update noise and scent (not if resting) */
 	if (!player_is_resting(player)) {
 		make_noise(player);
-		update_scent();
+		update_scent(cave, player);
 	}
 
 
@@ -1341,6 +1403,9 @@ void on_new_level(void)
 	/* Handle timed danger */
 	increase_danger_level();
 
+	/* Start the monsters' clocks */
+	schedule_monsters(cave);
+
 
 	/* Arena levels are not really a level change */
 	if (!player->upkeep->arena_level) {
@@ -1407,6 +1472,9 @@ void on_new_level(void)
  * Housekeeping on leaving a level
  */
 static void on_leave_level(void) {
+	/* Monsters get no energy while the level is left */
+	settle_monsters(cave);
+
 	/* Cancel any command */
 	player_clear_timed(player, TMD_COMMAND, false);
 
@@ -1494,6 +1562,8 @@ void run_game_loop(void)
 
 			/* Process the world every ten turns */
 			if (!(turn % 10) && !player->upkeep->generate_level) {
+				bool saved;
+
 				process_world(cave);
 
 				/* Refresh */
@@ -1503,6 +1573,10 @@ void run_game_loop(void)
 				if (player->is_dead || !player->upkeep->playing)
 					return;
 
+				/* Hear how the last autosave went */
+				if (savefile_save_finished(false, &saved) && !saved)
+					msg("Autosave failed!");
+
 				/* Autosave - timed */
 				if (turn >= player->autosave_turn) {
 					if (player->opts.autosave_delay) {
@@ -1515,7 +1589,7 @@ void run_game_loop(void)
 
 				/* If autosave is pending, do it now. */
 				if (player->upkeep->autosave) {
-					if (!save_game_checked(true))
+					if (!autosave_game())
 						msg("Timed autosave failed!");
 					player->upkeep->autosave = false;
 				}
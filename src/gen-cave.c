@@ -128,6 +128,7 @@ static bool square_is_granite_with_flag(struct chunk *c, struct loc grid,
 /**
  * Places a streamer of rock through dungeon.
  *
+ * \param dun is the current generation data
  * \param c is the current chunk
  * \param feat is the base feature (FEAT_MAGMA or FEAT_QUARTZ)
  * \param chance is the number of regular features per one gold
@@ -137,7 +138,8 @@ static bool square_is_granite_with_flag(struct chunk *c, struct loc grid,
  * with hidden gold, and one with known gold. The hidden gold types are
  * currently unused.
  */
-static void build_streamer(struct chunk *c, int feat, int chance)
+static void build_streamer(struct dun_data *dun, struct chunk *c, int feat,
+		int chance)
 {
 	/* Hack -- Choose starting point */
 	struct loc grid = rand_loc(loc(c->width / 2, c->height / 2), 15, 10);
@@ -177,10 +179,11 @@ static void build_streamer(struct chunk *c, int feat, int chance)
 
 
 /**
- * Reset entrance data for rooms in global dun.
+ * Reset entrance data for rooms in the generation data.
+ * \param dun Is the current generation data
  * \param c Is the chunk holding the rooms.
  */
-static void reset_entrance_data(const struct chunk *c)
+static void reset_entrance_data(struct dun_data *dun, const struct chunk *c)
 {
 	int i;
 
@@ -210,6 +213,7 @@ static void reset_entrance_data(const struct chunk *c)
 
 /**
  * Randomly choose a room entrance and return its coordinates.
+ * \param dun Is the current generation data
  * \param c Is the chunk to use.
  * \param ridx Is the 0-based index for the room.
  * \param tgt If not NULL, the choice of entrance will either be *tgt if *tgt
@@ -230,7 +234,8 @@ static void reset_entrance_data(const struct chunk *c)
  * 3) For all m between zero and nexc - 1, ABS(x.x - exc[m].x) > 1 or
  * ABS(x.y - exc[m].y) > 1 or (x.x == exc[m].x and x.y == exc[m].y).
  */
-static struct loc choose_random_entrance(struct chunk *c, int ridx,
+static struct loc choose_random_entrance(struct dun_data *dun, struct chunk *c,
+		int ridx,
 	const struct loc *tgt, int bias, const struct loc *exc, int nexc)
 {
 	assert(ridx >= 0 && ridx < dun->cent_n);
@@ -328,10 +333,12 @@ static struct loc choose_random_entrance(struct chunk *c, int ridx,
 
 /**
  * Help build_tunnel():  pierce an outer wall and prevent nearby piercings.
+ * \param dun Is the current generation data
  * \param c Is the chunk to use.
  * \param grid Is the location to pierce.
  */
-static void pierce_outer_wall(struct chunk *c, struct loc grid)
+static void pierce_outer_wall(struct dun_data *dun, struct chunk *c,
+		struct loc grid)
 {
 	struct loc adj;
 
@@ -358,6 +365,7 @@ static void pierce_outer_wall(struct chunk *c, struct loc grid)
 /**
  * Help build_tunnel():  handle bookkeeping, mainly if there's a diagonal step,
  * for the first step after piercing a wall.
+ * \param dun Is the current generation data
  * \param c Is the chunk to use.
  * \param grid At entry, *grid is the location at which the wall was pierced.
  * At exit, *grid is the starting point for the next iteration of tunnel
@@ -372,7 +380,8 @@ static void pierce_outer_wall(struct chunk *c, struct loc grid)
  * of tunnel iterations to wait before applying a bend.  At exit, *bend_intvl
  * is what that intverval should be for the next iteration of tunnel building.
  */
-static void handle_post_wall_step(struct chunk *c, struct loc *grid,
+static void handle_post_wall_step(struct dun_data *dun, struct chunk *c,
+		struct loc *grid,
 	struct loc *dir, bool *door_flag, int *bend_intvl)
 {
 	if (dir->x != 0 && dir->y != 0) {
@@ -505,6 +514,7 @@ static bool allows_wall_piercing_door(struct chunk *c, struct loc grid)
 /**
  * Constructs a tunnel between two points
  *
+ * \param dun is the current generation data
  * \param c is the current chunk
  * \param grid1 is the location of the first point
  * \param grid2 is the location of the second point
@@ -522,7 +532,8 @@ static bool allows_wall_piercing_door(struct chunk *c, struct loc grid)
  * The solid wall check prevents silly door placement and excessively wide
  * room entrances.
  */
-static void build_tunnel(struct chunk *c, struct loc grid1, struct loc grid2)
+static void build_tunnel(struct dun_data *dun, struct chunk *c,
+		struct loc grid1, struct loc grid2)
 {
 	int i;
 	int dstart = ABS(grid1.x - grid2.x) + ABS(grid1.y - grid2.y);
@@ -594,7 +605,7 @@ static void build_tunnel(struct chunk *c, struct loc grid1, struct loc grid2)
 			/* If it's the goal, accept and pierce the wall. */
 			if (nxtdir.x == 0 && nxtdir.y == 0) {
 				grid1 = tmp_grid;
-				pierce_outer_wall(c, grid1);
+				pierce_outer_wall(dun, c, grid1);
 				continue;
 			}
 			/*
@@ -629,7 +640,7 @@ static void build_tunnel(struct chunk *c, struct loc grid1, struct loc grid2)
 					 * the wall.
 					 */
 					grid1 = tmp_grid;
-					pierce_outer_wall(c, grid1);
+					pierce_outer_wall(dun, c, grid1);
 				} else {
 					/*
 					 * The tunnel is coming from outside the
@@ -660,8 +671,8 @@ static void build_tunnel(struct chunk *c, struct loc grid1, struct loc grid2)
 							break;
 						}
 						chk = choose_random_entrance(
-							c, iroom, &grid2, bias,
-							exc, 2);
+							dun, c, iroom, &grid2,
+							bias, exc, 2);
 						if (chk.x == 0 && chk.y == 0) {
 							/* No exits at all. */
 							ntry = mtry;
@@ -688,17 +699,17 @@ static void build_tunnel(struct chunk *c, struct loc grid1, struct loc grid2)
 					 * Pierce the wall at the original
 					 * entrance.
 					 */
-					pierce_outer_wall(c, tmp_grid);
+					pierce_outer_wall(dun, c, tmp_grid);
 					/*
 					 * And at the exit which is also the
 					 * continuation point for the rest of
 					 * the tunnel.
 					 */
-					pierce_outer_wall(c, chk);
+					pierce_outer_wall(dun, c, chk);
 					grid1 = chk;
 				}
 				offset = nxtdir;
-				handle_post_wall_step(c, &grid1, &offset,
+				handle_post_wall_step(dun, c, &grid1, &offset,
 					&door_flag, &bend_intvl);
 				continue;
 			}
@@ -714,9 +725,10 @@ static void build_tunnel(struct chunk *c, struct loc grid1, struct loc grid2)
 
 			/* Accept the location and pierce the wall. */
 			grid1 = tmp_grid;
-			pierce_outer_wall(c, grid1);
+			pierce_outer_wall(dun, c, grid1);
 			offset = nxtdir;
-			handle_post_wall_step(c, &grid1, &offset, &door_flag,
+			handle_post_wall_step(dun, c, &grid1, &offset,
+				&door_flag,
 				&bend_intvl);
 		} else if (square_isroom(c, tmp_grid)) {
 			/* Travel quickly through rooms */
@@ -868,11 +880,12 @@ static bool possible_doorway(struct chunk *c, struct loc grid)
 
 /**
  * Places door or trap at y, x position if at least 2 walls found
+ * \param dun is the current generation data
  * \param c is the current chunk
  * \param y are the co-ordinates
  * \param x are the co-ordinates
  */
-static void try_door(struct chunk *c, struct loc grid)
+static void try_door(struct dun_data *dun, struct chunk *c, struct loc grid)
 {
 	assert(square_in_bounds(c, grid));
 
@@ -890,14 +903,17 @@ static void try_door(struct chunk *c, struct loc grid)
 
 /**
  * Connect the rooms with tunnels in the traditional fashion.
+ * \param dun Is the current generation data
  * \param c Is the chunk to use.
  */
-static void do_traditional_tunneling(struct chunk *c)
+static void do_traditional_tunneling(struct dun_data *dun, struct chunk *c)
 {
 	int *scrambled = mem_alloc(dun->cent_n * sizeof(*scrambled));
 	int i;
 	struct loc grid;
 
+	event_signal(EVENT_GEN_TUNNELING_START);
+
 	/*
 	 * Scramble the order in which the rooms will be connected.  Use
 	 * indirect indexing so dun->ent2room can be left as it is.
@@ -924,20 +940,22 @@ static void do_traditional_tunneling(struct chunk *c)
 	 * typical screen width away, don't particularly care which entrance is
 	 * selected.
 	 */
-	grid = choose_random_entrance(c, scrambled[dun->cent_n - 1], NULL, 80,
+	grid = choose_random_entrance(dun, c, scrambled[dun->cent_n - 1], NULL,
+		80,
 		NULL, 0);
 	if (grid.x == 0 && grid.y == 0) {
 		/* Use the room's center. */
 		grid = dun->cent[scrambled[dun->cent_n - 1]];
 	}
 	for (i = 0; i < dun->cent_n; ++i) {
-		struct loc next_grid = choose_random_entrance(c, scrambled[i],
+		struct loc next_grid = choose_random_entrance(dun, c,
+			scrambled[i],
 			&grid, 80, NULL, 0);
 
 		if (next_grid.x == 0 && next_grid.y == 0) {
 			next_grid = dun->cent[scrambled[i]];
 		}
-		build_tunnel(c, next_grid, grid);
+		build_tunnel(dun, c, next_grid, grid);
 
 		/* Remember the "previous" room. */
 		grid = next_grid;
@@ -948,18 +966,21 @@ static void do_traditional_tunneling(struct chunk *c)
 	/* Place intersection doors. */
 	for (i = 0; i < dun->door_n; ++i) {
 		/* Try placing doors. */
-		try_door(c, next_grid(dun->door[i], DIR_W));
-		try_door(c, next_grid(dun->door[i], DIR_E));
-		try_door(c, next_grid(dun->door[i], DIR_N));
-		try_door(c, next_grid(dun->door[i], DIR_S));
+		try_door(dun, c, next_grid(dun->door[i], DIR_W));
+		try_door(dun, c, next_grid(dun->door[i], DIR_E));
+		try_door(dun, c, next_grid(dun->door[i], DIR_N));
+		try_door(dun, c, next_grid(dun->door[i], DIR_S));
 	}
+
+	event_signal(EVENT_GEN_TUNNELING_END);
 }
 
 
 /**
  * Build the staircase rooms for a persistent level.
  */
-static void build_staircase_rooms(struct chunk *c, const char *label)
+static void build_staircase_rooms(struct dun_data *dun, struct chunk *c,
+		const char *label)
 {
 	int num_rooms = dun->profile->n_room_profiles;
 	struct room_profile profile = { 0 };
@@ -975,7 +996,7 @@ static void build_staircase_rooms(struct chunk *c, const char *label)
 	assert(i < num_rooms);
 	for (join = dun->join; join; join = join->next) {
 		dun->curr_join = join;
-		if (!room_build(c, (join->grid.y - 1) / dun->block_hgt,
+		if (!room_build(dun, c, (join->grid.y - 1) / dun->block_hgt,
 				(join->grid.x - 1) / dun->block_wid,
 				profile, true)) {
 			dump_level_simple(NULL, format("%s:  Failed to Build "
@@ -994,8 +1015,8 @@ static void build_staircase_rooms(struct chunk *c, const char *label)
  * Add stairs to a level, taking into account the special treatment needed
  * for persistent levels.
  */
-static void handle_level_stairs(struct chunk *c, bool persistent, bool quest,
-		int down_count, int up_count)
+static void handle_level_stairs(struct dun_data *dun, struct chunk *c,
+		bool persistent, bool quest, int down_count, int up_count)
 {
 	/*
 	 * For persistent levels, require that the stairs be at least four
@@ -1170,10 +1191,12 @@ static struct connector *transform_join_list(const struct connector *join,
 
 /**
  * Generate a new dungeon level.
+ * \param dun is the current generation data
  * \param p is the player 
  * \return a pointer to the generated chunk
  */
-struct chunk *classic_gen(struct player *p, int min_height, int min_width)
+struct chunk *classic_gen(struct dun_data *dun, struct player *p,
+		int min_height, int min_width)
 {
     int i, j, k;
     int by, bx = 0, tby, tbx, key, rarity, built;
@@ -1227,11 +1250,11 @@ struct chunk *classic_gen(struct player *p, int min_height, int min_width)
 	/* No rooms yet, pits or otherwise. */
 	dun->pit_num = 0;
 	dun->cent_n = 0;
-	reset_entrance_data(c);
+	reset_entrance_data(dun, c);
 
 	/* Build the special staircase rooms */
 	if (dun->persist) {
-		build_staircase_rooms(c, "Classic Generation");
+		build_staircase_rooms(dun, c, "Classic Generation");
 	}
 
 	/* Build some rooms.  Note that the theoretical maximum number of rooms
@@ -1289,7 +1312,7 @@ struct chunk *classic_gen(struct player *p, int min_height, int min_width)
 			if (profile.rarity > rarity) continue;
 			if (profile.cutoff <= key) continue;
 			
-			if (room_build(c, by, bx, profile, false)) {
+			if (room_build(dun, c, by, bx, profile, false)) {
 				built++;
 				break;
 			}
@@ -1308,19 +1331,19 @@ struct chunk *classic_gen(struct player *p, int min_height, int min_width)
 		FEAT_PERM, SQUARE_NONE, true);
 
 	/* Connect all the rooms together */
-	do_traditional_tunneling(c);
+	do_traditional_tunneling(dun, c);
 	ensure_connectedness(c, true);
 
 	/* Add some magma streamers */
 	for (i = 0; i < dun->profile->str.mag; i++)
-		build_streamer(c, FEAT_MAGMA, dun->profile->str.mc);
+		build_streamer(dun, c, FEAT_MAGMA, dun->profile->str.mc);
 
 	/* Add some quartz streamers */
 	for (i = 0; i < dun->profile->str.qua; i++)
-		build_streamer(c, FEAT_QUARTZ, dun->profile->str.qc);
+		build_streamer(dun, c, FEAT_QUARTZ, dun->profile->str.qc);
 
 	/* Place 3 or 4 down stairs and 1 or 2 up stairs near some walls */
-	handle_level_stairs(c, dun->persist, dun->quest,
+	handle_level_stairs(dun, c, dun->persist, dun->quest,
 		rand_range(3, 4), rand_range(1, 2));
 
 	/* General amount of rubble, traps and monsters */
@@ -1540,13 +1563,15 @@ static struct chunk *labyrinth_chunk(int depth, int h, int w, bool lit, bool sof
 
 /**
  * Build a labyrinth level.
+ * \param dun is the current generation data
  * \param p is the player
  * Note that if the function returns false, a level wasn't generated.
  * Labyrinths use the dungeon level's number to determine whether to generate
  * themselves (which means certain level numbers are more likely to generate
  * labyrinths than others).
  */
-struct chunk *labyrinth_gen(struct player *p, int min_height, int min_width) {
+struct chunk *labyrinth_gen(struct dun_data *dun, struct player *p,
+		int min_height, int min_width) {
 	int i, k;
 	struct chunk *c;
 	struct loc grid;
@@ -1713,46 +1738,154 @@ static void init_cavern(struct chunk *c, int density,
 	}
 }
 
+/**
+ * Number of 64-bit words needed to hold one row of a bitboard
+ */
+#define CAVE_BITS_WORDS(w) (((w) + 63) / 64)
+
+/**
+ * Index of the lowest set bit in a non-zero word
+ */
+static int lowest_bit(uint64_t word)
+{
+	static const int index[64] = {
+		 0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+		62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+		63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+		46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6
+	};
+
+	/* De Bruijn multiplication of the isolated bit */
+	return index[((word & -word) * UINT64_C(0x03f79d71b4cb0a89)) >> 58];
+}
+
+/**
+ * Find the next bit in a bitboard row which is set (or clear).
+ * \param row is the row
+ * \param w is the width of the row in bits
+ * \param from is where to start looking
+ * \param set is whether we are looking for a set bit or a clear one
+ * \return the index of the bit found, or w if there is none
+ */
+static int next_bit(const uint64_t *row, int w, int from, bool set)
+{
+	int i = from / 64;
+	int words = CAVE_BITS_WORDS(w);
+	uint64_t word;
+
+	if (from >= w) return w;
+	word = (set ? row[i] : ~row[i]) & (~UINT64_C(0) << (from % 64));
+	while (!word) {
+		if (++i == words) return w;
+		word = set ? row[i] : ~row[i];
+	}
+	return MIN(i * 64 + lowest_bit(word), w);
+}
+
+/**
+ * Make a bitboard of the squares in a chunk which pass a test.
+ * \param c is the chunk
+ * \param test is the test
+ * \return the bitboard, one row of CAVE_BITS_WORDS(c->width) words for each
+ * row of the chunk; free it with mem_free()
+ */
+static uint64_t *cave_bits(struct chunk *c,
+		bool (*test)(struct chunk *c, struct loc grid))
+{
+	int words = CAVE_BITS_WORDS(c->width);
+	uint64_t *bits = mem_zalloc(c->height * words * sizeof(*bits));
+	struct loc grid;
+
+	for (grid.y = 0; grid.y < c->height; grid.y++) {
+		uint64_t *row = bits + grid.y * words;
+
+		for (grid.x = 0; grid.x < c->width; grid.x++) {
+			if (test(c, grid)) {
+				row[grid.x / 64] |= UINT64_C(1) << (grid.x % 64);
+			}
+		}
+	}
+	return bits;
+}
+
+/**
+ * Add one bit to each of 64 four bit counters, held a bit to a word.
+ * \param sum is the counters, lowest bit first
+ * \param bits is the bits to add
+ */
+static void add_bit_slices(uint64_t sum[4], uint64_t bits)
+{
+	int i;
+
+	for (i = 0; i < 4 && bits; i++) {
+		uint64_t carry = sum[i] & bits;
+		sum[i] ^= bits;
+		bits = carry;
+	}
+}
+
 /**
  * Run a single pass of the cellular automata rules (4,5) on the dungeon.
  * \param c is the chunk being mutated
+ *
+ * The passable squares are taken as a bitboard first, so the neighbours of
+ * 64 squares at a time can be counted with word operations.
  */
 static void mutate_cavern(struct chunk *c) {
 	struct loc grid;
 	int h = c->height;
 	int w = c->width;
-
-	int *temp = mem_zalloc(h * w * sizeof(int));
+	int words = CAVE_BITS_WORDS(w);
+	uint64_t *open = cave_bits(c, square_ispassable);
+	uint64_t *to_wall = mem_zalloc(words * sizeof(*to_wall));
+	uint64_t *to_floor = mem_zalloc(words * sizeof(*to_floor));
 
 	for (grid.y = 1; grid.y < h - 1; grid.y++) {
-		for (grid.x = 1; grid.x < w - 1; grid.x++) {
-			int count = 8 - count_neighbors(NULL, c, grid,
-				square_ispassable, false);
-			if (square_isstairs(c, grid) ||
-					square_isperm(c, grid)) {
-				temp[grid_to_i(grid, w)] =
-					square(c, grid)->feat;
-			} else if (count > 5) {
-				temp[grid_to_i(grid, w)] = FEAT_GRANITE;
-			} else if (count < 4) {
-				temp[grid_to_i(grid, w)] = FEAT_FLOOR;
-			} else {
-				temp[grid_to_i(grid, w)] =
-					square(c, grid)->feat;
+		int i;
+
+		/* Count the passable neighbours of each square in the row */
+		for (i = 0; i < words; i++) {
+			uint64_t sum[4] = { 0, 0, 0, 0 };
+			int dy;
+
+			for (dy = -1; dy <= 1; dy++) {
+				const uint64_t *row = open + (grid.y + dy) * words;
+				uint64_t west = (row[i] << 1) |
+					(i > 0 ? row[i - 1] >> 63 : 0);
+				uint64_t east = (row[i] >> 1) |
+					(i < words - 1 ? row[i + 1] << 63 : 0);
+
+				add_bit_slices(sum, west);
+				add_bit_slices(sum, east);
+				if (dy) add_bit_slices(sum, row[i]);
 			}
+
+			/* Fewer than three open neighbours, or more than four */
+			to_wall[i] = ~sum[3] & ~sum[2] & ~(sum[1] & sum[0]);
+			to_floor[i] = sum[3] | (sum[2] & (sum[1] | sum[0]));
 		}
-	}
 
-	for (grid.y = 1; grid.y < h - 1; grid.y++) {
 		for (grid.x = 1; grid.x < w - 1; grid.x++) {
-			if (temp[grid_to_i(grid, w)] == FEAT_GRANITE)
+			uint64_t bit = UINT64_C(1) << (grid.x % 64);
+			int feat = square(c, grid)->feat;
+
+			if (square_isstairs(c, grid) || square_isperm(c, grid)) {
+				/* Leave it be */
+			} else if (to_wall[grid.x / 64] & bit) {
+				feat = FEAT_GRANITE;
+			} else if (to_floor[grid.x / 64] & bit) {
+				feat = FEAT_FLOOR;
+			}
+			if (feat == FEAT_GRANITE)
 				set_marked_granite(c, grid, SQUARE_WALL_SOLID);
 			else
-				square_set_feat(c, grid, temp[grid_to_i(grid, w)]);
+				square_set_feat(c, grid, feat);
 		}
 	}
 
-	mem_free(temp);
+	mem_free(to_floor);
+	mem_free(to_wall);
+	mem_free(open);
 }
 
 /**
@@ -1784,58 +1917,39 @@ static int ignore_point(struct chunk *c, int colors[], struct loc grid) {
 }
 
 /**
- * Color a particular point, and all adjacent points.
- * \param c is the current chunk
- * \param colors is the array of current point colors
- * \param counts is the array of current color counts
- * \param stairs If not NULL, stairs is an array with the same number of
- * elements as counts.  At exit, stairs[i] will indicate whether the region
- * with color i includes a staircase.
- * \param grid is the location
- * \param color is the color we are coloring
- * \param diagonal controls whether we can progress diagonally
+ * A run of squares in one row which need coloring, for build_colors()
  */
-static void build_color_point(struct chunk *c, int colors[], int counts[],
-		bool *stairs, struct loc grid, int color, bool diagonal) {
-	int h = c->height;
-	int w = c->width;
-	int size = h * w;
-	struct queue *queue = q_new(size);
-
-	int *added = mem_zalloc(size * sizeof(int));
-
-	array_filler(added, 0, size);
-
-	q_push_int(queue, grid_to_i(grid, w));
-
-	counts[color] = 0;
-
-	while (q_len(queue) > 0) {
-		int i;
-		struct loc grid1;
-		int n1 = q_pop_int(queue);
-
-		i_to_grid(n1, w, &grid1);
+struct color_run {
+	int y;
+	int x0, x1;		/**< First square, and one past the last */
+	int parent;		/**< Earlier run in the same region, or itself */
+	int color;
+};
 
-		if (ignore_point(c, colors, grid1)) continue;
-
-		colors[n1] = color;
-		counts[color]++;
-		if (stairs && square_isstairs(c, grid1)) stairs[color] = true;
-
-		for (i = 0; i < (diagonal ? 8 : 4); i++) {
-			struct loc grid2 = loc_sum(grid1, ddgrid_ddd[i]);
-			int n2 = grid_to_i(grid2, w);
-			if (ignore_point(c, colors, grid2)) continue;
-			if (added[n2]) continue;
-
-			q_push_int(queue, n2);
-			added[n2] = 1;
-		}
+/**
+ * Find the first run of the region a run belongs to.
+ */
+static int color_run_root(struct color_run *runs, int n)
+{
+	while (runs[n].parent != n) {
+		runs[n].parent = runs[runs[n].parent].parent;
+		n = runs[n].parent;
 	}
+	return n;
+}
 
-	mem_free(added);
-	q_free(queue);
+/**
+ * Put two runs in the same region.
+ */
+static void color_run_join(struct color_run *runs, int a, int b)
+{
+	a = color_run_root(runs, a);
+	b = color_run_root(runs, b);
+	if (a < b) {
+		runs[b].parent = a;
+	} else if (b < a) {
+		runs[a].parent = b;
+	}
 }
 
 /**
@@ -1847,23 +1961,90 @@ static void build_color_point(struct chunk *c, int colors[], int counts[],
  * elements as counts.  At exit, stairs[i] will indicate whether the region
  * with color i includes a staircase.
  * \param diagonal controls whether we can progress diagonally
+ *
+ * Rather than flood filling a square at a time, this finds the runs of
+ * squares to color in each row from a bitboard, and joins the runs which
+ * touch in neighbouring rows.  Regions get their colors in the order of
+ * their first square, as they would from a flood fill started at each
+ * uncolored square in turn.
  */
 static void build_colors(struct chunk *c, int colors[], int counts[],
 		bool *stairs, bool diagonal)
 {
-	int y, x;
+	struct loc grid;
 	int h = c->height;
 	int w = c->width;
+	int words = CAVE_BITS_WORDS(w);
+	uint64_t *open = mem_zalloc(h * words * sizeof(*open));
+	struct color_run *runs = mem_zalloc(h * ((w + 1) / 2) * sizeof(*runs));
+	int num_runs = 0, last_row = 0;
+	int slack = diagonal ? 1 : 0;
 	int color = 1;
+	int n;
+
+	for (grid.y = 0; grid.y < h; grid.y++) {
+		uint64_t *row = open + grid.y * words;
+		int this_row = num_runs, a;
+
+		/* Find the squares to color */
+		for (grid.x = 0; grid.x < w; grid.x++) {
+			if (ignore_point(c, colors, grid)) continue;
+			row[grid.x / 64] |= UINT64_C(1) << (grid.x % 64);
+		}
+
+		/* Split them into runs */
+		grid.x = next_bit(row, w, 0, true);
+		while (grid.x < w) {
+			struct color_run *run = &runs[num_runs];
+
+			run->y = grid.y;
+			run->x0 = grid.x;
+			run->x1 = next_bit(row, w, grid.x, false);
+			run->parent = num_runs++;
+			grid.x = next_bit(row, w, run->x1, true);
+		}
+
+		/* Join them to the runs they touch in the row above */
+		a = last_row;
+		n = this_row;
+		while (a < this_row && n < num_runs) {
+			if (runs[a].x0 < runs[n].x1 + slack &&
+					runs[n].x0 < runs[a].x1 + slack) {
+				color_run_join(runs, a, n);
+			}
+			if (runs[a].x1 < runs[n].x1) {
+				a++;
+			} else {
+				n++;
+			}
+		}
+		last_row = this_row;
+	}
 
-	for (y = 0; y < h; y++) {
-		for (x = 0; x < w; x++) {
-			if (ignore_point(c, colors, loc(x, y))) continue;
-			build_color_point(c, colors, counts, stairs,
-				loc(x, y), color, diagonal);
-			color++;
+	/* Color each region, in the order of its first run */
+	for (n = 0; n < num_runs; n++) {
+		struct color_run *run = &runs[n];
+		int root = color_run_root(runs, n);
+
+		if (root == n) {
+			run->color = color++;
+			counts[run->color] = 0;
+		} else {
+			run->color = runs[root].color;
+		}
+		counts[run->color] += run->x1 - run->x0;
+
+		grid.y = run->y;
+		for (grid.x = run->x0; grid.x < run->x1; grid.x++) {
+			colors[grid_to_i(grid, w)] = run->color;
+			if (stairs && square_isstairs(c, grid)) {
+				stairs[run->color] = true;
+			}
 		}
 	}
+
+	mem_free(runs);
+	mem_free(open);
 }
 
 /**
@@ -2068,6 +2249,8 @@ static void join_regions(struct chunk *c, int colors[], int counts[],
 	int size = h * w;
 	int num = count_colors(counts, size);
 
+	event_signal(EVENT_GEN_TUNNELING_START);
+
 	/* While we have multiple colors (i.e. disconnected regions), join one
 	 * of the regions to another one.
 	 */
@@ -2077,6 +2260,8 @@ static void join_regions(struct chunk *c, int colors[], int counts[],
 			allow_vault_disconnect);
 		num--;
 	}
+
+	event_signal(EVENT_GEN_TUNNELING_END);
 }
 
 
@@ -2181,9 +2366,11 @@ static struct chunk *cavern_chunk(int depth, int h, int w,
 
 /**
  * Make a cavern level.
+ * \param dun is the current generation data
  * \param p is the player
  */
-struct chunk *cavern_gen(struct player *p, int min_height, int min_width) {
+struct chunk *cavern_gen(struct dun_data *dun, struct player *p,
+		int min_height, int min_width) {
 	int i, k;
 
 	int h = rand_range(z_info->dungeon_hgt / 2, (z_info->dungeon_hgt * 3) / 4);
@@ -2203,7 +2390,7 @@ struct chunk *cavern_gen(struct player *p, int min_height, int min_width) {
 	draw_rectangle(c, 0, 0, h - 1, w - 1, FEAT_PERM, SQUARE_NONE, true);
 
 	/* Place 1-3 down stairs and 1-2 up stairs near some walls */
-	handle_level_stairs(c, dun->persist, dun->quest,
+	handle_level_stairs(dun, c, dun->persist, dun->quest,
 		rand_range(1, 3), rand_range(1, 2));
 
 	/* General some rubble, traps and monsters */
@@ -2536,10 +2723,12 @@ static void build_ruin(struct chunk *c, struct loc xroads, struct loc lot, int l
 
 /**
  * Generate the town for the first time, and place the player
+ * \param dun is the current generation data
  * \param c is the current chunk
  * \param p is the player
  */
-static void town_gen_layout(struct chunk *c, struct player *p, int num_lava, bool lake)
+static void town_gen_layout(struct dun_data *dun, struct chunk *c,
+		struct player *p, int num_lava, bool lake)
 {
 	int n, x, y;
 	struct loc grid, pgrid, xroads;
@@ -2570,7 +2759,7 @@ static void town_gen_layout(struct chunk *c, struct player *p, int num_lava, boo
 
 		/* Make some lava streamers */
 		for (n = 0; n <num_lava; n++)
-			build_streamer(c, FEAT_LAVA, 0);
+			build_streamer(dun, c, FEAT_LAVA, 0);
 
 		/* Make a town-sized starburst room. */
 		(void) generate_starburst_room(c, 0, 0, c->height - 1,
@@ -2741,6 +2930,7 @@ struct chunk *town_gen_all(struct player *p, int height, int width)
 		if (!c->name) {
 			c->name = string_make(p->town->name);
 		}
+		cave_pack(c);
 		chunk_list_add(c);
 	}
 	p->town = town;
@@ -2749,13 +2939,15 @@ struct chunk *town_gen_all(struct player *p, int height, int width)
 
 /**
  * Town logic flow for generation of new town.
+ * \param dun is the current generation data
  * \param p is the player
  * \return a pointer to the generated chunk
  * We start with a fully wiped cave of normal floors. This function does NOT do
  * anything about the owners of the stores, nor the contents thereof. It only
  * handles the physical layout.
  */
-struct chunk *town_gen(struct player *p, int min_height, int min_width)
+struct chunk *town_gen(struct dun_data *dun, struct player *p,
+		int min_height, int min_width)
 {
 	int i;
 	struct loc grid;
@@ -2766,16 +2958,25 @@ struct chunk *town_gen(struct player *p, int min_height, int min_width)
 	/* Make a new chunk */
 	c_new = cave_new(z_info->town_hgt, z_info->town_wid);
 
+	/* Read it back in if it was spilled */
+	if (c_old && !chunk_list_load(c_old)) {
+		c_old = NULL;
+	}
+
 	/* First time */
 	if (!c_old) {
 		c_new->depth = danger_depth(player);
 
 		/* Build stuff */
-		town_gen_layout(c_new, p, player->town->lava_num, player->town->lake);
+		town_gen_layout(dun, c_new, p, player->town->lava_num,
+			player->town->lake);
 	} else {
 		/* If any stores are scheduled to be destroyed, do it now */
 		bool found = false;
 
+		/* Open the stored town out again */
+		cave_unpack(c_old);
+
 		for(int i=0;i<MAX_STORES;i++) {
 			if (stores[i].destroy) {
 				destroy_store(c_old, i);
@@ -2944,6 +3145,7 @@ struct chunk *town_gen(struct player *p, int min_height, int min_width)
 /* ------------------ MODIFIED ---------------- */
 /**
  * The main modified generation algorithm
+ * \param dun is the current generation data
  * \param p is the player, in case generation fails and the partially created
  * level needs to be cleaned up
  * \param depth is the chunk's native depth
@@ -2952,8 +3154,8 @@ struct chunk *town_gen(struct player *p, int min_height, int min_width)
  * \param persistent If true, handle the connections for persistent levels.
  * \return a pointer to the generated chunk
  */
-static struct chunk *modified_chunk(struct player *p, int depth, int height,
-		int width, bool persistent)
+static struct chunk *modified_chunk(struct dun_data *dun, struct player *p,
+		int depth, int height, int width, bool persistent)
 {
 	int i;
 	int by = 0, bx = 0, key, rarity;
@@ -2990,11 +3192,11 @@ static struct chunk *modified_chunk(struct player *p, int depth, int height,
 	/* No rooms yet, pits or otherwise. */
 	dun->pit_num = 0;
 	dun->cent_n = 0;
-	reset_entrance_data(c);
+	reset_entrance_data(dun, c);
 
 	/* Build the special staircase rooms */
 	if (persistent) {
-		build_staircase_rooms(c, "Modified Generation");
+		build_staircase_rooms(dun, c, "Modified Generation");
 	}
 
 	/*
@@ -3047,7 +3249,7 @@ static struct chunk *modified_chunk(struct player *p, int depth, int height,
 			struct room_profile profile = dun->profile->room_profiles[i];
 			if (profile.rarity > rarity) continue;
 			if (profile.cutoff <= key) continue;
-			if (room_build(c, by, bx, profile, true)) break;
+			if (room_build(dun, c, by, bx, profile, true)) break;
 		}
 	}
 
@@ -3056,7 +3258,7 @@ static struct chunk *modified_chunk(struct player *p, int depth, int height,
 	mem_free(dun->room_map);
 
 	/* Connect all the rooms together */
-	do_traditional_tunneling(c);
+	do_traditional_tunneling(dun, c);
 	ensure_connectedness(c, true);
 
 	/* Turn the outer permanent walls back to granite */
@@ -3068,6 +3270,7 @@ static struct chunk *modified_chunk(struct player *p, int depth, int height,
 
 /**
  * Generate a new dungeon level.
+ * \param dun is the current generation data
  * \param p is the player
  * \return a pointer to the generated chunk
  *
@@ -3089,7 +3292,8 @@ static struct chunk *modified_chunk(struct player *p, int depth, int height,
  *   interesting rooms, as well as to make general monster restrictions in
  *   areas or the whole dungeon
  */
-struct chunk *modified_gen(struct player *p, int min_height, int min_width) {
+struct chunk *modified_gen(struct dun_data *dun, struct player *p,
+		int min_height, int min_width) {
 	int i, k;
 	int size_percent, y_size, x_size;
 	struct chunk *c;
@@ -3115,7 +3319,7 @@ struct chunk *modified_gen(struct player *p, int min_height, int min_width) {
 	dun->block_hgt = dun->profile->block_size;
 	dun->block_wid = dun->profile->block_size;
 
-	c = modified_chunk(p, p->depth, MIN(z_info->dungeon_hgt, y_size),
+	c = modified_chunk(dun, p, p->depth, MIN(z_info->dungeon_hgt, y_size),
 		MIN(z_info->dungeon_wid, x_size), dun->persist);
 	if (!c) return NULL;
 
@@ -3125,14 +3329,14 @@ struct chunk *modified_gen(struct player *p, int min_height, int min_width) {
 
 	/* Add some magma streamers */
 	for (i = 0; i < dun->profile->str.mag; i++)
-		build_streamer(c, FEAT_MAGMA, dun->profile->str.mc);
+		build_streamer(dun, c, FEAT_MAGMA, dun->profile->str.mc);
 
 	/* Add some quartz streamers */
 	for (i = 0; i < dun->profile->str.qua; i++)
-		build_streamer(c, FEAT_QUARTZ, dun->profile->str.qc);
+		build_streamer(dun, c, FEAT_QUARTZ, dun->profile->str.qc);
 
 	/* Place 3 or 4 down stairs and 1 or 2 up stairs near some walls */
-	handle_level_stairs(c, dun->persist, dun->quest,
+	handle_level_stairs(dun, c, dun->persist, dun->quest,
 		rand_range(3, 4), rand_range(1, 2));
 
     /* General amount of rubble, traps and monsters */
@@ -3178,6 +3382,7 @@ struct chunk *modified_gen(struct player *p, int min_height, int min_width) {
 /* ------------------ MORIA ---------------- */
 /**
  * The main moria generation algorithm
+ * \param dun is the current generation data
  * \param p is the player, in case generation fails and the partially created
  * level needs to be cleaned up
  * \param depth is the chunk's native depth
@@ -3186,8 +3391,8 @@ struct chunk *modified_gen(struct player *p, int min_height, int min_width) {
  * \param persistent If true, handle the connections for persistent levels.
  * \return a pointer to the generated chunk
  */
-static struct chunk *moria_chunk(struct player *p, int depth, int height,
-		int width, bool persistent)
+static struct chunk *moria_chunk(struct dun_data *dun, struct player *p,
+		int depth, int height, int width, bool persistent)
 {
 	int i;
 	int by = 0, bx = 0, key, rarity;
@@ -3224,11 +3429,11 @@ static struct chunk *moria_chunk(struct player *p, int depth, int height,
 	/* No rooms yet, pits or otherwise. */
 	dun->pit_num = 0;
 	dun->cent_n = 0;
-	reset_entrance_data(c);
+	reset_entrance_data(dun, c);
 
 	/* Build the special staircase rooms */
 	if (persistent) {
-		build_staircase_rooms(c, "Moria Generation");
+		build_staircase_rooms(dun, c, "Moria Generation");
 	}
 
 	/*
@@ -3282,7 +3487,7 @@ static struct chunk *moria_chunk(struct player *p, int depth, int height,
 			struct room_profile profile = dun->profile->room_profiles[i];
 			if (profile.rarity > rarity) continue;
 			if (profile.cutoff <= key) continue;
-			if (room_build(c, by, bx, profile, true)) break;
+			if (room_build(dun, c, by, bx, profile, true)) break;
 		}
 	}
 
@@ -3291,7 +3496,7 @@ static struct chunk *moria_chunk(struct player *p, int depth, int height,
 	mem_free(dun->room_map);
 
 	/* Connect all the rooms together */
-	do_traditional_tunneling(c);
+	do_traditional_tunneling(dun, c);
 	ensure_connectedness(c, true);
 
 	/* Turn the outer permanent walls back to granite */
@@ -3303,6 +3508,7 @@ static struct chunk *moria_chunk(struct player *p, int depth, int height,
 
 /**
  * Generate a new dungeon level.
+ * \param dun is the current generation data
  * \param p is the player
  * \return a pointer to the generated chunk
  *
@@ -3317,7 +3523,8 @@ static struct chunk *moria_chunk(struct player *p, int depth, int height,
  * labyrinth levels are selected) would be
  *	if ((c->depth >= 10) && (c->depth < 40) && one_in_(40))
  */
-struct chunk *moria_gen(struct player *p, int min_height, int min_width) {
+struct chunk *moria_gen(struct dun_data *dun, struct player *p,
+		int min_height, int min_width) {
 	int i, k;
 	int size_percent, y_size, x_size;
 	struct chunk *c;
@@ -3343,7 +3550,7 @@ struct chunk *moria_gen(struct player *p, int min_height, int min_width) {
 	dun->block_hgt = dun->profile->block_size;
 	dun->block_wid = dun->profile->block_size;
 
-	c = moria_chunk(p, p->depth, MIN(z_info->dungeon_hgt, y_size),
+	c = moria_chunk(dun, p, p->depth, MIN(z_info->dungeon_hgt, y_size),
 		MIN(z_info->dungeon_wid, x_size), dun->persist);
 	if (!c) return NULL;
 
@@ -3353,14 +3560,14 @@ struct chunk *moria_gen(struct player *p, int min_height, int min_width) {
 
 	/* Add some magma streamers */
 	for (i = 0; i < dun->profile->str.mag; i++)
-		build_streamer(c, FEAT_MAGMA, dun->profile->str.mc);
+		build_streamer(dun, c, FEAT_MAGMA, dun->profile->str.mc);
 
 	/* Add some quartz streamers */
 	for (i = 0; i < dun->profile->str.qua; i++)
-		build_streamer(c, FEAT_QUARTZ, dun->profile->str.qc);
+		build_streamer(dun, c, FEAT_QUARTZ, dun->profile->str.qc);
 
 	/* Place 3 or 4 down stairs and 1 or 2 up stairs near some walls */
-	handle_level_stairs(c, dun->persist, dun->quest,
+	handle_level_stairs(dun, c, dun->persist, dun->quest,
 		rand_range(3, 4), rand_range(1, 2));
 
 	/* General amount of rubble, traps and monsters */
@@ -3409,10 +3616,11 @@ struct chunk *moria_gen(struct player *p, int min_height, int min_width) {
 /* ------------------ HARD CENTRE ---------------- */
 /**
  * Make a chunk consisting only of a greater vault
+ * \param dun is the current generation data
  * \param p is the player
  * \return a pointer to the generated chunk
  */
-static struct chunk *vault_chunk(struct player *p)
+static struct chunk *vault_chunk(struct dun_data *dun, struct player *p)
 {
 	const char *vname = (one_in_(2)) ?
 		"Greater vault (new)" : "Greater vault";
@@ -3430,9 +3638,9 @@ static struct chunk *vault_chunk(struct player *p)
 
 	/* Build the vault in it */
 	dun->cent_n = 0;
-	reset_entrance_data(c);
+	reset_entrance_data(dun, c);
 	event_signal_string(EVENT_GEN_ROOM_START, vname);
-	built = build_vault(c, loc(v->wid / 2, v->hgt / 2), v);
+	built = build_vault(dun, c, loc(v->wid / 2, v->hgt / 2), v);
 	event_signal_flag(EVENT_GEN_ROOM_END, built);
 	if (!built) {
 		cave_free(c);
@@ -3445,10 +3653,11 @@ static struct chunk *vault_chunk(struct player *p)
 /* ------------------ QUEST ---------------- */
 /**
  * Make a chunk consisting only of a quest vault
+ * \param dun is the current generation data
  * \param p is the player
  * \return a pointer to the generated chunk
  */
-struct chunk *quest_chunk(struct player *p)
+struct chunk *quest_chunk(struct dun_data *dun, struct player *p)
 {
 	/* Find the quest */
 	struct quest *q;
@@ -3471,7 +3680,7 @@ struct chunk *quest_chunk(struct player *p)
 			SQUARE_NONE);
 
 		/* Build the vault in it */
-		build_vault(c, loc(v->wid / 2, v->hgt / 2), v);
+		build_vault(dun, c, loc(v->wid / 2, v->hgt / 2), v);
 
 		/* Do quest specific setup */
 		quest_enter_level(c);
@@ -3501,6 +3710,7 @@ static void connect_caverns(struct chunk *c, struct loc floor[])
 	}
 
 	/* Join left and upper, right and lower */
+	event_signal(EVENT_GEN_TUNNELING_START);
 	join_region(c, colors, counts, color_of_floor[0], color_of_floor[1],
 		false);
 	join_region(c, colors, counts, color_of_floor[2], color_of_floor[3],
@@ -3513,6 +3723,7 @@ static void connect_caverns(struct chunk *c, struct loc floor[])
 	}
 	join_region(c, colors, counts, color_of_floor[1], color_of_floor[2],
 		false);
+	event_signal(EVENT_GEN_TUNNELING_END);
 
 	mem_free(colors);
 	mem_free(counts);
@@ -3520,13 +3731,15 @@ static void connect_caverns(struct chunk *c, struct loc floor[])
 
 /**
  * Generate a quest level - a quest vault
+ * \param dun is the current generation data
  * \param p is the player
  * \return a pointer to the generated chunk
 */
-struct chunk *quest_gen(struct player *p, int min_height, int min_width)
+struct chunk *quest_gen(struct dun_data *dun, struct player *p,
+		int min_height, int min_width)
 {
 	/* Make a vault  */
-	struct chunk *vault = quest_chunk(p);
+	struct chunk *vault = quest_chunk(dun, p);
 	struct chunk *c;
 
 	/* Make a cave to copy them into */
@@ -3559,13 +3772,15 @@ struct chunk *quest_gen(struct player *p, int min_height, int min_width)
 
 /**
  * Generate a hard centre level - a greater vault surrounded by caverns
+ * \param dun is the current generation data
  * \param p is the player
  * \return a pointer to the generated chunk
 */
-struct chunk *hard_centre_gen(struct player *p, int min_height, int min_width)
+struct chunk *hard_centre_gen(struct dun_data *dun, struct player *p,
+		int min_height, int min_width)
 {
 	/* Make a vault for the centre */
-	struct chunk *centre = vault_chunk(p);
+	struct chunk *centre = vault_chunk(dun, p);
 	int rotate = 0;
 
 	/* Dimensions for the surrounding caverns */
@@ -3612,7 +3827,7 @@ struct chunk *hard_centre_gen(struct player *p, int min_height, int min_width)
 				break;
 			}
 		} else {
-			grid = choose_random_entrance(centre, 0, NULL, 0,
+			grid = choose_random_entrance(dun, centre, 0, NULL, 0,
 				dun->wall, i);
 			if (loc_eq(grid, loc(0, 0))) {
 				if (i == 0) {
@@ -3627,7 +3842,7 @@ struct chunk *hard_centre_gen(struct player *p, int min_height, int min_width)
 		 * Store position in dun->wall and mark neighbors as invalid
 		 * entrances.
 		 */
-		pierce_outer_wall(centre, grid);
+		pierce_outer_wall(dun, centre, grid);
 		/* Convert it to a floor. */
 		square_set_feat(centre, grid, FEAT_FLOOR);
 	}
@@ -3774,10 +3989,12 @@ struct chunk *hard_centre_gen(struct player *p, int min_height, int min_width)
 /**
  * Generate a lair level - a regular cave generated with the modified
  * algorithm, connected to a cavern with themed monsters
+ * \param dun is the current generation data
  * \param p is the player
  * \return a pointer to the generated chunk
  */
-struct chunk *lair_gen(struct player *p, int min_height, int min_width) {
+struct chunk *lair_gen(struct dun_data *dun, struct player *p,
+		int min_height, int min_width) {
 	int i, k;
 	int size_percent, y_size, x_size;
 	int left_width, normal_width, lair_width;
@@ -3839,7 +4056,7 @@ struct chunk *lair_gen(struct player *p, int min_height, int min_width) {
 	dun->join = transform_join_list(cached_join, y_size, normal_width,
 		0, normal_offset, 0, false);
 
-	normal = modified_chunk(p, p->depth, y_size, normal_width,
+	normal = modified_chunk(dun, p, p->depth, y_size, normal_width,
 		dun->persist);
 
 	cave_connectors_free(dun->join);
@@ -3884,11 +4101,11 @@ struct chunk *lair_gen(struct player *p, int min_height, int min_width) {
 
 	/* Add some magma streamers */
 	for (i = 0; i < dun->profile->str.mag; i++)
-		build_streamer(normal, FEAT_MAGMA, dun->profile->str.mc);
+		build_streamer(dun, normal, FEAT_MAGMA, dun->profile->str.mc);
 
 	/* Add some quartz streamers */
 	for (i = 0; i < dun->profile->str.qua; i++)
-		build_streamer(normal, FEAT_QUARTZ, dun->profile->str.qc);
+		build_streamer(dun, normal, FEAT_QUARTZ, dun->profile->str.qc);
 
 	/* Pick a larger number of monsters for the lair */
 	i = (z_info->level_monster_min + randint1(20) + k);
@@ -3896,7 +4113,7 @@ struct chunk *lair_gen(struct player *p, int min_height, int min_width) {
 	/* Find appropriate monsters */
 	while (true) {
 		/* Choose a pit profile */
-		set_pit_type(danger_depth(player), 0);
+		set_pit_type(dun, danger_depth(player), 0);
 
 		/* Set monster generation restrictions */
 		if (mon_restrict(dun->pit_type->name, danger_depth_at(p, lair->depth), danger_depth_at(p, lair->depth), true))
@@ -3931,7 +4148,7 @@ struct chunk *lair_gen(struct player *p, int min_height, int min_width) {
 	ensure_connectedness(c, true);
 
 	/* Place 3 or 4 down stairs and 1 or 2 up stairs near some walls */
-	handle_level_stairs(c, dun->persist, dun->quest,
+	handle_level_stairs(dun, c, dun->persist, dun->quest,
 		rand_range(3, 4), rand_range(1, 2));
 
 	/* Put some rubble in corridors */
@@ -3961,10 +4178,12 @@ struct chunk *lair_gen(struct player *p, int min_height, int min_width) {
  * between them, and no teleport and only upstairs from the side where the
  * player starts.
  *
+ * \param dun is the current generation data
  * \param p is the player
  * \return a pointer to the generated chunk
  */
-struct chunk *gauntlet_gen(struct player *p, int min_height, int min_width) {
+struct chunk *gauntlet_gen(struct dun_data *dun, struct player *p,
+		int min_height, int min_width) {
 	int i, k;
 	struct chunk *c;
 	struct chunk *left;
@@ -4087,7 +4306,7 @@ struct chunk *gauntlet_gen(struct player *p, int min_height, int min_width) {
 	/* Find appropriate monsters */
 	while (true) {
 		/* Choose a pit profile */
-		set_pit_type(danger_depth(player), 0);
+		set_pit_type(dun, danger_depth(player), 0);
 
 		/* Set monster generation restrictions */
 		if (mon_restrict(dun->pit_type->name, danger_depth_at(p, gauntlet->depth), danger_depth_at(p, gauntlet->depth), true))
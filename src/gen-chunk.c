@@ -18,6 +18,9 @@
  * This file maintains a list of saved chunks of world which can be reloaded
  * at any time.  The initial example of this is the town, which is saved
  * immediately after generation and restored when the player returns there.
+ * Chunks are found by name through a hash, and only the levels the player
+ * left most recently are kept in memory; the others are written out to side
+ * files, one for each chunk, and read back when they are wanted.
  *
  * The copying routines are also useful for generating a level in pieces and
  * then copying those pieces into the actual level chunk.
@@ -30,13 +33,30 @@
 #include "init.h"
 #include "mon-group.h"
 #include "mon-make.h"
+#include "obj-pile.h"
 #include "obj-util.h"
+#include "savefile.h"
 #include "trap.h"
 
 #define CHUNK_LIST_INCR 10
+#define CHUNK_HASH_SIZE 256
 struct chunk **chunk_list;     /**< list of pointers to saved chunks */
 uint16_t chunk_list_max = 0;   /**< current max actual chunk index */
 
+/**
+ * Saved chunks by name; chunks with the same name are chained in the order
+ * they are in the list, so the first found is the one a walk down the list
+ * would find
+ */
+struct chunk_name {
+	struct chunk *c;
+	struct chunk_name *next;
+};
+static struct chunk_name *chunk_names[CHUNK_HASH_SIZE];
+
+static uint32_t chunk_spills;		/**< Side files written, to name them */
+static bool chunk_spill_failed;		/**< A side file couldn't be written */
+
 
 /**
  * Write the terrain info of a chunk to memory and return a pointer to it
@@ -63,15 +83,212 @@ struct chunk *chunk_write(struct chunk *c)
 	return new;
 }
 
+static struct chunk_name **chunk_name_bucket(const char *name)
+{
+	return &chunk_names[djb2_hash(name) % CHUNK_HASH_SIZE];
+}
+
+/**
+ * Check whether one saved chunk is the player's map of another
+ */
+static bool chunk_is_map_of(const struct chunk *known,
+		const struct chunk *level)
+{
+	size_t len = strlen(level->name);
+
+	return strlen(known->name) == len + strlen(" known") &&
+		!strncmp(known->name, level->name, len) &&
+		suffix(known->name, " known");
+}
+
+/**
+ * Write a saved chunk out to a side file and free all of it but what is
+ * looked at while it is away: its name, turn, depth, size and the stairs
+ * joining it to the levels around it.  The monsters on it are still counted
+ * as alive.
+ * \param c the chunk being spilled
+ * \return whether it was written out
+ */
+static bool chunk_spill(struct chunk *c)
+{
+	char safe[40], file[80], path[1024];
+	struct chunk *body;
+	int i;
+
+	player_safe_name(safe, sizeof(safe), player->full_name, false);
+	strnfmt(file, sizeof(file), "%s.%lu.lev", safe,
+		(unsigned long) ++chunk_spills);
+	path_build(path, sizeof(path), ANGBAND_DIR_SAVE, file);
+	cave_unpack(c);
+	if (!savefile_save_chunk(path, c)) {
+		cave_pack(c);
+		chunk_spill_failed = true;
+		return false;
+	}
+
+	/* Keep the shell in the list */
+	body = mem_alloc(sizeof(*body));
+	memcpy(body, c, sizeof(*body));
+	memset(c, 0, sizeof(*c));
+	c->name = body->name;
+	c->turn = body->turn;
+	c->depth = body->depth;
+	c->height = body->height;
+	c->width = body->width;
+	c->join = body->join;
+	c->spill = string_make(path);
+	body->name = NULL;
+	body->join = NULL;
+
+	/* Free the rest, held objects first so cave_free() doesn't see them */
+	for (i = 1; i < cave_monster_max(body); i++) {
+		struct monster *mon = cave_monster(body, i);
+		struct object *obj;
+
+		if (!mon->race) continue;
+		for (obj = mon->held_obj; obj; obj = obj->next) {
+			if (obj->oidx) body->objects[obj->oidx] = NULL;
+		}
+		if (mon->held_obj) object_pile_free(body, NULL, mon->held_obj);
+	}
+	for (i = 1; i < z_info->level_monster_max; i++) {
+		if (body->monster_groups[i]) {
+			monster_group_free(body, body->monster_groups[i]);
+		}
+	}
+	cave_free(body);
+	return true;
+}
+
+/**
+ * Read a spilled chunk back in from its side file
+ * \param c the shell left by chunk_spill()
+ * \return whether it was read
+ */
+static bool chunk_unspill(struct chunk *c)
+{
+	struct chunk *body;
+	int i;
+
+	if (!c->spill) return true;
+	body = savefile_load_chunk(c->spill);
+	if (!body) return false;
+	file_delete(c->spill);
+	string_free(c->spill);
+
+	/* Its monsters were counted again as they were placed */
+	for (i = 1; i < cave_monster_max(body); i++) {
+		struct monster *mon = cave_monster(body, i);
+
+		if (!mon->race) continue;
+		if (mon->original_race) mon->original_race->cur_num--;
+		else mon->race->cur_num--;
+	}
+
+	/* What the shell kept still stands */
+	string_free(body->name);
+	body->name = c->name;
+	cave_connectors_free(body->join);
+	body->join = c->join;
+	body->turn = c->turn;
+	body->depth = c->depth;
+	memcpy(c, body, sizeof(*c));
+	mem_free(body);
+	cave_pack(c);
+	return true;
+}
+
+/**
+ * Free a saved chunk for good, whether it is in memory or not
+ */
+static void chunk_discard(struct chunk *c)
+{
+	if (c->spill) {
+		file_delete(c->spill);
+		string_free(c->spill);
+		cave_connectors_free(c->join);
+		string_free(c->name);
+		mem_free(c);
+	} else {
+		cave_unpack(c);
+		wipe_mon_list(c, player);
+		cave_free(c);
+	}
+}
+
+/**
+ * Spill the saved levels the player left longest ago, and the maps of them,
+ * until no more than z_info->levels_kept are left in memory; a level that
+ * isn't packed is in use, and stays
+ */
+static void chunk_list_trim(void)
+{
+	int i, kept = 0;
+
+	if (!z_info->levels_kept || chunk_spill_failed || !player) return;
+
+	for (i = chunk_list_max - 1; i >= 0; i--) {
+		struct chunk *c = chunk_list[i], *known = NULL;
+
+		if (c->spill || suffix(c->name, " known")) continue;
+		if (i + 1 < chunk_list_max && chunk_is_map_of(chunk_list[i + 1], c)) {
+			known = chunk_list[i + 1];
+		}
+		if (kept < z_info->levels_kept || !c->packed ||
+				(known && !known->spill && !known->packed)) {
+			kept++;
+			continue;
+		}
+		if (chunk_spill(c) && known && !known->spill) {
+			chunk_spill(known);
+		}
+	}
+}
+
+/**
+ * Take a chunk out of the list and the hash, without freeing it
+ */
+static void chunk_list_excise(struct chunk *c)
+{
+	struct chunk_name **link = chunk_name_bucket(c->name);
+	int i;
+
+	while (*link && (*link)->c != c) {
+		link = &(*link)->next;
+	}
+	if (*link) {
+		struct chunk_name *gone = *link;
+
+		*link = gone->next;
+		mem_free(gone);
+	}
+
+	for (i = 0; i < chunk_list_max; i++) {
+		if (chunk_list[i] == c) {
+			/* Copy all the succeeding chunks back one */
+			int j;
+			for (j = i + 1; j < chunk_list_max; j++) {
+				chunk_list[j - 1] = chunk_list[j];
+			}
+
+			/* Shorten the list */
+			chunk_list_max--;
+			chunk_list[chunk_list_max] = NULL;
+			break;
+		}
+	}
+}
+
 /**
- * Add an entry to the chunk list - any problems with the length of this will
- * be more in the memory used by the chunks themselves rather than the list
+ * Add an entry to the chunk list - chunks left longest ago are spilled to
+ * side files if there are more than the constants allow in memory
  * \param c the chunk being added to the list
  */
 void chunk_list_add(struct chunk *c)
 {
 	assert(c->name);
 	int newsize = (chunk_list_max + CHUNK_LIST_INCR) *	sizeof(struct chunk *);
+	struct chunk_name **link = chunk_name_bucket(c->name);
 
 	/* Lengthen the list if necessary */
 	if (((chunk_list_max % CHUNK_LIST_INCR) == 0) || (!chunk_list))
@@ -79,6 +296,15 @@ void chunk_list_add(struct chunk *c)
 
 	/* Add the new one */
 	chunk_list[chunk_list_max++] = c;
+
+	/* File it by name, after any others of the same name */
+	while (*link) {
+		link = &(*link)->next;
+	}
+	*link = mem_zalloc(sizeof(**link));
+	(*link)->c = c;
+
+	chunk_list_trim();
 }
 
 /**
@@ -88,42 +314,104 @@ void chunk_list_add(struct chunk *c)
  */
 bool chunk_list_remove(const char *name)
 {
+	struct chunk *c = chunk_find_name(name);
+
+	if (!c) return false;
+	chunk_list_excise(c);
+	return true;
+}
+
+/**
+ * Make sure a saved chunk is in memory, reading it back from its side file
+ * if it was spilled.  A level and the player's map of it always come back
+ * together.
+ * \param c the chunk
+ * \return whether it is in memory; if it couldn't be read, it and its
+ * partner are dropped from the list and freed
+ */
+bool chunk_list_load(struct chunk *c)
+{
+	struct chunk *level = NULL, *known = NULL;
 	int i;
-	assert(name);
 
-	/* Find the match */
 	for (i = 0; i < chunk_list_max; i++) {
-		if (streq(name, chunk_list[i]->name)) {
-			/* Copy all the succeeding chunks back one */
-			int j;
-			for (j = i + 1; j < chunk_list_max; j++) {
-				chunk_list[j - 1] = chunk_list[j];
-			}
+		if (chunk_list[i] == c) break;
+	}
+	assert(i < chunk_list_max);
+	if (i > 0 && chunk_is_map_of(c, chunk_list[i - 1])) {
+		level = chunk_list[i - 1];
+		known = c;
+	} else if (i + 1 < chunk_list_max &&
+			chunk_is_map_of(chunk_list[i + 1], c)) {
+		level = c;
+		known = chunk_list[i + 1];
+	} else {
+		level = c;
+	}
+	if (!level->spill && !(known && known->spill)) return true;
+
+	if (!chunk_unspill(level) || (known && !chunk_unspill(known))) {
+		msg("The memory of %s is lost.", level->name);
+		chunk_list_excise(level);
+		chunk_discard(level);
+		if (known) {
+			chunk_list_excise(known);
+			chunk_discard(known);
+		}
+		return false;
+	}
 
-			/* Shorten the list and return */
-			chunk_list_max--;
-			chunk_list[chunk_list_max] = NULL;
-			return true;
+	/* Associate known objects */
+	if (known) {
+		for (i = 1; i < MIN(level->obj_max, known->obj_max); i++) {
+			if (level->objects[i] && known->objects[i]) {
+				level->objects[i]->known = known->objects[i];
+			}
 		}
 	}
+	return true;
+}
+
+/**
+ * Free every saved chunk, and the side files of those spilled
+ */
+void chunk_list_free(void)
+{
+	int i;
+
+	for (i = 0; i < chunk_list_max; i++) {
+		chunk_discard(chunk_list[i]);
+	}
+	mem_free(chunk_list);
+	chunk_list = NULL;
+	chunk_list_max = 0;
 
-	return false;
+	for (i = 0; i < CHUNK_HASH_SIZE; i++) {
+		while (chunk_names[i]) {
+			struct chunk_name *next = chunk_names[i]->next;
+
+			mem_free(chunk_names[i]);
+			chunk_names[i] = next;
+		}
+	}
+	chunk_spill_failed = false;
 }
 
 /**
  * Find a chunk by name
  * \param name the name of the chunk being sought
- * \return the pointer to the chunk
+ * \return the pointer to the chunk; a chunk spilled to its side file is only
+ * a shell until chunk_list_load() has been called on it
  */
 struct chunk *chunk_find_name(const char *name)
 {
-	int i;
+	struct chunk_name *entry;
 
 	assert(name);
 
-	for (i = 0; i < chunk_list_max; i++)
-		if (streq(name, chunk_list[i]->name))
-			return chunk_list[i];
+	for (entry = *chunk_name_bucket(name); entry; entry = entry->next)
+		if (streq(name, entry->c->name))
+			return entry->c;
 
 	return NULL;
 }
@@ -377,6 +665,7 @@ bool chunk_copy(struct chunk *dest, struct player *p, struct chunk *source,
 				square(source, grid)->feat;
 			dest->squares[dest_grid.y][dest_grid.x].tag =
 				square(source, grid)->tag;
+			cave_note_floor(dest, dest_grid);
 
 			sqinfo_copy(square(dest, dest_grid)->info,
 						square(source, grid)->info);
@@ -435,7 +724,7 @@ bool chunk_copy(struct chunk *dest, struct player *p, struct chunk *source,
 
 		/* Move grid */
 		symmetry_transform(&dest_mon->grid, y0, x0, h, w, rotate, reflect);
-		dest->squares[dest_mon->grid.y][dest_mon->grid.x].mon = dest_mon->midx;
+		square_set_mon(dest, dest_mon->grid, dest_mon->midx);
 
 		/* Held or mimicked objects */
 		if (source_mon->held_obj) {
@@ -165,13 +165,11 @@ bool mon_restrict(const char *monster_type, int depth, int current_depth,
 		/* Use a pit profile */
 		struct pit_profile *profile = lookup_pit_profile(monster_type);
 		/* Accept the profile or leave area empty if none found */
-		if (profile)
-			dun->pit_type = profile;
-		else
+		if (!profile)
 			return false;
 
 		/* Prepare allocation table */
-		get_mon_num_prep(mon_pit_hook);
+		prep_pit_monsters(profile);
 		return true;
 	}
 }
@@ -323,6 +321,7 @@ void get_vault_monsters(struct chunk *c, char racial_symbol[], char *vault_type,
 /**
  * Funtion for placing appropriate monsters in a room of chambers
  *
+ * \param dun the current generation data
  * \param c the current chunk being generated
  * \param y1 the limits of the vault
  * \param x1 the limits of the vault
@@ -331,8 +330,8 @@ void get_vault_monsters(struct chunk *c, char racial_symbol[], char *vault_type,
  * \param name the name of the monster type for use in mon_restrict()
  * \param area the total room area, used for scaling monster quantity
  */
-void get_chamber_monsters(struct chunk *c, int y1, int x1, int y2, int x2, 
-	char *name, int area)
+void get_chamber_monsters(struct dun_data *dun, struct chunk *c, int y1, int x1,
+		int y2, int x2, char *name, int area)
 {
 	int i, y, x;
 	int16_t monsters_left, depth;
@@ -345,7 +344,7 @@ void get_chamber_monsters(struct chunk *c, int y1, int x1, int y2, int x2,
 	if (!random) {
 		while (true) {
 			/* Choose a pit profile */
-			set_pit_type(depth, 0);
+			set_pit_type(dun, depth, 0);
 
 			/* Check if the pit was set correctly
 			   Done currently by checking if a name was saved */
@@ -56,17 +56,41 @@
  */
 static struct room_template *random_room_template(int typ, int rating)
 {
-	struct room_template *t = room_templates;
-	struct room_template *r = NULL;
-	int n = 1;
-	do {
-		if ((t->typ == typ) && (t->rat == rating)) {
-			if (one_in_(n)) r = t;
-			n++;
-		}
-		t = t->next;
-	} while(t);
-	return r;
+	int key = (typ << 8) | rating;
+	int lo = 0, hi = room_template_max, first;
+
+	/* Find the first template of the kind, then the first after them */
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+		const struct room_template *t = room_template_index[mid];
+
+		if (((t->typ << 8) | t->rat) < key) lo = mid + 1; else hi = mid;
+	}
+	first = lo;
+	hi = room_template_max;
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+		const struct room_template *t = room_template_index[mid];
+
+		if (((t->typ << 8) | t->rat) <= key) lo = mid + 1; else hi = mid;
+	}
+	if (lo == first) return NULL;
+	return room_template_index[first + randint0(lo - first)];
+}
+
+/**
+ * Find the index of the vaults of a particular type.
+ * \param typ vault type
+ * \return the index, or NULL if there are no vaults of the type
+ */
+static const struct vault_type *find_vault_type(const char *typ)
+{
+	int i;
+
+	for (i = 0; i < vault_type_max; i++) {
+		if (streq(vault_types[i].name, typ)) return &vault_types[i];
+	}
+	return NULL;
 }
 
 /**
@@ -77,17 +101,37 @@ static struct room_template *random_room_template(int typ, int rating)
  */
 struct vault *random_vault(int depth, const char *typ)
 {
-	struct vault *v = vaults;
+	const struct vault_type *t = find_vault_type(typ);
 	struct vault *r = NULL;
-	int n = 1;
-	do {
-		if (streq(v->typ, typ) && (v->min_lev <= depth)
-			&& (v->max_lev >= depth)) {
+	int lo = 0, hi, i, n = 1;
+
+	if (!t) return NULL;
+
+	/* Find the vaults shallow enough for the depth */
+	hi = t->count;
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+
+		if (t->by_depth[mid]->min_lev <= depth) lo = mid + 1; else hi = mid;
+	}
+
+	/* Most of those go deep enough too, so one chosen at random usually
+	 * fits */
+	for (i = 0; i < 10 && lo; i++) {
+		struct vault *v = t->by_depth[randint0(lo)];
+
+		if (v->max_lev >= depth) return v;
+	}
+
+	/* Otherwise choose from the ones which fit */
+	for (i = 0; i < lo; i++) {
+		struct vault *v = t->by_depth[i];
+
+		if (v->max_lev >= depth) {
 			if (one_in_(n)) r = v;
 			n++;
 		}
-		v = v->next;
-	} while(v);
+	}
 	return r;
 }
 
@@ -99,30 +143,39 @@ struct vault *random_vault(int depth, const char *typ)
  */
 struct vault *named_vault(const char *name, const char *typ)
 {
-	struct vault *v = vaults;
-	do {
-		if (typ && streq(v->typ, typ))
-			if (streq(v->name, name))
-				return v;
-		v = v->next;
-	} while(v);
+	const struct vault_type *t = typ ? find_vault_type(typ) : NULL;
+	int lo = 0, hi;
+
+	if (!t) return NULL;
+	hi = t->count;
+
+	/* Find the first not before it; the sort keeps file order for ties */
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+
+		if (strcmp(t->by_name[mid]->name, name) < 0) lo = mid + 1;
+		else hi = mid;
+	}
+	if (lo < t->count && streq(t->by_name[lo]->name, name))
+		return t->by_name[lo];
 	return NULL;
 }
 
 
 /**
  * ------------------------------------------------------------------------
- * Helper functions to fill in information in the global dun (see also
+ * Helper functions to fill in information in the generation data (see also
  * find_space(), room_build(), and build_staircase() which set cent_n and
  * cent in that structure)
  * ------------------------------------------------------------------------
  */
 /**
- * Append a grid to the marked entrances for a room in the global dun.
+ * Append a grid to the marked entrances for a room in the generation data.
+ * \param dun Is the current generation data
  * \param grid Is the location for the entrance
  * Only call after the centre has been set and cent_n incremented.
  */
-static void append_entrance(struct loc grid)
+static void append_entrance(struct dun_data *dun, struct loc grid)
 {
 	int ridx;
 
@@ -896,58 +949,63 @@ extern bool generate_starburst_room(struct chunk *c, int y1, int x1, int y2,
 	return (true);
 }
 
+/**
+ * The pit profile mon_pit_hook() picks monsters for
+ */
+static const struct pit_profile *pit_hook_type;
+
 /**
  * Hook for picking monsters appropriate to a nest/pit or region.
  * \param race the race being tested for inclusion
  * \return the race is acceptable
- * Requires dun->pit_type to be set.
+ * Requires prep_pit_monsters() to have been called.
  */
 bool mon_pit_hook(struct monster_race *race)
 {
 	bool match_base = true;
 	bool match_color = true;
-	int innate_freq = dun->pit_type->freq_innate;
+	int innate_freq = pit_hook_type->freq_innate;
 
 	assert(race);
-	assert(dun->pit_type);
+	assert(pit_hook_type);
 
 	if (rf_has(race->flags, RF_UNIQUE)) {
 		return false;
-	} else if (!rf_is_subset(race->flags, dun->pit_type->flags)) {
+	} else if (!rf_is_subset(race->flags, pit_hook_type->flags)) {
 		return false;
-	} else if (rf_is_inter(race->flags, dun->pit_type->forbidden_flags)) {
+	} else if (rf_is_inter(race->flags, pit_hook_type->forbidden_flags)) {
 		return false;
-	} else if (!rsf_is_subset(race->spell_flags, dun->pit_type->spell_flags)) {
+	} else if (!rsf_is_subset(race->spell_flags, pit_hook_type->spell_flags)) {
 		return false;
 	} else if (rsf_is_inter(race->spell_flags,
-							dun->pit_type->forbidden_spell_flags)) {
+							pit_hook_type->forbidden_spell_flags)) {
 		return false;
 	} else if (race->freq_innate < innate_freq) {
 		return false;
-	} else if (dun->pit_type->forbidden_monsters) {
+	} else if (pit_hook_type->forbidden_monsters) {
 		struct pit_forbidden_monster *monster;
-		for (monster = dun->pit_type->forbidden_monsters; monster;
+		for (monster = pit_hook_type->forbidden_monsters; monster;
 			 monster = monster->next) {
 			if (race == monster->race)
 				return false;
 		}
 	}
 
-	if (dun->pit_type->bases) {
+	if (pit_hook_type->bases) {
 		struct pit_monster_profile *bases;
 		match_base = false;
 
-		for (bases = dun->pit_type->bases; bases; bases = bases->next) {
+		for (bases = pit_hook_type->bases; bases; bases = bases->next) {
 			if (race->base == bases->base)
 				match_base = true;
 		}
 	}
 	
-	if (dun->pit_type->colors) {
+	if (pit_hook_type->colors) {
 		struct pit_color_profile *colors;
 		match_color = false;
 
-		for (colors = dun->pit_type->colors; colors; colors = colors->next) {
+		for (colors = pit_hook_type->colors; colors; colors = colors->next) {
 			if (race->d_attr == colors->color)
 				match_color = true;
 		}
@@ -956,6 +1014,16 @@ bool mon_pit_hook(struct monster_race *race)
 	return (match_base && match_color);
 }
 
+/**
+ * Prepare the monster allocation table for monsters fitting a pit profile.
+ * \param pit the pit profile
+ */
+void prep_pit_monsters(const struct pit_profile *pit)
+{
+	pit_hook_type = pit;
+	get_mon_num_prep(mon_pit_hook);
+}
+
 /**
  * Pick a type of monster for pits (or other purposes), based on the level.
  * 
@@ -964,11 +1032,12 @@ bool mon_pit_hook(struct monster_race *race)
  * standard deviation of 10. Then we pick the profile that gave us a depth that
  * is closest to the player's actual depth.
  *
- * Sets dun->pit_type, which is required for mon_pit_hook.
+ * Sets dun->pit_type, for prep_pit_monsters().
+ * \param dun is the current generation data
  * \param depth is the pit profile depth to aim for in selection
  * \param type is 1 for pits, 2 for nests, 0 for any profile
  */
-void set_pit_type(int depth, int type)
+void set_pit_type(struct dun_data *dun, int depth, int type)
 {
 	int i;
 	int pit_idx = 0;
@@ -998,6 +1067,7 @@ void set_pit_type(int depth, int type)
 
 /**
  * Check that a rectangular range has not been reserved in the block map.
+ * \param dun Is the current generation data
  * \param by1 Is the y block coordinate for the top left corner of the range.
  * \param bx1 Is the x block coordinate for the top left corner of the range.
  * \param by2 Is the y block coordinate for the bottom right corner.
@@ -1005,7 +1075,8 @@ void set_pit_type(int depth, int type)
  * \return Return true if the complete range has not been reserved and falls
  * within the bounds of the map.  Otherwise, return false.
  */
-static bool check_for_unreserved_blocks(int by1, int bx1, int by2, int bx2)
+static bool check_for_unreserved_blocks(struct dun_data *dun, int by1, int bx1,
+		int by2, int bx2)
 {
 	int by, bx;
 
@@ -1024,12 +1095,14 @@ static bool check_for_unreserved_blocks(int by1, int bx1, int by2, int bx2)
 
 /**
  * Reserve a rectangular range in the block map.
+ * \param dun Is the current generation data
  * \param by1 Is the y block coordinate for the top left corner of the range.
  * \param bx1 Is the x block coordinate for the top left corner of the range.
  * \param by2 Is the y block coordinate for the bottom right corner.
  * \param bx2 Is the x block coordinate for the bottom right corner.
  */
-static void reserve_blocks(int by1, int bx1, int by2, int bx2)
+static void reserve_blocks(struct dun_data *dun, int by1, int bx1, int by2,
+		int bx2)
 {
 	int by, bx;
 
@@ -1043,6 +1116,7 @@ static void reserve_blocks(int by1, int bx1, int by2, int bx2)
 /**
  * Find a good spot for the next room.
  *
+ * \param dun the current generation data
  * \param y centre of the room
  * \param x centre of the room
  * \param height dimensions of the room
@@ -1059,7 +1133,8 @@ static void reserve_blocks(int by1, int bx1, int by2, int bx2)
  * Return true and values for the center of the room if all went well.
  * Otherwise, return false.
  */
-static bool find_space(struct loc *centre, int height, int width)
+static bool find_space(struct dun_data *dun, struct loc *centre, int height,
+		int width)
 {
 	int i;
 	int by1, bx1, by2, bx2;
@@ -1078,7 +1153,8 @@ static bool find_space(struct loc *centre, int height, int width)
 		by2 = by1 + blocks_high - 1;
 		bx2 = bx1 + blocks_wide - 1;
 
-		if (!check_for_unreserved_blocks(by1, bx1, by2, bx2)) continue;
+		if (!check_for_unreserved_blocks(dun, by1, bx1, by2,
+			bx2)) continue;
 
 		/* Get the location of the room */
 		centre->y = ((by1 + by2 + 1) * dun->block_hgt) / 2;
@@ -1090,7 +1166,7 @@ static bool find_space(struct loc *centre, int height, int width)
 			dun->cent_n++;
 		}
 
-		reserve_blocks(by1, bx1, by2, bx2);
+		reserve_blocks(dun, by1, bx1, by2, bx2);
 
 		/* Success. */
 		return (true);
@@ -1102,6 +1178,7 @@ static bool find_space(struct loc *centre, int height, int width)
 
 /**
  * Build a room template from its string representation.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param ymax the room dimensions
@@ -1112,7 +1189,8 @@ static bool find_space(struct loc *centre, int height, int width)
  * \param flags the flags for the room
  * \return success
  */
-static bool build_room_template(struct chunk *c, struct loc centre, int ymax,
+static bool build_room_template(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int ymax,
 	int xmax, int doors, const char *data, int tval,
 	const bitflag flags[ROOMF_SIZE])
 {
@@ -1141,7 +1219,7 @@ static bool build_room_template(struct chunk *c, struct loc centre, int ymax,
 			&rotate, &reflect, &tymax, &txmax);
 		event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE,
 			tymax + 2, txmax + 2);
-		if (!find_space(&centre, tymax + 2, txmax + 2))
+		if (!find_space(dun, &centre, tymax + 2, txmax + 2))
 			return (false);
 	} else {
 		/* Given the preset centre, don't allow transposition. */
@@ -1179,7 +1257,7 @@ static bool build_room_template(struct chunk *c, struct loc centre, int ymax,
 			case '%': {
 				set_marked_granite(c, grid, SQUARE_WALL_OUTER);
 				if (roomf_has(flags, ROOMF_FEW_ENTRANCES)) {
-					append_entrance(grid);
+					append_entrance(dun, grid);
 				}
 				break;
 			}
@@ -1338,14 +1416,15 @@ static bool build_room_template(struct chunk *c, struct loc centre, int ymax,
 
 /**
  * Helper function for building room templates.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param typ template room type to select
  * \param rating template room rating to select
  * \return success
  */
-static bool build_room_template_type(struct chunk *c, struct loc centre,
-									 int typ, int rating)
+static bool build_room_template_type(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int typ, int rating)
 {
 	struct room_template *room = random_room_template(typ, rating);
 	
@@ -1354,7 +1433,8 @@ static bool build_room_template_type(struct chunk *c, struct loc centre,
 
 	/* Build the room */
 	event_signal_string(EVENT_GEN_ROOM_CHOOSE_SUBTYPE, room->name);
-	if (!build_room_template(c, centre, room->hgt, room->wid, room->dor,
+	if (!build_room_template(dun, c, centre, room->hgt, room->wid,
+		room->dor,
 			room->text, room->tval, room->flags))
 		return false;
 
@@ -1379,18 +1459,19 @@ static void place_quest_monster(struct chunk *c, struct loc grid, int index)
 
 /**
  * Build a vault from its string representation.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param v pointer to the vault template
  * \return success
  */
-bool build_vault(struct chunk *c, struct loc centre, struct vault *v)
+bool build_vault(struct dun_data *dun, struct chunk *c, struct loc centre,
+		struct vault *v)
 {
 	const char *data = v->text;
 	int y1, x1, y2, x2;
-	int x, y, races_local = 0;
+	int x, y;
 	const char *t;
-	char racial_symbol[30] = "";
 	bool icky;
 	int rotate, thgt, twid;
 	bool reflect;
@@ -1416,7 +1497,7 @@ bool build_vault(struct chunk *c, struct loc centre, struct vault *v)
 			&rotate, &reflect, &thgt, &twid);
 		event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE,
 			thgt + 2, twid + 2);
-		if (!find_space(&centre, thgt + 2, twid + 2))
+		if (!find_space(dun, &centre, thgt + 2, twid + 2))
 			return (false);
 	} else {
 		/* Given the preset centre, don't allow transposition. */
@@ -1472,7 +1553,7 @@ bool build_vault(struct chunk *c, struct loc centre, struct vault *v)
 				 * allowed to remove this wall. */
 				set_marked_granite(c, grid, SQUARE_WALL_OUTER);
 				if (roomf_has(v->flags, ROOMF_FEW_ENTRANCES)) {
-					append_entrance(grid);
+					append_entrance(dun, grid);
 				}
 				icky = false;
 				break;
@@ -1555,18 +1636,9 @@ bool build_vault(struct chunk *c, struct loc centre, struct vault *v)
 			/* Hack -- skip "non-grids" */
 			if (*t == ' ') continue;
 
-			/* Most alphabetic characters signify monster races. */
-			if (isalpha(*t) && (*t != 'x') && (*t != 'X')) {
-				/* If the symbol is not yet stored, ... */
-				if (!strchr(racial_symbol, *t)) {
-					/* ... store it for later processing. */
-					if (races_local < (int)sizeof(racial_symbol))
-						racial_symbol[races_local++] = *t;
-				}
-			}
-
-			/* Otherwise, analyze the symbol */
-			else
+			/* Most alphabetic characters signify monster races,
+			 * placed below; otherwise, analyze the symbol */
+			if (!isalpha(*t) || (*t == 'x') || (*t == 'X'))
 				switch (*t) {
 					/* An ordinary monster, object (sometimes good), or trap. */
 				case '1': {
@@ -1757,21 +1829,22 @@ bool build_vault(struct chunk *c, struct loc centre, struct vault *v)
 	}
 
 	/* Place specified monsters */
-	get_vault_monsters(c, racial_symbol, v->typ, data, y1, y2, x1, x2);
+	get_vault_monsters(c, v->races, v->typ, data, y1, y2, x1, x2);
 
 	return true;
 }
 
 /**
  * Helper function for building vaults.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param typ the vault type
  * \param label name of the vault type (eg "Greater vault")
  * \return success
  */
-static bool build_vault_type(struct chunk *c, struct loc centre,
-							 const char *typ)
+static bool build_vault_type(struct dun_data *dun, struct chunk *c,
+		struct loc centre, const char *typ)
 {
 	struct vault *v = random_vault(c->depth, typ);
 	if (v == NULL) {
@@ -1780,7 +1853,7 @@ static bool build_vault_type(struct chunk *c, struct loc centre,
 	}
 
 	/* Build the vault */
-	if (!build_vault(c, centre, v))
+	if (!build_vault(dun, c, centre, v))
 		return false;
 
 	ROOM_LOG("%s (%s)", typ, v->name);
@@ -1940,7 +2013,8 @@ static void hollow_out_room(struct chunk *c, struct loc grid)
  * Build a staircase to connect with a previous staircase on the level one up
  * or (occasionally) one down
  */
-bool build_staircase(struct chunk *c, struct loc centre, int rating)
+bool build_staircase(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	struct connector *join = dun->curr_join;
 
@@ -1982,11 +2056,12 @@ bool build_staircase(struct chunk *c, struct loc centre, int rating)
 
 			if (cave_find_in_range(c, &rg, tl, br, square_isroom))
 				return false;
-		} else if (!check_for_unreserved_blocks(by1, bx1, by2, bx2)) {
+		} else if (!check_for_unreserved_blocks(dun, by1, bx1, by2,
+			bx2)) {
 			return false;
 		}
 
-		reserve_blocks(by1, bx1, by2, bx2);
+		reserve_blocks(dun, by1, bx1, by2, bx2);
 
 		/* Save the room location */
 		if (dun->cent_n < z_info->level_room_max) {
@@ -2013,11 +2088,13 @@ bool build_staircase(struct chunk *c, struct loc centre, int rating)
 
 /**
  * Build a circular room (interior radius 4-7).
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \return success
  */
-bool build_circular(struct chunk *c, struct loc centre, int rating)
+bool build_circular(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	/* Pick a room size */
 	int radius = 2 + randint1(2) + randint1(3);
@@ -2029,7 +2106,7 @@ bool build_circular(struct chunk *c, struct loc centre, int rating)
 	event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE,
 		2 * radius + 10, 2 * radius + 10);
 	if ((centre.y >= c->height) || (centre.x >= c->width)) {
-		if (!find_space(&centre, 2 * radius + 10, 2 * radius + 10))
+		if (!find_space(dun, &centre, 2 * radius + 10, 2 * radius + 10))
 			return (false);
 	}
 
@@ -2070,11 +2147,13 @@ bool build_circular(struct chunk *c, struct loc centre, int rating)
 
 /**
  * Builds a normal rectangular room.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \return success
  */
-bool build_simple(struct chunk *c, struct loc centre, int rating)
+bool build_simple(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	int y, x, y1, x1, y2, x2;
 	int light = false;
@@ -2086,7 +2165,7 @@ bool build_simple(struct chunk *c, struct loc centre, int rating)
 	/* Find and reserve some space in the dungeon.  Get center of room. */
 	event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE, height + 2, width + 2);
 	if ((centre.y >= c->height) || (centre.x >= c->width)) {
-		if (!find_space(&centre, height + 2, width + 2))
+		if (!find_space(dun, &centre, height + 2, width + 2))
 			return (false);
 	}
 
@@ -2180,11 +2259,13 @@ bool build_simple(struct chunk *c, struct loc centre, int rating)
 
 /**
  * Builds an overlapping rectangular room.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \return success
  */
-bool build_overlap(struct chunk *c, struct loc centre, int rating)
+bool build_overlap(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	int y1a, x1a, y2a, x2a;
 	int y1b, x1b, y2b, x2b;
@@ -2214,7 +2295,7 @@ bool build_overlap(struct chunk *c, struct loc centre, int rating)
 	/* Find and reserve some space in the dungeon.  Get center of room. */
 	event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE, height + 2, width + 2);
 	if ((centre.y >= c->height) || (centre.x >= c->width)) {
-		if (!find_space(&centre, height + 2, width + 2))
+		if (!find_space(dun, &centre, height + 2, width + 2))
 			return (false);
 	}
 
@@ -2256,6 +2337,7 @@ bool build_overlap(struct chunk *c, struct loc centre, int rating)
 
 /**
  * Builds a cross-shaped room.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \return success
@@ -2267,7 +2349,8 @@ bool build_overlap(struct chunk *c, struct loc centre, int rating)
  * below will work for 5x5 (and perhaps even for unsymetric values like 4x3 or
  * 5x3 or 3x4 or 3x5).
  */
-bool build_crossed(struct chunk *c, struct loc centre, int rating)
+bool build_crossed(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	int y, x;
 	int height, width;
@@ -2309,7 +2392,7 @@ bool build_crossed(struct chunk *c, struct loc centre, int rating)
 	/* Find and reserve some space in the dungeon.  Get center of room. */
 	event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE, height + 2, width + 2);
 	if (centre.y >= c->height || centre.x >= c->width) {
-		if (!find_space(&centre, height + 2, width + 2))
+		if (!find_space(dun, &centre, height + 2, width + 2))
 			return (false);
 	}
 
@@ -2431,6 +2514,7 @@ bool build_crossed(struct chunk *c, struct loc centre, int rating)
 
 /**
  * Build a large room with an inner room.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \return success
@@ -2442,7 +2526,8 @@ bool build_crossed(struct chunk *c, struct loc centre, int rating)
  *	4 - An inner room with a checkerboard
  *	5 - An inner room with four compartments
  */
-bool build_large(struct chunk *c, struct loc centre, int rating)
+bool build_large(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	int y, x, y1, x1, y2, x2;
 	int height = 9;
@@ -2456,7 +2541,7 @@ bool build_large(struct chunk *c, struct loc centre, int rating)
 	/* Find and reserve some space in the dungeon.  Get center of room. */
 	event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE, height + 2, width + 2);
 	if ((centre.y >= c->height) || (centre.x >= c->width)) {
-		if (!find_space(&centre, height + 2, width + 2))
+		if (!find_space(dun, &centre, height + 2, width + 2))
 			return (false);
 	}
 
@@ -2673,6 +2758,7 @@ bool build_large(struct chunk *c, struct loc centre, int rating)
 
 /**
  * Build a monster nest
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \return success
@@ -2694,7 +2780,8 @@ bool build_large(struct chunk *c, struct loc centre, int rating)
  *
  * Monster nests will never contain unique monsters.
  */
-bool build_nest(struct chunk *c, struct loc centre, int rating)
+bool build_nest(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	struct loc grid;
 	int y1, x1, y2, x2;
@@ -2711,7 +2798,7 @@ bool build_nest(struct chunk *c, struct loc centre, int rating)
 	/* Find and reserve some space in the dungeon.  Get center of room. */
 	event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE, height + 2, width + 2);
 	if ((centre.y >= c->height) || (centre.x >= c->width)) {
-		if (!find_space(&centre, height + 2, width + 2))
+		if (!find_space(dun, &centre, height + 2, width + 2))
 			return (false);
 	}
 
@@ -2743,14 +2830,14 @@ bool build_nest(struct chunk *c, struct loc centre, int rating)
 	generate_hole(c, y1 - 1, x1 - 1, y2 + 1, x2 + 1, FEAT_CLOSED);
 
 	/* Decide on the pit type */
-	set_pit_type(c->depth, 2);
+	set_pit_type(dun, c->depth, 2);
 	event_signal_string(EVENT_GEN_ROOM_CHOOSE_SUBTYPE, dun->pit_type->name);
 
 	/* Chance of objects on the floor */
 	alloc_obj = dun->pit_type->obj_rarity;
 	
 	/* Prepare allocation table */
-	get_mon_num_prep(mon_pit_hook);
+	prep_pit_monsters(dun->pit_type);
 
 	/* Pick some monster types */
 	for (i = 0; i < 64; i++) {
@@ -2793,6 +2880,7 @@ bool build_nest(struct chunk *c, struct loc centre, int rating)
 
 /**
  * Build a monster pit
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating is not used for this room type
@@ -2826,7 +2914,8 @@ bool build_nest(struct chunk *c, struct loc centre, int rating)
  *
  * Like monster nests, monster pits will never contain unique monsters.
  */
-bool build_pit(struct chunk *c, struct loc centre, int rating)
+bool build_pit(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	struct monster_race *what[16];
 	int i, j, y, x, y1, x1, y2, x2;
@@ -2841,7 +2930,7 @@ bool build_pit(struct chunk *c, struct loc centre, int rating)
 	/* Find and reserve some space in the dungeon.  Get center of room. */
 	event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE, height + 2, width + 2);
 	if ((centre.y >= c->height) || (centre.x >= c->width)) {
-		if (!find_space(&centre, height + 2, width + 2))
+		if (!find_space(dun, &centre, height + 2, width + 2))
 			return (false);
 	}
 
@@ -2869,14 +2958,14 @@ bool build_pit(struct chunk *c, struct loc centre, int rating)
 	generate_hole(c, y1 - 1, x1 - 1, y2 + 1, x2 + 1, FEAT_CLOSED);
 
 	/* Decide on the pit type */
-	set_pit_type(c->depth, 1);
+	set_pit_type(dun, c->depth, 1);
 	event_signal_string(EVENT_GEN_ROOM_CHOOSE_SUBTYPE, dun->pit_type->name);
 
 	/* Chance of objects on the floor */
 	alloc_obj = dun->pit_type->obj_rarity;
 	
 	/* Prepare allocation table */
-	get_mon_num_prep(mon_pit_hook);
+	prep_pit_monsters(dun->pit_type);
 
 	/* Pick some monster types */
 	for (i = 0; i < 16; i++) {
@@ -3020,98 +3109,113 @@ bool build_pit(struct chunk *c, struct loc centre, int rating)
 
 /**
  * Build a template room
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating template room rating to select
  * \return success
 */
-bool build_template(struct chunk *c, struct loc centre, int rating)
+bool build_template(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	/* All room templates currently have type 1 */
-	return build_room_template_type(c, centre, 1, rating);
+	return build_room_template_type(dun, c, centre, 1, rating);
 }
 
 
 
 /**
  * Build a shaped room.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  *\ param centre the room centre; out of chunk centre invokes find_space()
  * \return success
  */
-bool build_shaped(struct chunk *c, struct loc centre, int rating)
+bool build_shaped(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
-	return build_vault_type(c, centre, "Shaped room");
+	return build_vault_type(dun, c, centre, "Shaped room");
 }
 
 
 /**
  * Build an interesting room.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating is not used for this room type
  * \return success
  */
-bool build_interesting(struct chunk *c, struct loc centre, int rating)
+bool build_interesting(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
-	return build_vault_type(c, centre, "Interesting room");
+	return build_vault_type(dun, c, centre, "Interesting room");
 }
 
 
 /**
  * Build a lesser vault.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating is not used for this room type
  * \return success
  */
-bool build_lesser_vault(struct chunk *c, struct loc centre, int rating)
+bool build_lesser_vault(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
-	return build_vault_type(c, centre, "Lesser vault");
+	return build_vault_type(dun, c, centre, "Lesser vault");
 }
 
 
 /**
  * Build a lesser new-style vault.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating is not used for this room type
  * \return success
  */
-bool build_lesser_new_vault(struct chunk *c, struct loc centre, int rating)
+bool build_lesser_new_vault(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
-	return build_vault_type(c, centre, "Lesser vault (new)");
+	return build_vault_type(dun, c, centre, "Lesser vault (new)");
 }
 
 
 /**
  * Build a medium vault.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating is not used for this room type
  * \return success
  */
-bool build_medium_vault(struct chunk *c, struct loc centre, int rating)
+bool build_medium_vault(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
-	return build_vault_type(c, centre, "Medium vault");
+	return build_vault_type(dun, c, centre, "Medium vault");
 }
 
 
 /**
  * Build a medium new-style vault.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating is not used for this room type
  * \return success
  */
-bool build_medium_new_vault(struct chunk *c, struct loc centre, int rating)
+bool build_medium_new_vault(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
-	return build_vault_type(c, centre, "Medium vault (new)");
+	return build_vault_type(dun, c, centre, "Medium vault (new)");
 }
 
 
 /**
  * Help greater_vault() or greater_new_vault().
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param name is the name of the type to build, i.e. "Greater vault" or
@@ -3139,8 +3243,8 @@ bool build_medium_new_vault(struct chunk *c, struct loc centre, int rating)
  * 50-59  1.8 -  2.1%
  * 0-49   0.0 -  1.0%
  */
-static bool help_greater_vault(struct chunk *c, struct loc centre,
-		const char *name)
+static bool help_greater_vault(struct dun_data *dun, struct chunk *c,
+		struct loc centre, const char *name)
 {
 	int i;
 	int numerator   = 1;
@@ -3165,51 +3269,58 @@ static bool help_greater_vault(struct chunk *c, struct loc centre,
 	/* Non-classic profiles need to adjust the probability */
 	if (!streq(dun->profile->name, "classic") && !one_in_(3)) return false;
 
-	return build_vault_type(c, centre, name);
+	return build_vault_type(dun, c, centre, name);
 }
 
 
 /**
  * Build a greater vault.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating is not used for this room type
  * \return success
  */
-bool build_greater_vault(struct chunk *c, struct loc centre, int rating)
+bool build_greater_vault(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
-	return help_greater_vault(c, centre, "Greater vault");
+	return help_greater_vault(dun, c, centre, "Greater vault");
 }
 
 
 /**
  * Build a greater new-style vault.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating is not used for this room type
  * \return success
  */
-bool build_greater_new_vault(struct chunk *c, struct loc centre, int rating)
+bool build_greater_new_vault(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
-	return help_greater_vault(c, centre, "Greater vault (new)");
+	return help_greater_vault(dun, c, centre, "Greater vault (new)");
 }
 
 /**
  * Build a quest vault - no checks.
  */
-bool build_quest_vault(struct chunk *c, struct loc centre, int rating)
+bool build_quest_vault(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
-	return build_vault_type(c, centre, "Quest");
+	return build_vault_type(dun, c, centre, "Quest");
 }
 
 /**
  * Moria room (from Oangband).  Uses the "starburst room" code.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating is not used for this room type
  * \return success
  */
-bool build_moria(struct chunk *c, struct loc centre, int rating)
+bool build_moria(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	int y1, x1, y2, x2;
 	int i;
@@ -3240,7 +3351,7 @@ bool build_moria(struct chunk *c, struct loc centre, int rating)
 
 		/* Find and reserve some space in the dungeon.  Get center of room. */
 		if ((centre.y >= c->height) || (centre.x >= c->width)) {
-			if (!find_space(&centre, height, width)) {
+			if (!find_space(dun, &centre, height, width)) {
 				if (i == 0) continue;  /* Failed first attempt */
 				event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE,
 					height, width);
@@ -3285,6 +3396,7 @@ bool build_moria(struct chunk *c, struct loc centre, int rating)
 
 /**
  * Rooms of chambers
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating is not used for this room type
@@ -3310,7 +3422,8 @@ bool build_moria(struct chunk *c, struct loc centre, int rating)
  * monsters.
  *
  */
-bool build_room_of_chambers(struct chunk *c, struct loc centre, int rating)
+bool build_room_of_chambers(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	int i, d;
 	int area, num_chambers;
@@ -3330,7 +3443,7 @@ bool build_room_of_chambers(struct chunk *c, struct loc centre, int rating)
 	/* Find and reserve some space in the dungeon.  Get center of room. */
 	event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE, height, width);
 	if ((centre.y >= c->height) || (centre.x >= c->width)) {
-		if (!find_space(&centre, height, width))
+		if (!find_space(dun, &centre, height, width))
 			return (false);
 	}
 
@@ -3579,7 +3692,7 @@ bool build_room_of_chambers(struct chunk *c, struct loc centre, int rating)
 	}
 
 	/*** Now we get to place the monsters. ***/
-	get_chamber_monsters(c, y1, x1, y2, x2, name, height * width);
+	get_chamber_monsters(dun, c, y1, x1, y2, x2, name, height * width);
 
 	/* Increase the level rating */
 	c->mon_rating += 10;
@@ -3595,6 +3708,7 @@ bool build_room_of_chambers(struct chunk *c, struct loc centre, int rating)
  * A single starburst-shaped room of extreme size, usually dotted or
  * even divided with irregularly-shaped fields of rubble. No special
  * monsters.  Appears deeper than level 40.
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param centre the room centre; out of chunk centre invokes find_space()
  * \param rating is not used for this room type
@@ -3604,7 +3718,8 @@ bool build_room_of_chambers(struct chunk *c, struct loc centre, int rating)
  * priority rooms in the dungeon.  They should be rare, so as not to
  * interfere with greater vaults.
  */
-bool build_huge(struct chunk *c, struct loc centre, int rating)
+bool build_huge(struct dun_data *dun, struct chunk *c,
+		struct loc centre, int rating)
 {
 	bool finding_space = centre.y >= c->height || centre.x >= c->width;
 	bool light;
@@ -3634,7 +3749,7 @@ bool build_huge(struct chunk *c, struct loc centre, int rating)
 	/* Find and reserve some space.  Get center of room. */
 	event_signal_size(EVENT_GEN_ROOM_CHOOSE_SIZE, height, width);
 	if (finding_space) {
-		if (!find_space(&centre, height, width))
+		if (!find_space(dun, &centre, height, width))
 			return (false);
 	}
 
@@ -3682,6 +3797,7 @@ bool build_huge(struct chunk *c, struct loc centre, int rating)
 /**
  * Attempt to build a room of the given type at the given block
  *
+ * \param dun the current generation data
  * \param c the chunk the room is being built in
  * \param by0 block co-ordinates of the top left block
  * \param bx0 block co-ordinates of the top left block
@@ -3696,8 +3812,8 @@ bool build_huge(struct chunk *c, struct loc centre, int rating)
  * Note that we restrict the number of pits/nests to reduce
  * the chance of overflowing the monster list during level creation.
  */
-bool room_build(struct chunk *c, int by0, int bx0, struct room_profile profile,
-	bool finds_own_space)
+bool room_build(struct dun_data *dun, struct chunk *c, int by0, int bx0,
+		struct room_profile profile, bool finds_own_space)
 {
 	/* Extract blocks */
 	int by1 = by0;
@@ -3727,13 +3843,13 @@ bool room_build(struct chunk *c, int by0, int bx0, struct room_profile profile,
 	/* Does the profile allocate space, or the room find it? */
 	if (finds_own_space) {
 		/* Try to build a room, pass silly place so room finds its own */
-		if (!profile.builder(c, loc(c->width, c->height),
+		if (!profile.builder(dun, c, loc(c->width, c->height),
 				profile.rating)) {
 			event_signal_flag(EVENT_GEN_ROOM_END, false);
 			return false;
 		}
 	} else {
-		if (!check_for_unreserved_blocks(by1, bx1, by2, bx2)) {
+		if (!check_for_unreserved_blocks(dun, by1, bx1, by2, bx2)) {
 			event_signal_flag(EVENT_GEN_ROOM_END, false);
 			return false;
 		}
@@ -3750,13 +3866,13 @@ bool room_build(struct chunk *c, int by0, int bx0, struct room_profile profile,
 		}
 
 		/* Try to build a room */
-		if (!profile.builder(c, centre, profile.rating)) {
+		if (!profile.builder(dun, c, centre, profile.rating)) {
 			--dun->cent_n;
 			event_signal_flag(EVENT_GEN_ROOM_END, false);
 			return false;
 		}
 
-		reserve_blocks(by1, bx1, by2, bx2);
+		reserve_blocks(dun, by1, bx1, by2, bx2);
 	}
 
 	/* Count pit/nests rooms */
@@ -230,7 +230,7 @@ bool cave_find(struct chunk *c, struct loc *grid, square_predicate pred)
  */
 bool find_empty(struct chunk *c, struct loc *grid)
 {
-	return cave_find(c, grid, square_isempty);
+	return cave_find_floor(c, grid, square_isempty);
 }
 
 
@@ -314,13 +314,9 @@ void rand_dir(struct loc *offset)
 static bool find_start(struct chunk *c, struct loc *grid)
 {
 	/* Find the best possible place */
-	if (cave_find_in_range(c, grid, loc(1, 1),
-			loc(c->width - 2, c->height - 2),
-			square_suits_stairs_well)) {
+	if (cave_find_floor(c, grid, square_suits_stairs_well)) {
 		return true;
-	} else if (cave_find_in_range(c, grid, loc(1, 1),
-			loc(c->width - 2, c->height - 2),
-			square_suits_stairs_ok)) {
+	} else if (cave_find_floor(c, grid, square_suits_stairs_ok)) {
 		return true;
 	} else {
 		int walls = 6;
@@ -333,9 +329,7 @@ static bool find_start(struct chunk *c, struct loc *grid)
 			for (j = 0; j < 10000; j++) {
 				int total_walls = 0;
 
-				if (!cave_find_in_range(c, grid, loc(1, 1),
-								   loc(c->width - 2, c->height - 2),
-								   square_isempty)) continue;
+				if (!find_empty(c, grid)) continue;
 				if ((square_isvault(c, *grid) && (player->active_quest < 0)) || square_isno_stairs(c, *grid)) {
 					continue;
 				}
@@ -705,6 +699,24 @@ void alloc_objects(struct chunk *c, int set, int typ, int num, int depth,
 }
 
 
+/**
+ * Determine whether a square is an empty one outside any room.
+ */
+static bool square_isempty_corridor(struct chunk *c, struct loc grid)
+{
+	return square_isempty(c, grid) && !square_isroom(c, grid);
+}
+
+
+/**
+ * Determine whether a square is an empty one in a room.
+ */
+static bool square_isempty_room(struct chunk *c, struct loc grid)
+{
+	return square_isempty(c, grid) && square_isroom(c, grid);
+}
+
+
 /**
  * Allocates a single random object in the dungeon.
  * \param c the current chunk
@@ -718,24 +730,17 @@ void alloc_objects(struct chunk *c, int set, int typ, int num, int depth,
  */
 bool alloc_object(struct chunk *c, int set, int typ, int depth, uint8_t origin)
 {
-	int tries = 0;
 	struct loc grid;
 
 	/* Pick a "legal" spot */
-	while (tries < 2000) {
-		tries++;
-
-		if (!find_empty(c, &grid)) continue;
-
-		/* If we are ok with a corridor and we're in one, we're done */
-		if (set & SET_CORR && !square_isroom(c, grid)) break;
-
-		/* If we are ok with a room and we're in one, we're done */
-		if (set & SET_ROOM && square_isroom(c, grid)) break;
+	if (set == SET_CORR) {
+		if (!cave_find_floor(c, &grid, square_isempty_corridor)) return false;
+	} else if (set == SET_ROOM) {
+		if (!cave_find_floor(c, &grid, square_isempty_room)) return false;
+	} else if (!find_empty(c, &grid)) {
+		return false;
 	}
 
-	if (tries == 2000) return false;
-
 	/* Place something */
 	switch (typ) {
 	case TYP_RUBBLE: place_rubble(c, grid); break;
@@ -56,9 +56,12 @@
  */
 struct pit_profile *pit_info;
 struct vault *vaults;
+struct vault_type *vault_types;
+int vault_type_max;
 static struct cave_profile *cave_profiles;
-struct dun_data *dun;
 struct room_template *room_templates;
+struct room_template **room_template_index;
+int room_template_max;
 
 static const struct {
 	const char *name;
@@ -458,12 +461,85 @@ static errr run_parse_room(struct parser *p) {
 	return parse_file_quit_not_found(p, "room_template");
 }
 
+static int cmp_room_template(const void *a, const void *b)
+{
+	const struct room_template *ta = *(const struct room_template **) a;
+	const struct room_template *tb = *(const struct room_template **) b;
+
+	if (ta->typ != tb->typ) return ta->typ - tb->typ;
+	return ta->rat - tb->rat;
+}
+
+/**
+ * Index the templates by type and rating for random_room_template(), keeping
+ * those with the same type and rating in the order they were read in, so
+ * that a seeded level comes out the same whatever the C library
+ */
+static void index_room_templates(void)
+{
+	struct room_template *t;
+	int i = 0;
+
+	room_template_max = 0;
+	for (t = room_templates; t; t = t->next) room_template_max++;
+	room_template_index = mem_zalloc(room_template_max *
+		sizeof(*room_template_index));
+	for (t = room_templates; t; t = t->next) room_template_index[i++] = t;
+	sort_stable(room_template_index, room_template_max,
+		sizeof(*room_template_index), cmp_room_template);
+}
+
 static errr finish_parse_room(struct parser *p) {
 	room_templates = parser_priv(p);
 	parser_destroy(p);
+	index_room_templates();
 	return 0;
 }
 
+static void write_room_cache(struct data_cache *dc)
+{
+	struct room_template *t;
+
+	for (t = room_templates; t; t = t->next) {
+		cache_put_byte(dc, 1);
+		cache_put_string(dc, t->name);
+		cache_put_string(dc, t->text);
+		cache_put_flags(dc, t->flags, ROOMF_SIZE);
+		cache_put_byte(dc, t->typ);
+		cache_put_byte(dc, t->rat);
+		cache_put_byte(dc, t->hgt);
+		cache_put_byte(dc, t->wid);
+		cache_put_byte(dc, t->dor);
+		cache_put_byte(dc, t->tval);
+	}
+	cache_put_byte(dc, 0);
+}
+
+static bool read_room_cache(struct data_cache *dc)
+{
+	struct room_template **last = &room_templates;
+
+	room_templates = NULL;
+	while (cache_get_byte(dc) && !dc->failed) {
+		struct room_template *t = mem_zalloc(sizeof(*t));
+
+		*last = t;
+		last = &t->next;
+		t->name = cache_get_string(dc);
+		t->text = cache_get_string(dc);
+		cache_get_flags(dc, t->flags, ROOMF_SIZE);
+		t->typ = cache_get_byte(dc);
+		t->rat = cache_get_byte(dc);
+		t->hgt = cache_get_byte(dc);
+		t->wid = cache_get_byte(dc);
+		t->dor = cache_get_byte(dc);
+		t->tval = cache_get_byte(dc);
+	}
+	if (dc->failed) return false;
+	index_room_templates();
+	return true;
+}
+
 static void cleanup_room(void)
 {
 	struct room_template *t, *next;
@@ -473,6 +549,9 @@ static void cleanup_room(void)
 		mem_free(t->text);
 		mem_free(t);
 	}
+	mem_free(room_template_index);
+	room_template_index = NULL;
+	room_template_max = 0;
 }
 
 static struct file_parser room_parser = {
@@ -480,7 +559,11 @@ static struct file_parser room_parser = {
 	init_parse_room,
 	run_parse_room,
 	finish_parse_room,
-	cleanup_room
+	cleanup_room,
+	1,
+	write_room_cache,
+	read_room_cache,
+	room_flags
 };
 
 
@@ -630,22 +713,175 @@ static errr run_parse_vault(struct parser *p) {
 	return parse_file_quit_not_found(p, "vault");
 }
 
+static int cmp_vault_depth(const void *a, const void *b)
+{
+	const struct vault *va = *(const struct vault **) a;
+	const struct vault *vb = *(const struct vault **) b;
+
+	return va->min_lev - vb->min_lev;
+}
+
+static int cmp_vault_name(const void *a, const void *b)
+{
+	const struct vault *va = *(const struct vault **) a;
+	const struct vault *vb = *(const struct vault **) b;
+
+	return strcmp(va->name, vb->name);
+}
+
+/**
+ * Find the index entry for a type of vault, adding one if there isn't one.
+ */
+static struct vault_type *add_vault_type(const char *name)
+{
+	int i;
+
+	for (i = 0; i < vault_type_max; i++) {
+		if (streq(vault_types[i].name, name)) return &vault_types[i];
+	}
+	vault_types = mem_realloc(vault_types,
+		(vault_type_max + 1) * sizeof(*vault_types));
+	memset(&vault_types[vault_type_max], 0, sizeof(*vault_types));
+	vault_types[vault_type_max].name = string_make(name);
+	return &vault_types[vault_type_max++];
+}
+
+/**
+ * Note the racial monster symbols in a vault's layout, each once in the
+ * order they first appear, so build_vault() needn't look for them.
+ */
+static void find_vault_races(struct vault *v)
+{
+	char races[53] = "";
+	size_t n = 0;
+	const char *t;
+
+	for (t = v->text; t && *t; t++) {
+		if (!isalpha((unsigned char) *t) || *t == 'x' || *t == 'X') continue;
+		if (strchr(races, *t) || n + 1 >= sizeof(races)) continue;
+		races[n++] = *t;
+		races[n] = '\0';
+	}
+	v->races = string_make(races);
+}
+
+/**
+ * Index the vaults by type, then by depth and by name, keeping those that
+ * compare equal in the order they were read in
+ */
+static void index_vaults(void)
+{
+	struct vault *v;
+	int i;
+
+	for (v = vaults; v; v = v->next) {
+		add_vault_type(v->typ)->count++;
+	}
+	for (i = 0; i < vault_type_max; i++) {
+		struct vault_type *t = &vault_types[i];
+
+		t->by_depth = mem_zalloc(t->count * sizeof(*t->by_depth));
+		t->by_name = mem_zalloc(t->count * sizeof(*t->by_name));
+		t->count = 0;
+	}
+	for (v = vaults; v; v = v->next) {
+		struct vault_type *t = add_vault_type(v->typ);
+
+		t->by_depth[t->count] = v;
+		t->by_name[t->count++] = v;
+	}
+	for (i = 0; i < vault_type_max; i++) {
+		struct vault_type *t = &vault_types[i];
+
+		sort_stable(t->by_depth, t->count, sizeof(*t->by_depth),
+			cmp_vault_depth);
+		sort_stable(t->by_name, t->count, sizeof(*t->by_name),
+			cmp_vault_name);
+	}
+}
+
 static errr finish_parse_vault(struct parser *p) {
+	struct vault *v;
+
 	vaults = parser_priv(p);
 	parser_destroy(p);
+	for (v = vaults; v; v = v->next) {
+		find_vault_races(v);
+	}
+	index_vaults();
 	return 0;
 }
 
+static void write_vault_cache(struct data_cache *dc)
+{
+	struct vault *v;
+
+	for (v = vaults; v; v = v->next) {
+		cache_put_byte(dc, 1);
+		cache_put_string(dc, v->name);
+		cache_put_string(dc, v->text);
+		cache_put_string(dc, v->typ);
+		cache_put_flags(dc, v->flags, ROOMF_SIZE);
+		cache_put_byte(dc, v->rat);
+		cache_put_byte(dc, v->hgt);
+		cache_put_byte(dc, v->wid);
+		cache_put_byte(dc, v->min_lev);
+		cache_put_byte(dc, v->max_lev);
+		cache_put_string(dc, v->races);
+	}
+	cache_put_byte(dc, 0);
+}
+
+static bool read_vault_cache(struct data_cache *dc)
+{
+	struct vault **last = &vaults;
+
+	vaults = NULL;
+	while (cache_get_byte(dc) && !dc->failed) {
+		struct vault *v = mem_zalloc(sizeof(*v));
+
+		*last = v;
+		last = &v->next;
+		v->name = cache_get_string(dc);
+		v->text = cache_get_string(dc);
+		v->typ = cache_get_string(dc);
+		cache_get_flags(dc, v->flags, ROOMF_SIZE);
+		v->rat = cache_get_byte(dc);
+		v->hgt = cache_get_byte(dc);
+		v->wid = cache_get_byte(dc);
+		v->min_lev = cache_get_byte(dc);
+		v->max_lev = cache_get_byte(dc);
+		v->races = cache_get_string(dc);
+		if (!v->name || !v->typ || !v->races) {
+			dc->failed = true;
+		}
+	}
+	if (dc->failed) return false;
+	index_vaults();
+	return true;
+}
+
 static void cleanup_vault(void)
 {
 	struct vault *v, *next;
+	int i;
+
 	for (v = vaults; v; v = next) {
 		next = v->next;
 		mem_free(v->name);
 		mem_free(v->typ);
 		mem_free(v->text);
+		mem_free(v->races);
 		mem_free(v);
 	}
+	for (i = 0; i < vault_type_max; i++) {
+		string_free(vault_types[i].name);
+		mem_free(vault_types[i].by_depth);
+		mem_free(vault_types[i].by_name);
+	}
+	mem_free(vault_types);
+	vault_types = NULL;
+	vault_type_max = 0;
 }
 
 static struct file_parser vault_parser = {
@@ -653,7 +889,11 @@ static struct file_parser vault_parser = {
 	init_parse_vault,
 	run_parse_vault,
 	finish_parse_vault,
-	cleanup_vault
+	cleanup_vault,
+	1,
+	write_vault_cache,
+	read_vault_cache,
+	room_flags
 };
 
 static void run_template_parser(void) {
@@ -798,6 +1038,12 @@ static const struct cave_profile *find_cave_profile(const char *name)
 	return NULL;
 }
 
+/**
+ * The profile every dungeon level is built with, if not the usual choice;
+ * see force_level_profile()
+ */
+static const struct cave_profile *forced_profile;
+
 /**
  * Do d_m's prime check for labyrinths
  * \param depth is the depth where we're trying to generate a labyrinth
@@ -853,7 +1099,9 @@ static const struct cave_profile *choose_profile(struct player *p)
 	}
 
 	/* Make the profile choice */
-	if (p->depth == 0) {
+	if (forced_profile && p->depth) {
+		profile = forced_profile;
+	} else if (p->depth == 0) {
 		profile = find_cave_profile("town");
 	} else if (is_blocking_quest(p, p->depth) && !OPT(p, birth_levels_persist)) {
 		/* Quest levels must be normal levels */
@@ -1039,6 +1287,12 @@ static void cave_store(struct chunk *c, bool known, bool keep_all)
 		stored->name = string_append(stored->name, " known");
 	}
 	stored->turn = turn;
+
+	/* Keep it small until the player is back, unless they are only off to
+	 * an arena, which is built from the monsters they left behind */
+	if (!player->upkeep->arena_level) {
+		cave_pack(stored);
+	}
 	chunk_list_add(stored);
 }
 
@@ -1056,6 +1310,28 @@ static void cave_clear(struct chunk *c, struct player *p)
 }
 
 
+/**
+ * Set up the generation data for one attempt at building a level for the
+ * player's current depth.
+ */
+static void init_dun_data(struct dun_data *dd, struct player *p)
+{
+	memset(dd, 0, sizeof(*dd));
+	dd->cent = mem_zalloc(z_info->level_room_max * sizeof(struct loc));
+	dd->ent_n = mem_zalloc(z_info->level_room_max * sizeof(*dd->ent_n));
+	dd->ent = mem_zalloc(z_info->level_room_max * sizeof(*dd->ent));
+	dd->door = mem_zalloc(z_info->level_door_max * sizeof(struct loc));
+	dd->wall = mem_zalloc(z_info->wall_pierce_max * sizeof(struct loc));
+	dd->tunn = mem_zalloc(z_info->tunn_grid_max * sizeof(struct loc));
+	dd->quest = is_blocking_quest(p, p->depth);
+
+	/* Get connector info for persistent levels */
+	if (OPT(p, birth_levels_persist)) {
+		dd->persist = true;
+		get_join_info(p, dd);
+	}
+}
+
 /**
  * Release the dynamically allocated resources in a dun_data structure.
  */
@@ -1063,31 +1339,56 @@ static void cleanup_dun_data(struct dun_data *dd)
 {
 	int i;
 
-	cave_connectors_free(dun->join);
-	cave_connectors_free(dun->one_off_above);
-	cave_connectors_free(dun->one_off_below);
-	mem_free(dun->cent);
-	mem_free(dun->ent_n);
+	cave_connectors_free(dd->join);
+	cave_connectors_free(dd->one_off_above);
+	cave_connectors_free(dd->one_off_below);
+	mem_free(dd->cent);
+	mem_free(dd->ent_n);
 	for (i = 0; i < z_info->level_room_max; ++i) {
-		mem_free(dun->ent[i]);
+		mem_free(dd->ent[i]);
 	}
-	mem_free(dun->ent);
-	if (dun->ent2room) {
-		for (i = 0; dun->ent2room[i]; ++i) {
-			mem_free(dun->ent2room[i]);
+	mem_free(dd->ent);
+	if (dd->ent2room) {
+		for (i = 0; dd->ent2room[i]; ++i) {
+			mem_free(dd->ent2room[i]);
 		}
-		mem_free(dun->ent2room);
+		mem_free(dd->ent2room);
 	}
-	mem_free(dun->door);
-	mem_free(dun->wall);
-	mem_free(dun->tunn);
+	mem_free(dd->door);
+	mem_free(dd->wall);
+	mem_free(dd->tunn);
 }
 
 
+/**
+ * Mix a value into a seed.
+ */
+static uint32_t seed_mix(uint32_t seed, uint32_t value)
+{
+	return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+/**
+ * The seed for a new level at the player's depth, from the world seed, the
+ * town whose dungeon it is, the depth and the number of levels made there
+ * before, so that the same game state always builds the same level.
+ */
+static uint32_t level_seed(struct player *p)
+{
+	uint32_t seed = world_town_seed;
+
+	seed = seed_mix(seed, p->town ? p->town - t_info : 0);
+	seed = seed_mix(seed, p->depth);
+	seed = seed_mix(seed, world_level_visit(p->town, p->depth));
+	return seed;
+}
+
 /**
  * Generate a random level.
  *
  * Confusingly, this function also generates the town level (level 0).
+ * Dungeon levels are built from their own seed (see level_seed()), leaving
+ * the game's random number stream as it was; towns are seeded separately.
  * \param p is the current player struct, in practice the global player
  * \return a pointer to the new level
  */
@@ -1096,6 +1397,7 @@ struct chunk *cave_generate(struct player *p, int height, int width)
 	const char *error = "no generation";
 	int i, tries = 0;
 	struct chunk *chunk = NULL;
+	rng_state game_rng;
 
 	/* Arena levels handled separately */
 	if (p->upkeep->arena_level) {
@@ -1119,54 +1421,39 @@ struct chunk *cave_generate(struct player *p, int height, int width)
 		return chunk;
 	}
 
+	/* Build dungeon levels from the level's own seed */
+	if (p->depth) {
+		Rand_extract_state(&game_rng);
+		Rand_state_init(level_seed(p));
+	}
+
 	/* Generate */
 	for (tries = 0; tries < 100 && error; tries++) {
 		int y, x;
-		struct dun_data dun_body;
+		struct dun_data dun;
 
 		error = NULL;
 
 		/* Mark the dungeon as being unready (to avoid artifact loss, etc) */
 		character_dungeon = false;
 
-		/* Allocate global data (will be freed when we leave the loop) */
-		dun = &dun_body;
-		dun->cent = mem_zalloc(z_info->level_room_max * sizeof(struct loc));
-		dun->ent_n = mem_zalloc(z_info->level_room_max * sizeof(*dun->ent_n));
-		dun->ent = mem_zalloc(z_info->level_room_max * sizeof(*dun->ent));
-		dun->ent2room = NULL;
-		dun->door = mem_zalloc(z_info->level_door_max * sizeof(struct loc));
-		dun->wall = mem_zalloc(z_info->wall_pierce_max * sizeof(struct loc));
-		dun->tunn = mem_zalloc(z_info->tunn_grid_max * sizeof(struct loc));
-		dun->join = NULL;
-		dun->one_off_above = NULL;
-		dun->one_off_below = NULL;
-		dun->curr_join = NULL;
-		dun->nstair_room = 0;
-		dun->quest = is_blocking_quest(p, p->depth);
-
-		/* Get connector info for persistent levels */
-		if (OPT(p, birth_levels_persist)) {
-			dun->persist = true;
-			get_join_info(p, dun);
-		} else {
-			dun->persist = false;
-		}
-
+		/* Set up the data for this attempt (freed when we leave the loop) */
+		init_dun_data(&dun, p);
 
 		/* Choose a profile and build the level */
 		if (p->active_quest >= 0) {
-			dun->profile = find_cave_profile("quest");
+			dun.profile = find_cave_profile("quest");
 		} else {
-			dun->profile = choose_profile(p);
+			dun.profile = choose_profile(p);
 		}
-		assert(dun->profile);
+		assert(dun.profile);
 
-		event_signal_string(EVENT_GEN_LEVEL_START, dun->profile->name);
-		chunk = dun->profile->builder(p, height, width);
+		event_signal_string(EVENT_GEN_LEVEL_START, dun.profile->name);
+		chunk = dun.profile->builder(&dun, p, height, width);
 		if (!chunk) {
 			error = "Failed to find builder";
-			cleanup_dun_data(dun);
+			cleanup_dun_data(&dun);
+			event_signal_string(EVENT_GEN_LEVEL_RETRY, error);
 			event_signal_flag(EVENT_GEN_LEVEL_END, false);
 			continue;
 		}
@@ -1205,10 +1492,11 @@ struct chunk *cave_generate(struct player *p, int height, int width)
 				msg("Generation restarted: %s.", error);
 			}
 			cave_clear(chunk, p);
+			event_signal_string(EVENT_GEN_LEVEL_RETRY, error);
 			event_signal_flag(EVENT_GEN_LEVEL_END, false);
 		}
 
-		cleanup_dun_data(dun);
+		cleanup_dun_data(&dun);
 	}
 
 	if (error) quit_fmt("cave_generate() failed 100 times!");
@@ -1239,6 +1527,9 @@ struct chunk *cave_generate(struct player *p, int height, int width)
 
 	chunk->turn = turn;
 
+	/* Carry on with the game's random numbers */
+	if (p->depth) Rand_restore_state(&game_rng);
+
 	return chunk;
 }
 
@@ -1419,6 +1710,11 @@ void prepare_next_level(struct player *p)
 		char *name = level_by_depth(p->depth)->name;
 		struct chunk *old_level = chunk_find_name(name);
 
+		/* Read it back in if it was spilled */
+		if (old_level && !chunk_list_load(old_level)) {
+			old_level = NULL;
+		}
+
 		/* If we found an old level, load the known level and assign */
 		if (old_level && (old_level != cave)) {
 			int i;
@@ -1428,6 +1724,8 @@ void prepare_next_level(struct player *p)
 			assert(old_known);
 
 			/* Assign the new ones */
+			cave_unpack(old_level);
+			cave_unpack(old_known);
 			cave = old_level;
 			p->cave = old_known;
 
@@ -1617,6 +1915,17 @@ const char *get_level_profile_name_from_index(int i)
 		cave_profiles[i].name : NULL;
 }
 
+/**
+ * Build every dungeon level with the level profile of the given index, or go
+ * back to choosing one as usual if the index is out of bounds.  The town is
+ * built as usual either way.  This is for benchmarking the level builders.
+ */
+void force_level_profile(int i)
+{
+	forced_profile = (i >= 0 && i < z_info->profile_max) ?
+		&cave_profiles[i] : NULL;
+}
+
 /**
  * The generate module, which initialises template rooms and vaults
  * Should it clean up?
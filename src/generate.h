@@ -211,7 +211,8 @@ struct streamer_profile {
 /*
  * cave_builder is a function pointer which builds a level.
  */
-typedef struct chunk * (*cave_builder) (struct player *p, int h, int w);
+typedef struct chunk * (*cave_builder) (struct dun_data *dun, struct player *p,
+	int h, int w);
 
 
 struct cave_profile {
@@ -236,7 +237,8 @@ struct cave_profile {
  * room_builder is a function pointer which builds rooms in the cave given
  * anchor coordinates.
  */
-typedef bool (*room_builder) (struct chunk *c, struct loc centre, int rating);
+typedef bool (*room_builder) (struct dun_data *dun, struct chunk *c,
+	struct loc centre, int rating);
 
 
 /**
@@ -277,6 +279,19 @@ struct vault {
 
     uint8_t min_lev;		/*!< Minimum allowable level, if specified. */
     uint8_t max_lev;		/*!< Maximum allowable level, if specified. */
+
+    char *races;		/*!< Racial monster symbols, in order of use */
+};
+
+
+/*
+ * The vaults of one type, indexed for random_vault() and named_vault()
+ */
+struct vault_type {
+    char *name;			/*!< Vault type */
+    struct vault **by_depth;	/*!< Vaults sorted by minimum level */
+    struct vault **by_name;	/*!< Vaults sorted by name */
+    int count;			/*!< Number of vaults of the type */
 };
 
 
@@ -311,9 +326,12 @@ struct room_template {
 #define SYMTR_FLAG_FORCE_REF (4)
 #define SYMTR_MAX_WEIGHT (32768)
 
-extern struct dun_data *dun;
 extern struct vault *vaults;
+extern struct vault_type *vault_types;
+extern int vault_type_max;
 extern struct room_template *room_templates;
+extern struct room_template **room_template_index;
+extern int room_template_max;
 
 /* generate.c */
 void prepare_next_level(struct player *p);
@@ -322,26 +340,39 @@ int get_room_builder_index_from_name(const char *name);
 const char *get_room_builder_name_from_index(int i);
 int get_level_profile_index_from_name(const char *name);
 const char *get_level_profile_name_from_index(int i);
+void force_level_profile(int i);
 
 /* gen-cave.c */
 struct chunk *town_gen_all(struct player *p, int min_height, int min_width);
-struct chunk *town_gen(struct player *p, int min_height, int min_width);
-struct chunk *classic_gen(struct player *p, int min_height, int min_width);
-struct chunk *labyrinth_gen(struct player *p, int min_height, int min_width);
+struct chunk *town_gen(struct dun_data *dun, struct player *p, int min_height,
+	int min_width);
+struct chunk *classic_gen(struct dun_data *dun, struct player *p,
+	int min_height, int min_width);
+struct chunk *labyrinth_gen(struct dun_data *dun, struct player *p,
+	int min_height, int min_width);
 void ensure_connectedness(struct chunk *c, bool allow_vault_disconnect);
-struct chunk *cavern_gen(struct player *p, int min_height, int min_width);
-struct chunk *modified_gen(struct player *p, int min_height, int min_width);
-struct chunk *moria_gen(struct player *p, int min_height, int min_width);
-struct chunk *hard_centre_gen(struct player *p, int min_height, int min_width);
-struct chunk *quest_gen(struct player *p, int min_height, int min_width);
-struct chunk *lair_gen(struct player *p, int min_height, int min_width);
-struct chunk *gauntlet_gen(struct player *p, int min_height, int min_width);
+struct chunk *cavern_gen(struct dun_data *dun, struct player *p, int min_height,
+	int min_width);
+struct chunk *modified_gen(struct dun_data *dun, struct player *p,
+	int min_height, int min_width);
+struct chunk *moria_gen(struct dun_data *dun, struct player *p, int min_height,
+	int min_width);
+struct chunk *hard_centre_gen(struct dun_data *dun, struct player *p,
+	int min_height, int min_width);
+struct chunk *quest_gen(struct dun_data *dun, struct player *p, int min_height,
+	int min_width);
+struct chunk *lair_gen(struct dun_data *dun, struct player *p, int min_height,
+	int min_width);
+struct chunk *gauntlet_gen(struct dun_data *dun, struct player *p,
+	int min_height, int min_width);
 struct chunk *arena_gen(struct player *p, int min_height, int min_width);
 
 /* gen-chunk.c */
 struct chunk *chunk_write(struct chunk *c);
 void chunk_list_add(struct chunk *c);
 bool chunk_list_remove(const char *name);
+bool chunk_list_load(struct chunk *c);
+void chunk_list_free(void);
 struct chunk *chunk_find_name(const char *name);
 bool chunk_find(struct chunk *c);
 struct chunk *chunk_find_adjacent(int depth, bool above);
@@ -370,33 +401,56 @@ extern bool generate_starburst_room(struct chunk *c, int y1, int x1, int y2,
 
 struct vault *random_vault(int depth, const char *typ);
 struct vault *named_vault(const char *name, const char *typ);
-bool build_vault(struct chunk *c, struct loc centre, struct vault *v);
-
-bool build_staircase(struct chunk *c, struct loc centre, int rating);
-bool build_simple(struct chunk *c, struct loc centre, int rating);
-bool build_circular(struct chunk *c, struct loc centre, int rating);
-bool build_overlap(struct chunk *c, struct loc centre, int rating);
-bool build_crossed(struct chunk *c, struct loc centre, int rating);
-bool build_large(struct chunk *c, struct loc centre, int rating);
+bool build_vault(struct dun_data *dun, struct chunk *c, struct loc centre,
+	struct vault *v);
+
+bool build_staircase(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_simple(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_circular(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_overlap(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_crossed(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_large(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
 bool mon_pit_hook(struct monster_race *race);
-void set_pit_type(int depth, int type);
-bool build_nest(struct chunk *c, struct loc centre, int rating);
-bool build_pit(struct chunk *c, struct loc centre, int rating);
-bool build_template(struct chunk *c, struct loc centre, int rating);
-bool build_shaped(struct chunk *c, struct loc centre, int rating);
-bool build_interesting(struct chunk *c, struct loc centre, int rating);
-bool build_lesser_vault(struct chunk *c, struct loc centre, int rating);
-bool build_lesser_new_vault(struct chunk *c, struct loc centre, int rating);
-bool build_medium_vault(struct chunk *c, struct loc centre, int rating);
-bool build_medium_new_vault(struct chunk *c, struct loc centre, int rating);
-bool build_greater_vault(struct chunk *c, struct loc centre, int rating);
-bool build_quest_vault(struct chunk *c, struct loc centre, int rating);
-bool build_greater_new_vault(struct chunk *c, struct loc centre, int rating);
-bool build_moria(struct chunk *c, struct loc centre, int rating);
-bool build_room_of_chambers(struct chunk *c, struct loc centre, int rating);
-bool build_huge(struct chunk *c, struct loc centre, int rating);
-bool room_build(struct chunk *c, int by0, int bx0, struct room_profile profile,
-	bool finds_own_space);
+void set_pit_type(struct dun_data *dun, int depth, int type);
+void prep_pit_monsters(const struct pit_profile *pit);
+bool build_nest(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_pit(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_template(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_shaped(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_interesting(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_lesser_vault(struct dun_data *dun, struct chunk *c,
+	struct loc centre, int rating);
+bool build_lesser_new_vault(struct dun_data *dun, struct chunk *c,
+	struct loc centre, int rating);
+bool build_medium_vault(struct dun_data *dun, struct chunk *c,
+	struct loc centre, int rating);
+bool build_medium_new_vault(struct dun_data *dun, struct chunk *c,
+	struct loc centre, int rating);
+bool build_greater_vault(struct dun_data *dun, struct chunk *c,
+	struct loc centre, int rating);
+bool build_quest_vault(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_greater_new_vault(struct dun_data *dun, struct chunk *c,
+	struct loc centre, int rating);
+bool build_moria(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool build_room_of_chambers(struct dun_data *dun, struct chunk *c,
+	struct loc centre, int rating);
+bool build_huge(struct dun_data *dun, struct chunk *c, struct loc centre,
+	int rating);
+bool room_build(struct dun_data *dun, struct chunk *c, int by0, int bx0,
+	struct room_profile profile, bool finds_own_space);
 struct chunk *cave_generate(struct player *p, int height, int width);
 
 
@@ -448,7 +502,8 @@ void spread_monsters(struct chunk *c, const char *type, int depth, int num,
 	int y0, int x0, int dy, int dx, uint8_t origin);
 void get_vault_monsters(struct chunk *c, char racial_symbol[], char *vault_type,
 						const char *data, int y1, int y2, int x1, int x2);
-void get_chamber_monsters(struct chunk *c, int y1, int x1, int y2, int x2, char *name, int area);
+void get_chamber_monsters(struct dun_data *dun, struct chunk *c, int y1, int x1,
+	int y2, int x2, char *name, int area);
 
 
 #endif /* !GENERATE_H */
@@ -564,6 +564,8 @@ static enum parser_error parse_constants_world(struct parser *p) {
 		z->stair_skip = value;
 	else if (streq(label, "move-energy"))
 		z->move_energy = value;
+	else if (streq(label, "levels-kept"))
+		z->levels_kept = value;
 	else
 		return PARSE_ERROR_UNDEFINED_DIRECTIVE;
 
@@ -2148,6 +2150,7 @@ static errr finish_parse_feat(struct parser *p) {
 	}
 
 	/* Set the terrain constants */
+	index_feat_names();
 	set_terrain();
 
 	parser_destroy(p);
@@ -2156,6 +2159,8 @@ static errr finish_parse_feat(struct parser *p) {
 
 static void cleanup_feat(void) {
 	int idx;
+
+	free_feat_names();
 	for (idx = 0; idx < z_info->f_max; idx++) {
 		string_free(f_info[idx].look_in_preposition);
 		string_free(f_info[idx].look_prefix);
@@ -4629,63 +4634,85 @@ static struct file_parser hints_parser = {
  * Game data initialization
  * ------------------------------------------------------------------------ */
 
+/**
+ * The most parsers that one parser needs to have been run before it
+ */
+#define MAX_PARSER_NEEDS 8
+
 /**
  * A list of all the above parsers, plus those found in mon-init.c and
- * obj-init.c
+ * obj-init.c, each with the parsers whose data it looks things up in.
+ *
+ * Effects are left out of this; an effect naming, say, a summon needs the
+ * summons read first, but which effects are used is up to the data files.
  */
 static struct {
 	const char *name;
 	struct file_parser *parser;
+	struct file_parser *needs[MAX_PARSER_NEEDS];
 } pl[] = {
-	{ "world", &world_parser },
-	{ "town names", &town_names_parser },
-	{ "projections", &projection_parser },
-	{ "ui renderers", &ui_entry_renderer_parser },
-	{ "ui entries", &ui_entry_parser },
-	{ "player properties", &player_property_parser },
-	{ "tables", &tables_parser },
-	{ "player shapes", &shape_parser },
-	{ "abilities", &ability_parser },
-	{ "features", &feat_parser },
-	{ "object bases", &object_base_parser },
-	{ "brands", &brand_parser },
-	{ "monster pain messages", &pain_parser },
-	{ "monster bases", &mon_base_parser },
-	{ "slays", &slay_parser },
-	{ "summons", &summon_parser },
-	{ "faults", &fault_parser },
-	{ "objects", &object_parser },
-	{ "activations", &act_parser },
-	{ "ego-items", &ego_parser },
-	{ "history charts", &history_parser },
-	{ "bodies", &body_parser },
-	{ "player races", &p_race_parser },
-	{ "player classes", &class_parser },
-	{ "artifacts", &artifact_parser },
-	{ "object properties", &object_property_parser },
-	{ "artifact names", &artinames_parser },
-	{ "timed effects", &player_timed_parser },
-	{ "blow methods", &meth_parser },
-	{ "blow effects", &eff_parser },
-	{ "monster spells", &mon_spell_parser },
-	{ "monster mutations", &monster_mut_parser },
-	{ "monsters", &monster_parser },
-	{ "monster pits" , &pit_parser },
-	{ "monster lore" , &lore_parser },
-	{ "monster interaction", &interact_parser },
-	{ "traps", &trap_parser },
-	{ "chest_traps", &chest_trap_parser },
-	{ "chest themes", &chest_parser },
-	{ "flavours", &flavor_parser },
-	{ "hints", &hints_parser },
-	{ "lies", &lies_parser },
-	{ "mine", &mine_parser },
-	{ "first", &first_parser },
-	{ "male", &first_m_parser },
-	{ "female", &first_f_parser },
-	{ "second", &second_parser },
-	{ "death", &death_parser },
-	{ "random names", &names_parser }
+	{ "world", &world_parser, { NULL } },
+	{ "town names", &town_names_parser, { NULL } },
+	{ "projections", &projection_parser, { NULL } },
+	{ "ui renderers", &ui_entry_renderer_parser, { NULL } },
+	{ "ui entries", &ui_entry_parser, { &ui_entry_renderer_parser } },
+	{ "player properties", &player_property_parser,
+		{ &projection_parser, &ui_entry_parser } },
+	{ "tables", &tables_parser, { NULL } },
+	{ "player shapes", &shape_parser, { NULL } },
+	{ "abilities", &ability_parser, { NULL } },
+	{ "features", &feat_parser, { NULL } },
+	{ "object bases", &object_base_parser, { NULL } },
+	{ "brands", &brand_parser, { NULL } },
+	{ "monster pain messages", &pain_parser, { NULL } },
+	{ "monster bases", &mon_base_parser, { &pain_parser } },
+	{ "slays", &slay_parser, { &mon_base_parser } },
+	{ "summons", &summon_parser, { &mon_base_parser } },
+	{ "faults", &fault_parser, { NULL } },
+	{ "objects", &object_parser,
+		{ &object_base_parser, &brand_parser, &slay_parser, &fault_parser } },
+	{ "activations", &act_parser, { NULL } },
+	{ "ego-items", &ego_parser,
+		{ &object_parser, &brand_parser, &slay_parser, &fault_parser } },
+	{ "history charts", &history_parser, { NULL } },
+	{ "bodies", &body_parser, { NULL } },
+	{ "player races", &p_race_parser,
+		{ &history_parser, &body_parser, &object_parser } },
+	{ "player classes", &class_parser, { &object_parser } },
+	{ "artifacts", &artifact_parser,
+		{ &object_parser, &brand_parser, &slay_parser, &fault_parser,
+		&act_parser } },
+	{ "object properties", &object_property_parser, { NULL } },
+	{ "artifact names", &artinames_parser, { NULL } },
+	{ "timed effects", &player_timed_parser, { NULL } },
+	{ "blow methods", &meth_parser, { NULL } },
+	{ "blow effects", &eff_parser, { NULL } },
+	{ "monster spells", &mon_spell_parser, { NULL } },
+	{ "monster mutations", &monster_mut_parser,
+		{ &mon_base_parser, &object_parser, &artifact_parser, &meth_parser,
+		&eff_parser } },
+	{ "monsters", &monster_parser,
+		{ &mon_base_parser, &pain_parser, &object_parser, &artifact_parser,
+		&meth_parser, &eff_parser, &shape_parser } },
+	{ "monster pits", &pit_parser, { &mon_base_parser, &monster_parser } },
+	{ "monster lore", &lore_parser,
+		{ &mon_base_parser, &monster_parser, &object_parser, &meth_parser,
+		&eff_parser } },
+	{ "monster interaction", &interact_parser,
+		{ &mon_base_parser, &monster_parser } },
+	{ "traps", &trap_parser, { NULL } },
+	{ "chest_traps", &chest_trap_parser, { NULL } },
+	{ "chest themes", &chest_parser, { &object_parser } },
+	{ "flavours", &flavor_parser, { &object_parser } },
+	{ "hints", &hints_parser, { NULL } },
+	{ "lies", &lies_parser, { NULL } },
+	{ "mine", &mine_parser, { NULL } },
+	{ "first", &first_parser, { NULL } },
+	{ "male", &first_m_parser, { NULL } },
+	{ "female", &first_f_parser, { NULL } },
+	{ "second", &second_parser, { NULL } },
+	{ "death", &death_parser, { NULL } },
+	{ "random names", &names_parser, { NULL } }
 };
 
 /**
@@ -4695,10 +4722,55 @@ static struct {
 static struct {
 	const char *name;
 	struct file_parser *parser;
+	struct file_parser *needs[MAX_PARSER_NEEDS];
 } lpl[] = {
-	{ "quests", &quests_parser }
+	{ "quests", &quests_parser,
+		{ &feat_parser, &object_parser, &ego_parser, &artifact_parser,
+		&monster_parser, &trap_parser } }
 };
 
+/**
+ * Check whether `needed` has been run by the time the parser at `after` in
+ * the list, or in the late list if `late`, is run.
+ */
+static bool parser_runs_before(struct file_parser *needed, size_t after,
+		bool late)
+{
+	size_t i;
+
+	for (i = 0; i < (late ? N_ELEMENTS(pl) : after); i++) {
+		if (pl[i].parser == needed) return true;
+	}
+	for (i = 0; late && i < after; i++) {
+		if (lpl[i].parser == needed) return true;
+	}
+	return false;
+}
+
+/**
+ * Check the parser lists against what each parser needs, so that a parser
+ * moved ahead of one it looks things up in is caught by name.
+ */
+static void check_parser_order(void)
+{
+	size_t i, j;
+
+	for (i = 0; i < N_ELEMENTS(pl); i++) {
+		for (j = 0; j < MAX_PARSER_NEEDS && pl[i].needs[j]; j++) {
+			if (!parser_runs_before(pl[i].needs[j], i, false))
+				quit_fmt("Cannot initialize %s before %s.", pl[i].name,
+					pl[i].needs[j]->name);
+		}
+	}
+	for (i = 0; i < N_ELEMENTS(lpl); i++) {
+		for (j = 0; j < MAX_PARSER_NEEDS && lpl[i].needs[j]; j++) {
+			if (!parser_runs_before(lpl[i].needs[j], i, true))
+				quit_fmt("Cannot initialize %s before %s.", lpl[i].name,
+					lpl[i].needs[j]->name);
+		}
+	}
+}
+
 /**
  * Initialize just the internal arrays.
  * This should be callable by the test suite, without relying on input, or
@@ -4710,6 +4782,7 @@ void init_arrays(void)
 {
 	unsigned int i;
 
+	check_parser_order();
 	for (i = 0; i < N_ELEMENTS(pl); i++) {
 		char *msg = string_make(format("Initializing %s...", pl[i].name));
 		event_signal_message(EVENT_INITSTATUS, 0, msg);
@@ -4771,6 +4844,8 @@ static struct init_module late_arrays_module = {
 
 extern struct init_module z_quark_module;
 extern struct init_module generate_module;
+extern struct init_module view_module;
+extern struct init_module project_module;
 extern struct init_module icon_module;
 extern struct init_module obj_make_module;
 extern struct init_module ignore_module;
@@ -4789,6 +4864,8 @@ static struct init_module *modules[] = {
 	&arrays_module,
 	&player_module,
 	&generate_module,
+	&view_module,
+	&project_module,
 	&icon_module,
 	&obj_make_module,
 	&ignore_module,
@@ -4850,12 +4927,7 @@ void cleanup_angband(void)
 	int i;
 
 	/* Free the chunk list */
-	for (i = 0; i < chunk_list_max; i++) {
-		wipe_mon_list(chunk_list[i], player);
-		cave_free(chunk_list[i]);
-	}
-	mem_free(chunk_list);
-	chunk_list = NULL;
+	chunk_list_free();
 
 	for (i = 0; modules[i]; i++)
 		if (modules[i]->cleanup)
@@ -4873,6 +4945,7 @@ void cleanup_angband(void)
 	object_list_finalize();
 
 	cleanup_game_constants();
+	cleanup_flag_indexes();
 
 	cmdq_flush();
 
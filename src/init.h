@@ -110,6 +110,7 @@ struct angband_constants
 	uint16_t feeling_need;	/**< Squares needed to see to get first feeling */
     uint16_t stair_skip;    /**< Number of levels to skip for each down stair */
 	uint16_t move_energy;	/**< Energy the player or monster needs to move */
+	uint16_t levels_kept;	/**< Stored levels kept in memory, or 0 for all */
 	uint16_t town_max;		/**< Total number of towns in t_info[], set by world_init_towns */
 
 	/* Carrying capacity constants, read from constants.txt */
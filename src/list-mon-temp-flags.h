@@ -13,7 +13,7 @@ MFLAG(VISIBLE,	"Monster is \"visible\"")
 MFLAG(CAMOUFLAGE,"Player doesn't know this is a monster")
 MFLAG(AWARE,	"Monster is aware of the player")
 MFLAG(PAINTED,	"Monster cannot be invisible")
-MFLAG(HANDLED,	"Monster has been processed this turn")
+MFLAG(HANDLED,	"Unused; kept so saved flags stay in place")
 MFLAG(TRACKING,	"Monster is tracking the player by sound or scent")
 MFLAG(MALE,		"Monster is male")
 MFLAG(FEMALE,	"Monster is female")
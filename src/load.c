@@ -695,6 +695,33 @@ int rd_world(void)
 	return 0;
 }
 
+/**
+ * Read the number of levels made at each depth of each dungeon, which seeds
+ * the next level made there.
+ */
+int rd_level_visits(void)
+{
+	uint16_t towns, depths;
+	int i, j;
+
+	rd_u16b(&towns);
+	rd_u16b(&depths);
+
+	mem_free(world_level_visits);
+	world_level_visits = mem_zalloc(z_info->town_max * z_info->max_depth *
+		sizeof(uint16_t));
+	for (i = 0; i < towns; i++) {
+		for (j = 0; j < depths; j++) {
+			uint16_t visits;
+
+			rd_u16b(&visits);
+			if (i < z_info->town_max && j < z_info->max_depth)
+				world_level_visits[i * z_info->max_depth + j] = visits;
+		}
+	}
+	return 0;
+}
+
 void rdwr_player_levels(void)
 {
 	rdwr_s32b(&player->au);
@@ -1697,9 +1724,9 @@ int rdwr_race(struct monster_race *r)
 }
 
 /**
- * Read monsters
+ * Read monsters, with the custom race only where it was written with them
  */
-static int rd_monsters_aux(struct chunk *c, bool arena)
+static int rd_monsters_aux(struct chunk *c, bool arena, bool custom)
 {
 	int i;
 	uint16_t limit;
@@ -1716,7 +1743,7 @@ static int rd_monsters_aux(struct chunk *c, bool arena)
 	}
 
 	/* Read custom monster(s) */
-	if (rdwr_race(&r_info[1]))
+	if (custom && rdwr_race(&r_info[1]))
 		return (-1);
 
 	/* Clear for arenas */
@@ -1870,9 +1897,9 @@ int rd_monsters(void)
 	if (player->is_dead)
 		return 0;
 
-	if (rd_monsters_aux(cave, true))
+	if (rd_monsters_aux(cave, true, true))
 		return -1;
-	if (rd_monsters_aux(player->cave, false))
+	if (rd_monsters_aux(player->cave, false, true))
 		return -1;
 
 #if OBJ_RECOVER
@@ -1907,10 +1934,100 @@ int rd_traps(void)
 	return 0;
 }
 
+/**
+ * Read one stored chunk; older savefiles wrote the custom race with each
+ */
+static int rd_chunk(struct chunk **pc, bool custom)
+{
+	struct chunk *c;
+
+	/* Read the dungeon */
+	if (rd_dungeon_aux(pc))
+		return -1;
+	c = *pc;
+
+	/* Read the objects */
+	if (rd_objects_aux(rd_item, c))
+		return -1;
+
+	/* Read the monsters */
+	if (rd_monsters_aux(c, false, custom))
+		return -1;
+
+	/* Read traps */
+	if (rd_traps_aux(c))
+		return -1;
+
+	/* Read other chunk info */
+	if (OPT(player, birth_levels_persist)) {
+		char buf[80];
+		int i;
+		uint8_t tmp8u;
+		uint16_t tmp16u;
+
+		rd_string(buf, sizeof(buf));
+		string_free(c->name);
+		c->name = string_make(buf);
+		rd_s32b(&c->turn);
+		rd_u16b(&tmp16u);
+		c->depth = tmp16u;
+		rd_byte(&c->feeling);
+		rd_u32b(&c->obj_rating);
+		rd_u32b(&c->mon_rating);
+		rd_byte(&tmp8u);
+		c->good_item  = tmp8u ? true : false;
+		rd_u16b(&tmp16u);
+		c->height = tmp16u;
+		rd_u16b(&tmp16u);
+		c->width = tmp16u;
+		rd_u16b(&c->feeling_squares);
+		for (i = 0; i < z_info->f_max + 1; i++) {
+			rd_u16b(&tmp16u);
+			c->feat_count[i] = tmp16u;
+		}
+	} else if (c->name) {
+		struct level *lev = level_by_name(c->name);
+
+		if (lev) {
+			c->depth = lev->depth;
+		} else if (suffix(c->name, " known")) {
+			size_t offset = strlen(c->name) -
+				strlen(" known");
+			c->name[offset] = '\0';
+			lev = level_by_name(c->name);
+			if (lev) {
+				c->depth = lev->depth;
+			}
+			c->name[offset] = ' ';
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Read a stored chunk back from the side file it was written to earlier in
+ * the game, so with the sizes of things this version uses rather than those
+ * of the savefile
+ */
+int rd_side_chunk(struct chunk **pc)
+{
+	square_size = SQUARE_SIZE;
+	mflag_size = MFLAG_SIZE;
+	of_size = OF_SIZE;
+	obj_mod_max = OBJ_MOD_MAX;
+	elem_max = ELEM_MAX;
+	brand_max = z_info->brand_max;
+	slay_max = z_info->slay_max;
+	fault_max = z_info->fault_max;
+
+	return rd_chunk(pc, false);
+}
+
 /**
  * Read the chunk list
  */
-int rd_chunks(void)
+static int rd_chunks_aux(bool custom)
 {
 	int j;
 	uint16_t chunk_max;
@@ -1922,66 +2039,10 @@ int rd_chunks(void)
 	for (j = 0; j < chunk_max; j++) {
 		struct chunk *c;
 
-		/* Read the dungeon */
-		if (rd_dungeon_aux(&c))
+		if (rd_chunk(&c, custom))
 			return -1;
 
-		/* Read the objects */
-		if (rd_objects_aux(rd_item, c))
-			return -1;
-
-		/* Read the monsters */
-		if (rd_monsters_aux(c, false))
-			return -1;
-
-		/* Read traps */
-		if (rd_traps_aux(c))
-			return -1;
-
-		/* Read other chunk info */
-		if (OPT(player, birth_levels_persist)) {
-			char buf[80];
-			int i;
-			uint8_t tmp8u;
-			uint16_t tmp16u;
-
-			rd_string(buf, sizeof(buf));
-			string_free(c->name);
-			c->name = string_make(buf);
-			rd_s32b(&c->turn);
-			rd_u16b(&tmp16u);
-			c->depth = tmp16u;
-			rd_byte(&c->feeling);
-			rd_u32b(&c->obj_rating);
-			rd_u32b(&c->mon_rating);
-			rd_byte(&tmp8u);
-			c->good_item  = tmp8u ? true : false;
-			rd_u16b(&tmp16u);
-			c->height = tmp16u;
-			rd_u16b(&tmp16u);
-			c->width = tmp16u;
-			rd_u16b(&c->feeling_squares);
-			for (i = 0; i < z_info->f_max + 1; i++) {
-				rd_u16b(&tmp16u);
-				c->feat_count[i] = tmp16u;
-			}
-		} else if (c->name) {
-			struct level *lev = level_by_name(c->name);
-
-			if (lev) {
-				c->depth = lev->depth;
-			} else if (suffix(c->name, " known")) {
-				size_t offset = strlen(c->name) -
-					strlen(" known");
-				c->name[offset] = '\0';
-				lev = level_by_name(c->name);
-				if (lev) {
-					c->depth = lev->depth;
-				}
-				c->name[offset] = ' ';
-			}
-		}
-
+		cave_pack(c);
 		chunk_list_add(c);
 	}
 
@@ -2000,6 +2061,20 @@ int rd_chunks(void)
 	return 0;
 }
 
+/**
+ * Read the chunk list - wrapper functions, for savefiles that wrote the
+ * custom race with each chunk and for those that don't
+ */
+int rd_chunks_1(void)
+{
+	return rd_chunks_aux(true);
+}
+
+int rd_chunks(void)
+{
+	return rd_chunks_aux(false);
+}
+
 
 int rd_history(void)
 {
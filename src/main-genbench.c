@@ -0,0 +1,349 @@
+/**
+ * \file main-genbench.c
+ * \brief Benchmark the level generators from the command line
+ *
+ * This work is free software; you can redistribute it and/or modify it
+ * under the terms of either:
+ *
+ * a) the GNU General Public License as published by the Free Software
+ *    Foundation, version 2, or
+ *
+ * b) the "Angband licence":
+ *    This software may be copied and distributed for educational, research,
+ *    and not for profit purposes provided that this copyright and statement
+ *    are included in all such copies.  Other copyrights may also apply.
+ */
+
+#include "angband.h"
+
+#ifdef USE_GENBENCH
+
+#include "cave.h"
+#include "game-event.h"
+#include "generate.h"
+#include "init.h"
+#include "main.h"
+#include "mon-make.h"
+#include "obj-util.h"
+#include "player-birth.h"
+#include "world.h"
+#include <time.h>
+
+/**
+ * What was measured for one room builder
+ */
+struct bench_room {
+	uint32_t count;
+	uint32_t failed;
+	double msec;
+};
+
+/**
+ * What was measured for one profile at one depth
+ */
+static struct {
+	uint32_t levels;
+	uint32_t retry_monsters;
+	uint32_t retry_builder;
+	double msec;
+	uint32_t tunnels;
+	double tunnel_msec;
+	int64_t peak;
+	struct bench_room *rooms;
+} bench;
+
+/* The room being built and the tunnelling going on, if any */
+static int room_type = -1;
+static double room_start;
+static int tunneling;
+static double tunnel_start;
+
+/* Options */
+static uint32_t num_levels = 10;
+static int min_depth = 5;
+static int max_depth = 95;
+static int depth_step = 10;
+static const char *only_profile = NULL;
+static const char *out_name = NULL;
+static bool have_seed = false;
+static uint32_t seed = 0;
+
+/**
+ * Milliseconds on a clock that only goes forward
+ */
+static double bench_msec(void)
+{
+#if _POSIX_C_SOURCE >= 199309L
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+#else
+	return clock() * 1000.0 / CLOCKS_PER_SEC;
+#endif
+}
+
+static void bench_level_start(game_event_type type, game_event_data *data,
+		void *user)
+{
+	/* Forget anything a failed attempt left unfinished */
+	room_type = -1;
+	tunneling = 0;
+}
+
+static void bench_level_retry(game_event_type type, game_event_data *data,
+		void *user)
+{
+	if (data->string && streq(data->string, "too many monsters")) {
+		bench.retry_monsters++;
+	} else {
+		bench.retry_builder++;
+	}
+}
+
+static void bench_room_start(game_event_type type, game_event_data *data,
+		void *user)
+{
+	room_type = data->string ?
+		get_room_builder_index_from_name(data->string) : -1;
+	room_start = bench_msec();
+}
+
+static void bench_room_end(game_event_type type, game_event_data *data,
+		void *user)
+{
+	struct bench_room *room;
+
+	if (room_type < 0) return;
+	room = &bench.rooms[room_type];
+	room->count++;
+	if (!data->flag) room->failed++;
+	room->msec += bench_msec() - room_start;
+	room_type = -1;
+}
+
+static void bench_tunneling_start(game_event_type type, game_event_data *data,
+		void *user)
+{
+	if (!tunneling++) tunnel_start = bench_msec();
+}
+
+static void bench_tunneling_end(game_event_type type, game_event_data *data,
+		void *user)
+{
+	if (!tunneling || --tunneling) return;
+	bench.tunnels++;
+	bench.tunnel_msec += bench_msec() - tunnel_start;
+}
+
+static struct {
+	game_event_type type;
+	game_event_handler *fn;
+} handlers[] = {
+	{ EVENT_GEN_LEVEL_START, bench_level_start },
+	{ EVENT_GEN_LEVEL_RETRY, bench_level_retry },
+	{ EVENT_GEN_ROOM_START, bench_room_start },
+	{ EVENT_GEN_ROOM_END, bench_room_end },
+	{ EVENT_GEN_TUNNELING_START, bench_tunneling_start },
+	{ EVENT_GEN_TUNNELING_END, bench_tunneling_end },
+};
+
+/**
+ * Build one level at the given depth, then throw it away along with anything
+ * it used up, so the next level starts from the same place
+ */
+static void bench_level(int depth)
+{
+	struct chunk *c;
+	double start;
+	int64_t base;
+	int i;
+
+	player->depth = depth;
+	base = mem_peak = mem_in_use;
+	start = bench_msec();
+	c = cave_generate(player, 0, 0);
+	bench.msec += bench_msec() - start;
+	bench.peak = MAX(bench.peak, mem_peak - base);
+	bench.levels++;
+
+	wipe_mon_list(c, player);
+	cave_free(player->cave);
+	player->cave = NULL;
+	cave_free(c);
+	for (i = 0; i < z_info->a_max; i++) {
+		mark_artifact_created(&a_info[i], false);
+	}
+}
+
+/**
+ * Write out what was measured for a profile at a depth
+ */
+static void bench_write(FILE *fo, const char *profile, int depth)
+{
+	int i;
+
+	fprintf(fo, "%s,%d,level,,%lu,%lu,%.3f,%lld\n", profile, depth,
+		(unsigned long) bench.levels,
+		(unsigned long) (bench.retry_monsters + bench.retry_builder),
+		bench.msec, (long long) (bench.peak / 1024));
+	fprintf(fo, "%s,%d,retry,too many monsters,%lu,,,\n", profile, depth,
+		(unsigned long) bench.retry_monsters);
+	fprintf(fo, "%s,%d,retry,builder failure,%lu,,,\n", profile, depth,
+		(unsigned long) bench.retry_builder);
+	for (i = 0; i < get_room_builder_count(); i++) {
+		const struct bench_room *room = &bench.rooms[i];
+
+		if (!room->count) continue;
+		fprintf(fo, "%s,%d,room,%s,%lu,%lu,%.3f,\n", profile, depth,
+			get_room_builder_name_from_index(i),
+			(unsigned long) room->count, (unsigned long) room->failed,
+			room->msec);
+	}
+	fprintf(fo, "%s,%d,tunnel,,%lu,,%.3f,\n", profile, depth,
+		(unsigned long) bench.tunnels, bench.tunnel_msec);
+	fflush(fo);
+}
+
+static void run_genbench(FILE *fo)
+{
+	int i, depth;
+	uint32_t n;
+
+	bench.rooms = mem_zalloc(get_room_builder_count() *
+		sizeof(*bench.rooms));
+	for (i = 0; i < (int) N_ELEMENTS(handlers); i++) {
+		event_add_handler(handlers[i].type, handlers[i].fn, NULL);
+	}
+	mem_flags |= MEM_COUNT_USE;
+
+	fprintf(fo, "profile,depth,phase,name,count,failed,msec,peak_kb\n");
+	for (i = 0; i < z_info->profile_max; i++) {
+		const char *profile = get_level_profile_name_from_index(i);
+
+		/* The town and quest levels can't be built anywhere else */
+		if (streq(profile, "town") || streq(profile, "quest")) continue;
+		if (only_profile && !streq(profile, only_profile)) continue;
+
+		force_level_profile(i);
+		for (depth = min_depth; depth <= max_depth; depth += depth_step) {
+			struct bench_room *rooms = bench.rooms;
+
+			memset(rooms, 0, get_room_builder_count() * sizeof(*rooms));
+			memset(&bench, 0, sizeof(bench));
+			bench.rooms = rooms;
+			for (n = 0; n < num_levels; n++) {
+				bench_level(depth);
+			}
+			bench_write(fo, profile, depth);
+		}
+	}
+	force_level_profile(-1);
+
+	mem_flags &= ~MEM_COUNT_USE;
+	for (i = 0; i < (int) N_ELEMENTS(handlers); i++) {
+		event_remove_handler(handlers[i].type, handlers[i].fn, NULL);
+	}
+	mem_free(bench.rooms);
+}
+
+const char help_genbench[] =
+	"Level generation benchmark mode, subopts\n"
+	"              -nNN        Build NN levels for each profile and depth\n"
+	"                          (default: 10)\n"
+	"              -dMIN-MAX   Build levels from depth MIN to MAX\n"
+	"                          (default: 5-95)\n"
+	"              -iNN        Step NN levels between depths (default: 10)\n"
+	"              -pNAME      Only benchmark the profile called NAME\n"
+	"              -sSEED      Use the given seed (hexadecimal value; no\n"
+	"                          leading 0x) for the levels built\n"
+	"              -oFILE      Write the CSV to FILE rather than standard\n"
+	"                          output";
+
+/**
+ * Usage:
+ *
+ * angband -mgenbench -- [-nNN] [-dMIN-MAX] [-iNN] [-pNAME] [-sSEED] [-oFILE]
+ *
+ * Builds levels with each dungeon profile in turn, at each depth asked for,
+ * and writes one CSV row per profile and depth for the levels as a whole
+ * (count of levels, count of attempts thrown away, milliseconds taken and the
+ * most memory any one level took in kilobytes), a row for each reason an
+ * attempt was thrown away, a row for each room builder used (rooms tried,
+ * rooms that failed and milliseconds taken) and a row for the tunnelling.
+ */
+errr init_genbench(int argc, char *argv[]) {
+	int i;
+	FILE *fo = stdout;
+
+	/* Skip over argv[0] */
+	for (i = 1; i < argc; i++) {
+		if (prefix(argv[i], "-n")) {
+			num_levels = atoi(&argv[i][2]);
+			continue;
+		}
+		if (prefix(argv[i], "-d")) {
+			if (sscanf(&argv[i][2], "%d-%d", &min_depth,
+					&max_depth) == 2) {
+				continue;
+			}
+		}
+		if (prefix(argv[i], "-i")) {
+			depth_step = MAX(1, atoi(&argv[i][2]));
+			continue;
+		}
+		if (prefix(argv[i], "-p")) {
+			only_profile = &argv[i][2];
+			continue;
+		}
+		if (prefix(argv[i], "-s")) {
+			seed = strtoul(&argv[i][2], NULL, 16);
+			have_seed = true;
+			continue;
+		}
+		if (prefix(argv[i], "-o")) {
+			out_name = &argv[i][2];
+			continue;
+		}
+		printf("init-genbench: bad argument '%s'\n", argv[i]);
+		return 1;
+	}
+
+	init_angband();
+	if (min_depth < 1 || max_depth >= z_info->max_depth ||
+			min_depth > max_depth) {
+		printf("init-genbench: depths must be from 1 to %d\n",
+			z_info->max_depth - 1);
+		cleanup_angband();
+		return 1;
+	}
+	if (only_profile && get_level_profile_index_from_name(only_profile) < 0) {
+		printf("init-genbench: no profile called '%s'\n", only_profile);
+		cleanup_angband();
+		return 1;
+	}
+	if (!player_make_simple(NULL, NULL, NULL, "Bench")) {
+		printf("init-genbench: could not initialize player.\n");
+		cleanup_angband();
+		return 1;
+	}
+	if (have_seed) world_town_seed = seed | 1;
+
+	if (out_name) {
+		fo = fopen(out_name, "w");
+		if (!fo) {
+			printf("init-genbench: could not open '%s'\n", out_name);
+			cleanup_angband();
+			return 1;
+		}
+	}
+
+	run_genbench(fo);
+
+	if (fo != stdout) fclose(fo);
+	cleanup_angband();
+	exit(0);
+	return 0;
+}
+
+#endif /* USE_GENBENCH */
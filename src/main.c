@@ -81,6 +81,10 @@ static const struct module modules[] =
 #ifdef USE_SPOIL
 	{ "spoil", help_spoil, init_spoil },
 #endif
+
+#ifdef USE_GENBENCH
+	{ "genbench", help_genbench, init_genbench },
+#endif /* USE_GENBENCH */
 };
 
 /**
@@ -2003,6 +2003,7 @@ static errr finish_parse_monster(struct parser *p) {
 	}
 
 	/* Convert friend and shape names into race pointers */
+	index_monster_names();
 	for (i = 0; i < z_info->r_max; i++) {
 		struct monster_race *race = &r_info[i];
 		struct monster_friends *f;
@@ -2140,6 +2141,7 @@ static void cleanup_monster(void)
 {
 	int ridx;
 
+	free_monster_names();
 	for (ridx = 0; ridx < z_info->r_max; ridx++)
 		cleanup_monster_race(&r_info[ridx]);
 
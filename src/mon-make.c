@@ -52,10 +52,39 @@
  * - prob3 is calculated by get_mon_num(), which checks whether universal
  *         restrictions apply (for example, unique monsters can only appear
  *         once on a given level); prob3 is always either prob2 or 0.
+ *
+ * get_mon_num() keeps prob3 and its running totals from one call to the next,
+ * only working them out again when the level, quest, date or prob2 change.
+ * Uniques and special monsters can come and go between any two calls, so
+ * just those entries are checked every time.
  * ------------------------------------------------------------------------ */
 static int16_t alloc_race_size;
 static struct alloc_entry *alloc_race_table;
 
+/**
+ * alloc_race_total[i] is the total of prob3 over the first i entries; only
+ * the first alloc_race_count entries are shallow enough to be counted
+ */
+static long *alloc_race_total;
+static int16_t alloc_race_count;
+
+/**
+ * The counted entries whose prob2 is set and whose prob3 can change on any call
+ */
+static int16_t *alloc_race_changeable;
+static int16_t alloc_race_changeable_size;
+
+/**
+ * What the totals were worked out for
+ */
+static struct {
+	bool valid;
+	int generated_level;
+	int current_level;
+	int active_quest;
+	bool christmas;
+} alloc_race_key;
+
 /**
  * Initialize monster allocation info
  */
@@ -94,8 +123,11 @@ static void init_race_allocs(void) {
 	/* Paranoia */
 	if (!num[0]) quit("No town monsters!");
 
-	/* Allocate the alloc_race_table */
+	/* Allocate the alloc_race_table and its totals */
 	alloc_race_table = mem_zalloc(alloc_race_size * sizeof(alloc_entry));
+	alloc_race_total = mem_zalloc((alloc_race_size + 1) * sizeof(long));
+	alloc_race_changeable = mem_zalloc(alloc_race_size * sizeof(int16_t));
+	alloc_race_key.valid = false;
 
 	/* Get the table entry */
 	table = alloc_race_table;
@@ -140,6 +172,8 @@ static void init_race_allocs(void) {
 }
 
 static void cleanup_race_allocs(void) {
+	mem_free(alloc_race_changeable);
+	mem_free(alloc_race_total);
 	mem_free(alloc_race_table);
 }
 
@@ -167,31 +201,34 @@ void get_mon_num_prep(bool (*get_mon_num_hook)(struct monster_race *race))
 			entry->prob2 = 0;
 		}
 	}
+
+	/* The totals need working out again */
+	alloc_race_key.valid = false;
 }
 
 /**
- * Helper function for get_mon_num(). Scans the prepared monster allocation
- * table and picks a random monster. Returns the index of a monster in
- * `table`.
+ * Helper function for get_mon_num(). Picks a random monster from the prepared
+ * monster allocation table, by a binary search of the running totals for the
+ * first entry that takes them past the value rolled.
  */
-static struct monster_race *get_mon_race_aux(long total,
-											 const alloc_entry *table)
+static struct monster_race *get_mon_race_aux(long total)
 {
-	int i;
+	int low = 0, high = alloc_race_count - 1;
 
 	/* Pick a monster */
 	long value = randint0(total);
 
 	/* Find the monster */
-	for (i = 0; i < alloc_race_size; i++) {
-		/* Found the entry */
-		if (value < table[i].prob3) break;
+	while (low < high) {
+		int mid = (low + high) / 2;
 
-		/* Decrement */
-		value -= table[i].prob3;
+		if (alloc_race_total[mid + 1] > value)
+			high = mid;
+		else
+			low = mid + 1;
 	}
 
-	return &r_info[table[i].index];
+	return &r_info[alloc_race_table[low].index];
 }
 
 /* Returns true if it is acceptable to generate a SPECIAL_GEN monster.
@@ -218,6 +255,140 @@ bool special_can_gen(struct monster_race *r)
 	return false;
 }
 
+/**
+ * Check whether it is Christmas, when seasonal monsters come out; the date is
+ * only looked at again once the clock has moved on to another minute.
+ */
+static bool is_christmas(void)
+{
+	static time_t checked;
+	static bool christmas;
+	time_t cur_time = time(NULL);
+
+	if (cur_time / 60 != checked / 60) {
+		struct tm *date = localtime(&cur_time);
+
+		christmas = date->tm_mon == 11 && date->tm_mday >= 24 &&
+			date->tm_mday <= 26;
+		checked = cur_time;
+	}
+	return christmas;
+}
+
+/**
+ * Check the restrictions on generating a race that only change with the level,
+ * the quest and the date.
+ */
+static bool race_allowed_here(const struct monster_race *race,
+		int generated_level, int current_level, bool christmas)
+{
+	/* No town monsters in dungeon */
+	if (generated_level > 0 && race->level <= 0) return false;
+
+	/* No seasonal monsters outside of Christmas */
+	if (rf_has(race->flags, RF_SEASONAL) && !christmas) return false;
+
+	/* Some monsters never appear out of depth */
+	if (rf_has(race->flags, RF_FORCE_DEPTH) && race->level > current_level)
+		return false;
+
+	/* Some quests limit generation */
+	if (player->active_quest >= 0) {
+		struct quest *q = &player->quests[player->active_quest];
+		if (q->flags & QF_HOME) {
+			int i;
+
+			for (i = 0; i < q->races; i++) {
+				if (q->race[i] == race) return true;
+			}
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Check the restrictions on generating a race that can change at any time.
+ */
+static bool race_allowed_now(struct monster_race *race)
+{
+	/* Only one copy of a unique must be around at the same time */
+	if (rf_has(race->flags, RF_UNIQUE) && (race->cur_num >= race->max_num))
+		return false;
+
+	/* Some monsters have special limitations on generation */
+	if (rf_has(race->flags, RF_SPECIAL_GEN) && !special_can_gen(race))
+		return false;
+
+	return true;
+}
+
+/**
+ * Work out prob3 and its running totals afresh for the given levels.
+ */
+static void total_race_allocs(int generated_level, int current_level,
+		bool christmas)
+{
+	int i;
+
+	alloc_race_changeable_size = 0;
+	alloc_race_total[0] = 0;
+	for (i = 0; i < alloc_race_size; i++) {
+		alloc_entry *entry = &alloc_race_table[i];
+		struct monster_race *race = &r_info[entry->index];
+
+		/* Monsters are sorted by depth */
+		if (entry->level > generated_level) break;
+
+		/* Default */
+		entry->prob3 = 0;
+
+		if (entry->prob2 && race_allowed_here(race, generated_level,
+				current_level, christmas)) {
+			/* Note the entries that need checking on every call */
+			if (rf_has(race->flags, RF_UNIQUE) ||
+				rf_has(race->flags, RF_SPECIAL_GEN))
+				alloc_race_changeable[alloc_race_changeable_size++] = i;
+
+			/* Accept */
+			if (race_allowed_now(race))
+				entry->prob3 = entry->prob2;
+		}
+
+		/* Total */
+		alloc_race_total[i + 1] = alloc_race_total[i] + entry->prob3;
+	}
+	alloc_race_count = i;
+
+	alloc_race_key.valid = true;
+	alloc_race_key.generated_level = generated_level;
+	alloc_race_key.current_level = current_level;
+	alloc_race_key.active_quest = player->active_quest;
+	alloc_race_key.christmas = christmas;
+}
+
+/**
+ * Bring prob3 and its running totals up to date for the uniques and special
+ * monsters that have come or gone since they were worked out.
+ */
+static void retotal_race_allocs(void)
+{
+	int n, i;
+
+	for (n = 0; n < alloc_race_changeable_size; n++) {
+		alloc_entry *entry = &alloc_race_table[alloc_race_changeable[n]];
+		int prob3 = race_allowed_now(&r_info[entry->index]) ?
+			entry->prob2 : 0;
+
+		if (prob3 == entry->prob3) continue;
+		for (i = alloc_race_changeable[n] + 1; i <= alloc_race_count; i++) {
+			alloc_race_total[i] += prob3 - entry->prob3;
+		}
+		entry->prob3 = prob3;
+	}
+}
+
 /**
  * Chooses a monster race that seems appropriate to the given level
  *
@@ -246,78 +417,33 @@ bool special_can_gen(struct monster_race *r)
  */
 struct monster_race *get_mon_num(int generated_level, int current_level)
 {
-	int i, p;
+	int p;
 	long total;
 	struct monster_race *race;
-	alloc_entry *table = alloc_race_table;
-	time_t cur_time = time(NULL);
-	struct tm *date = localtime(&cur_time);
+	bool christmas = is_christmas();
 
 	/* Occasionally produce a nastier monster in the dungeon */
 	if (generated_level > 0 && one_in_(z_info->ood_monster_chance))
 		generated_level += MIN(generated_level / 4 + 2,
 			z_info->ood_monster_amount);
 
-	total = 0L;
-
 	/* Process probabilities */
-	for (i = 0; i < alloc_race_size; i++) {
-		/* Monsters are sorted by depth */
-		if (table[i].level > generated_level) break;
-
-		/* Default */
-		table[i].prob3 = 0;
-
-		/* No town monsters in dungeon */
-		if (generated_level > 0 && table[i].level <= 0) continue;
-
-		/* Get the chosen monster */
-		race = &r_info[table[i].index];
-
-		/* No seasonal monsters outside of Christmas */
-		if (rf_has(race->flags, RF_SEASONAL) &&
-			!(date->tm_mon == 11 && date->tm_mday >= 24 && date->tm_mday <= 26))
-			continue;
-
-		/* Only one copy of a unique must be around at the same time */
-		if (rf_has(race->flags, RF_UNIQUE) && (race->cur_num >= race->max_num))
-			continue;
-
-		/* Some monsters never appear out of depth */
-		if (rf_has(race->flags, RF_FORCE_DEPTH) && race->level > current_level)
-			continue;
-
-		/* Some monsters have special limitations on generation */
-		if (rf_has(race->flags, RF_SPECIAL_GEN) && !special_can_gen(race))
-			continue;
-
-		/* Some quests limit generation */
-		if (player->active_quest >= 0) {
-			struct quest *q = &player->quests[player->active_quest];
-			if (q->flags & QF_HOME) {
-				bool ok = false;
-				for(int i=0;i<q->races;i++) {
-					if (q->race[i] == race) {
-						ok = true;
-						break;
-					}
-				}
-				if (!ok) continue;
-			}
-		}
-
-		/* Accept */
-		table[i].prob3 = table[i].prob2;
-
-		/* Total */
-		total += table[i].prob3;
+	if (alloc_race_key.valid &&
+		alloc_race_key.generated_level == generated_level &&
+		alloc_race_key.current_level == current_level &&
+		alloc_race_key.active_quest == player->active_quest &&
+		alloc_race_key.christmas == christmas) {
+		retotal_race_allocs();
+	} else {
+		total_race_allocs(generated_level, current_level, christmas);
 	}
+	total = alloc_race_total[alloc_race_count];
 
 	/* No legal monsters */
 	if (total <= 0) return NULL;
 
 	/* Pick a monster */
-	race = get_mon_race_aux(total, table);
+	race = get_mon_race_aux(total);
 
 	/* Quests are difficult enough already */
 	if (player->active_quest < 0) {
@@ -330,7 +456,7 @@ struct monster_race *get_mon_num(int generated_level, int current_level)
 				struct monster_race *old = race;
 
 				/* Pick a new monster */
-				race = get_mon_race_aux(total, table);
+				race = get_mon_race_aux(total);
 
 				/* Keep the deepest one */
 				if (race->level < old->level) race = old;
@@ -341,7 +467,7 @@ struct monster_race *get_mon_num(int generated_level, int current_level)
 				struct monster_race *old = race;
 
 				/* Pick a monster */
-				race = get_mon_race_aux(total, table);
+				race = get_mon_race_aux(total);
 
 				/* Keep the deepest one */
 				if (race->level < old->level) race = old;
@@ -461,6 +587,7 @@ void delete_monster_idx(int m_idx)
 	}
 
 	/* Wipe the Monster */
+	monster_unschedule(cave, m_idx);
 	memset(mon, 0, sizeof(struct monster));
 
 	/* Count monsters */
@@ -548,9 +675,12 @@ void monster_index_move(int i1, int i2)
 	}
 
 	/* Move monster */
+	monster_settle_energy(cave, mon);
+	monster_unschedule(cave, i1);
 	memcpy(cave_monster(cave, i2),
 			cave_monster(cave, i1),
 			sizeof(struct monster));
+	monster_schedule(cave, cave_monster(cave, i2));
 
 	/* Wipe hole */
 	memset(cave_monster(cave, i1), 0, sizeof(struct monster));
@@ -716,6 +846,9 @@ void wipe_mon_list(struct chunk *c, struct player *p)
 	/* Reset "reproducer" count */
 	c->num_repro = 0;
 
+	/* Clear the scheduling wheel */
+	schedule_monsters(c);
+
 	/* Hack -- no more target */
 	target_set_monster(0);
 
@@ -1112,6 +1245,10 @@ int16_t place_monster(struct chunk *c, struct loc grid, struct monster *mon,
 	/* Assign monster to its monster group */
 	monster_group_assign(c, new_mon, info, loading);
 
+	/* Start giving it energy from now */
+	new_mon->energy_turn = c->mon_clock;
+	monster_schedule(c, new_mon);
+
 	update_mon(new_mon, c, true);
 
 	/* Count the number of "reproducers" */
@@ -124,10 +124,11 @@ static bool monster_can_hear(struct chunk *c, struct monster *mon)
  */
 static bool monster_can_smell(struct chunk *c, struct monster *mon)
 {
-	if (c->scent.grids[mon->grid.y][mon->grid.x] == 0) {
+	int scent = square_scent(c, mon->grid);
+	if (scent == 0) {
 		return false;
 	}
-	return mon->race->smell > c->scent.grids[mon->grid.y][mon->grid.x];
+	return mon->race->smell > scent;
 }
 
 /**
@@ -397,34 +398,29 @@ static bool get_move_bodyguard(struct chunk *c, struct monster *mon)
 	return false;
 }
 
-/* Target the nearest visible hated monster. */
-static void target_closest_hated(struct chunk *c, struct monster *mon)
+/**
+ * Is target a hated monster which mon can see?
+ */
+static bool closest_hated_accept(struct chunk *c, struct monster *target,
+								 void *data)
 {
-	int distance = 1e9;
-	struct monster *best = NULL;
-
-	for (int m_idx = 1; m_idx < cave_monster_max(c); m_idx++) {
-		struct monster *target = cave_monster(c, m_idx);
-
-		/* Skip "dead" monsters */
-		if (!target->race) continue;
+	struct monster *mon = data;
 
-		/* Don't hit yourself now */
-		if (target->midx == mon->midx) continue;
+	/* Don't hit yourself now */
+	if (target->midx == mon->midx) return false;
 
-		/* Hated? */
-		if (!mon_hates_mon(mon, target)) continue;
+	/* Hated? */
+	if (!mon_hates_mon(mon, target)) return false;
 
-		/* Visible? */
-		if (los(cave, mon->grid, target->grid)) {
-			int target_distance = ((target->grid.x - mon->grid.x) * (target->grid.x - mon->grid.x)) + ((target->grid.y - mon->grid.y) * (target->grid.y - mon->grid.y));
+	/* Visible? */
+	return los(c, mon->grid, target->grid);
+}
 
-			if (target_distance < distance) {
-				distance = target_distance;
-				best = target;
-			}
-		}
-	}
+/* Target the nearest visible hated monster. */
+static void target_closest_hated(struct chunk *c, struct monster *mon)
+{
+	struct monster *best = cave_monster_nearest(c, mon->grid,
+		closest_hated_accept, mon);
 
 	if (best) {
 		mon->target.midx = best->midx;
@@ -463,12 +459,65 @@ static struct loc get_target(struct chunk *c, struct monster *mon)
 	return mon->target.grid;
 }
 
+/**
+ * The kind of flow field a monster should follow
+ */
+static int monster_flow_kind(const struct monster *mon)
+{
+	if (monster_passes_walls(mon)) return FLOW_WALLS;
+	if (rf_has(mon->race->flags, RF_ALL_TERRAIN)) return FLOW_ANY_TERRAIN;
+	return FLOW_WALK;
+}
+
+/**
+ * Choose a step toward a target other than the player, using the flow field
+ * toward it which is shared with any other monsters heading the same way.
+ */
+static bool get_move_flow(struct chunk *c, struct monster *mon,
+						  struct loc target, struct loc *step)
+{
+	const struct flow_field *flow = cave_flow_field(c, target,
+		monster_flow_kind(mon));
+	int best = flow->steps.grids[mon->grid.y][mon->grid.x];
+	struct loc best_grid = mon->grid;
+	int i;
+
+	/* Too far away, or no way there */
+	if (!best) return false;
+
+	for (i = 0; i < 8; i++) {
+		struct loc grid = loc_sum(mon->grid, ddgrid_ddd[i]);
+		int steps;
+
+		/* Bounds check */
+		if (!square_in_bounds(c, grid)) continue;
+
+		/* Must be closer to the target */
+		steps = flow->steps.grids[grid.y][grid.x];
+		if (!steps || steps >= best) continue;
+
+		/* There's a monster blocking that we can't deal with */
+		if (!monster_can_kill(c, mon, grid) && !monster_can_move(c, mon, grid))
+			continue;
+
+		/* There's damaging terrain */
+		if (monster_hates_grid(c, mon, grid)) continue;
+
+		best = steps;
+		best_grid = grid;
+	}
+
+	if (loc_eq(best_grid, mon->grid)) return false;
+	*step = best_grid;
+	return true;
+}
+
 /**
  * Choose the best direction to advance toward the target, using sound or scent.
  *
  * Ghosts and rock-eaters generally just head straight for the target. Other
  * monsters try sight, then current sound as saved in c->noise.grids[y][x],
- * then current scent as saved in c->scent.grids[y][x].
+ * then current scent as given by square_scent().
  *
  * This function assumes the monster is moving to an adjacent grid, and so the
  * noise can be louder by at most 1.  The monster target grid set by sound or
@@ -482,6 +531,10 @@ static struct loc get_target(struct chunk *c, struct monster *mon)
  * were chasing the player to converge on that location as long as the player
  * is still near enough to "annoy" them without being close enough to chase
  * directly.
+ *
+ * Monsters after a decoy or another monster instead follow a flow field
+ * toward it, as sound and scent only lead to the player; a monster is
+ * followed to where it was last seen.
  */
 static bool get_move_advance(struct chunk *c, struct monster *mon, bool *track)
 {
@@ -500,6 +553,17 @@ static bool get_move_advance(struct chunk *c, struct monster *mon, bool *track)
 	bool found = false;
 	bool found_backup = false;
 	bool player = (mon->target.midx == 0);
+	bool decoyed = player && !mflag_has(mon->mflag, MFLAG_NEUTRAL) &&
+		monster_is_decoyed(mon);
+
+	/* Monsters hunting other monsters go by where they last saw them */
+	if (!player) {
+		struct monster *quarry = cave_monster(c, mon->target.midx);
+
+		if (quarry->race && monster_can_see_target(c, mon, quarry->grid))
+			mon->target.grid = quarry->grid;
+		target = mon->target.grid;
+	}
 
 	/* Bodyguards are special */
 	if (mon->group_info[PRIMARY_GROUP].role == MON_GROUP_BODYGUARD) {
@@ -527,7 +591,7 @@ static bool get_move_advance(struct chunk *c, struct monster *mon, bool *track)
 	}
 
 	/* Sound and scent only make sense if the player is the target */
-	if (player) {
+	if (player && !decoyed) {
 		/* Try to use sound */
 		if (monster_can_hear(c, mon)) {
 			/* Check nearby sound, giving preference to the cardinal directions */
@@ -576,18 +640,21 @@ static bool get_move_advance(struct chunk *c, struct monster *mon, bool *track)
 			for (i = 0; i < 8; i++) {
 				/* Get the location */
 				struct loc grid = loc_sum(mon->grid, ddgrid_ddd[i]);
+				int scent = square_scent(c, grid);
 				int smelled_scent;
 
 				/* If no good sound yet, use scent */
-				smelled_scent = mon->race->smell - c->scent.grids[grid.y][grid.x];
-				if ((smelled_scent > best_scent) &&
-					(c->scent.grids[grid.y][grid.x] != 0)) {
+				smelled_scent = mon->race->smell - scent;
+				if ((smelled_scent > best_scent) && (scent != 0)) {
 					best_scent = smelled_scent;
 					best_grid = grid;
 					found = true;
 				}
 			}
 		}
+	} else {
+		/* Head for a decoy or monster by the shared flow toward it */
+		found = get_move_flow(c, mon, target, &best_grid);
 	}
 
 	/* Set the target */
@@ -2097,16 +2164,316 @@ static void regen_monster(struct monster *mon, int num)
 }
 
 
+/**
+ * ------------------------------------------------------------------------
+ * Monster scheduling
+ *
+ * Monsters are given energy lazily: each monster's energy is correct as of
+ * the start of game turn energy_turn, and it is filed on the wheel under
+ * the game turn at which it will next have enough energy to act at its
+ * current speed.  Anything which changes a monster's energy or speed must
+ * settle its energy first and reschedule it afterwards.
+ *
+ * The level's mon_clock is the game turn whose energy has not yet been
+ * given to every monster; it moves on when reset_monsters() ends the turn.
+ *
+ * Monsters which are unhurt, on safe ground and too far away to see, hear
+ * or smell the player do nothing on their turns but spend their energy, so
+ * they are made dormant: taken off the wheel altogether, with their energy
+ * worked out in one go when it is next needed.  They are brought back when
+ * the player comes within reach, or when anything wakes, hurts, moves or
+ * changes the speed of them.
+ * ------------------------------------------------------------------------ */
+/**
+ * A monster's speed, allowing for haste and slowing.
+ */
+static int monster_net_speed(const struct monster *mon)
+{
+	int mspeed = mon->mspeed;
+
+	if (mon->m_timed[MON_TMD_FAST])
+		mspeed += 10;
+	if (mon->m_timed[MON_TMD_SLOW]) {
+		int slow_level = monster_effect_level(mon, MON_TMD_SLOW);
+		mspeed -= (2 * slow_level);
+	}
+
+	return mspeed;
+}
+
+/**
+ * Give a monster the energy it has gained since its energy was last
+ * brought up to date, at its current speed.  A dormant monster has also
+ * spent move_energy on each of those turns it started with enough to act.
+ */
+void monster_settle_energy(struct chunk *c, struct monster *mon)
+{
+	int32_t turns = c->mon_clock - mon->energy_turn;
+	int gain, move = z_info->move_energy;
+
+	if (turns <= 0) return;
+
+	gain = turn_energy(monster_net_speed(mon));
+	if (c->mon_dormant[mon->midx] && gain <= move && mon->energy < 2 * move) {
+		/* Energy never falls more than one turn's worth behind */
+		int32_t acts = (mon->energy + (turns - 1) * gain) / move;
+
+		mon->energy += turns * gain - acts * move;
+	} else {
+		int energy = mon->energy + turns * gain;
+
+		mon->energy = MIN(energy, UCHAR_MAX);
+	}
+	mon->energy_turn = c->mon_clock;
+}
+
+/**
+ * Take a monster off the scheduling wheel, if it is on it, or stop it
+ * being dormant.  Its energy must have been settled first.
+ */
+void monster_unschedule(struct chunk *c, int midx)
+{
+	int prev = c->mon_due_prev[midx], next = c->mon_due_next[midx];
+
+	if (c->mon_dormant[midx]) {
+		c->mon_dormant[midx] = false;
+		c->mon_dormant_cnt--;
+	}
+	if (!c->mon_due[midx]) return;
+
+	if (prev) {
+		c->mon_due_next[prev] = next;
+	} else {
+		c->mon_wheel[c->mon_due[midx] & (MON_WHEEL_SIZE - 1)] = next;
+	}
+	if (next) c->mon_due_prev[next] = prev;
+
+	c->mon_due_next[midx] = 0;
+	c->mon_due_prev[midx] = 0;
+	c->mon_due[midx] = 0;
+}
+
+/**
+ * Put a monster on the scheduling wheel under the game turn when it will
+ * next have the energy to act.  Monsters which gain no energy are left off
+ * it until their speed changes.
+ */
+void monster_schedule(struct chunk *c, struct monster *mon)
+{
+	int needed, gain;
+	int32_t due;
+
+	/* Only monsters actually on the level */
+	if (!mon->race || cave_monster(c, mon->midx) != mon) return;
+
+	monster_settle_energy(c, mon);
+	monster_unschedule(c, mon->midx);
+
+	needed = z_info->move_energy - mon->energy;
+	gain = turn_energy(monster_net_speed(mon));
+	if (needed <= 0) {
+		due = mon->energy_turn;
+	} else if (gain > 0) {
+		due = mon->energy_turn + (needed + gain - 1) / gain;
+	} else {
+		return;
+	}
+
+	c->mon_due[mon->midx] = due;
+	c->mon_due_next[mon->midx] = c->mon_wheel[due & (MON_WHEEL_SIZE - 1)];
+	if (c->mon_due_next[mon->midx]) {
+		c->mon_due_prev[c->mon_due_next[mon->midx]] = mon->midx;
+	}
+	c->mon_wheel[due & (MON_WHEEL_SIZE - 1)] = mon->midx;
+}
+
+/**
+ * The distance from the player beyond which a monster can neither see nor
+ * hear them, however the level lies in between.  Noise spreads a grid at a
+ * time and view stops at max_sight, so this is measured grid by grid in the
+ * same way.  Monsters that pass through walls go straight for a player
+ * within their full hearing, as in monster_check_active().  Scent is left
+ * behind rather than spread, so it is checked on the monster's own grid.
+ */
+static int monster_reach(const struct monster *mon)
+{
+	int hearing = mon->race->hearing
+		- player->state.skills[SKILL_STEALTH] / 3;
+
+	if (monster_passes_walls(mon))
+		hearing = MAX(hearing, mon->race->hearing);
+
+	return MAX(z_info->max_sight, hearing);
+}
+
+static int grid_steps(struct loc grid1, struct loc grid2)
+{
+	return MAX(ABS(grid1.y - grid2.y), ABS(grid1.x - grid2.x));
+}
+
+/**
+ * Make a monster which has just found itself inactive dormant, if nothing
+ * but the player coming within reach could make it active again.
+ */
+static void monster_try_dormancy(struct chunk *c, struct monster *mon)
+{
+	if (mon->hp < mon->maxhp || c->mon_hazard_pos[mon->midx]) return;
+	if (grid_steps(mon->grid, player->grid) <= monster_reach(mon)) return;
+
+	/* Scent is left where the player was, not spread from where they are */
+	if (monster_can_smell(c, mon)) return;
+
+	monster_unschedule(c, mon->midx);
+	c->mon_dormant[mon->midx] = true;
+	c->mon_dormant_cnt++;
+	c->mon_dormant_hearing = MAX(c->mon_dormant_hearing, mon->race->hearing);
+	if (monster_passes_walls(mon))
+		c->mon_dormant_wall_hearing = MAX(c->mon_dormant_wall_hearing,
+			mon->race->hearing);
+}
+
+/**
+ * Bring a dormant monster back to being processed every time it can act.
+ */
+void monster_promote(struct chunk *c, struct monster *mon)
+{
+	if (c && c->mon_dormant[mon->midx]) monster_schedule(c, mon);
+}
+
+static bool promote_visit(struct chunk *c, struct monster *mon, void *data)
+{
+	if (c->mon_dormant[mon->midx] &&
+		grid_steps(mon->grid, player->grid) <= monster_reach(mon))
+		monster_schedule(c, mon);
+	return false;
+}
+
+/**
+ * Bring back any dormant monsters which the player has come within reach
+ * of, by moving or by getting less stealthy.
+ */
+void promote_monsters(struct chunk *c)
+{
+	int stealth = player->state.skills[SKILL_STEALTH];
+	int reach;
+
+	if (!c->mon_dormant_cnt) return;
+	if (loc_eq(c->mon_dormant_grid, player->grid) &&
+		c->mon_dormant_stealth == stealth)
+		return;
+	c->mon_dormant_grid = player->grid;
+	c->mon_dormant_stealth = stealth;
+
+	/* The furthest any of them reaches, as in monster_reach() */
+	reach = MAX(z_info->max_sight, c->mon_dormant_hearing - stealth / 3);
+	reach = MAX(reach, c->mon_dormant_wall_hearing);
+	cave_monsters_in_rect(c, loc(player->grid.x - reach, player->grid.y - reach),
+		loc(player->grid.x + reach, player->grid.y + reach), promote_visit,
+		NULL);
+}
+
+/**
+ * Set a monster's energy directly.
+ */
+void monster_set_energy(struct monster *mon, int energy)
+{
+	monster_settle_energy(cave, mon);
+	mon->energy = energy;
+	monster_schedule(cave, mon);
+}
+
+/**
+ * Bring the energy of every monster on a level up to date, before it is
+ * left or saved.
+ */
+void settle_monsters(struct chunk *c)
+{
+	int i;
+
+	for (i = 1; i < cave_monster_max(c); i++) {
+		struct monster *mon = cave_monster(c, i);
+		if (mon->race) monster_settle_energy(c, mon);
+	}
+}
+
+/**
+ * Schedule every monster on a level which is being entered.  No energy is
+ * given for time spent away from the level.
+ */
+void schedule_monsters(struct chunk *c)
+{
+	int i;
+
+	c->mon_clock = turn;
+	memset(c->mon_wheel, 0, MON_WHEEL_SIZE * sizeof(uint16_t));
+	for (i = 1; i < z_info->level_monster_max; i++) {
+		c->mon_due_next[i] = 0;
+		c->mon_due_prev[i] = 0;
+		c->mon_due[i] = 0;
+		c->mon_dormant[i] = false;
+	}
+	c->mon_dormant_cnt = 0;
+	c->mon_dormant_hearing = 0;
+	c->mon_dormant_wall_hearing = 0;
+
+	for (i = 1; i < cave_monster_max(c); i++) {
+		struct monster *mon = cave_monster(c, i);
+
+		if (!mon->race) continue;
+		mon->energy_turn = turn;
+		monster_schedule(c, mon);
+	}
+}
+
+/**
+ * Sort monster indices, highest first.
+ */
+static int cmp_midx_desc(const void *a, const void *b)
+{
+	return (int) *(const uint16_t *) b - (int) *(const uint16_t *) a;
+}
+
+/**
+ * List the monsters yet to be handled this turn which have the energy to
+ * act (or all of them, if regenerating), highest index first.
+ */
+static int collect_acting_monsters(struct chunk *c, bool all)
+{
+	int n = 0, midx;
+
+	if (all) {
+		for (midx = cave_monster_max(c) - 1; midx >= 1; midx--) {
+			struct monster *mon = cave_monster(c, midx);
+			if (mon->race && mon->energy_turn <= turn &&
+				!c->mon_dormant[midx])
+				c->mon_acting[n++] = midx;
+		}
+		return n;
+	}
+
+	for (midx = c->mon_wheel[turn & (MON_WHEEL_SIZE - 1)]; midx;
+		 midx = c->mon_due_next[midx]) {
+		if (c->mon_due[midx] == turn &&
+			cave_monster(c, midx)->energy_turn <= turn)
+			c->mon_acting[n++] = midx;
+	}
+	sort(c->mon_acting, n, sizeof(c->mon_acting[0]), cmp_midx_desc);
+	return n;
+}
+
 /**
  * ------------------------------------------------------------------------
  * Monster processing routines to be called by the main game loop
  * ------------------------------------------------------------------------ */
 /**
- * Process all the "live" monsters, once per game turn.
+ * Process the "live" monsters which can act, once per game turn.
  *
- * During each game turn, we scan through the list of all the "live" monsters,
- * (backwards, so we can excise any "freshly dead" monsters), energizing each
- * monster, and allowing fully energized monsters to move, attack, pass, etc.
+ * During each game turn, we take the monsters from the scheduling wheel
+ * which have enough energy to act (highest index first, as the whole list
+ * used to be scanned backwards), energizing each monster and allowing it to
+ * move, attack, pass, etc.  Every 100 game turns all monsters are processed,
+ * so they can regenerate.  Monsters which are sped up enough to act while
+ * this is happening are picked up by going round again.
  *
  * This function and its children are responsible for a considerable fraction
  * of the processor time in normal situations, greater if the character is
@@ -2114,8 +2481,8 @@ static void regen_monster(struct monster *mon, int num)
  */
 void process_monsters(struct chunk *c, int minimum_energy)
 {
-	int i;
-	int mspeed;
+	int i, n;
+	bool handled = true;
 
 	/* Only process some things every so often */
 	bool regen = false;
@@ -2124,72 +2491,79 @@ void process_monsters(struct chunk *c, int minimum_energy)
 	if (turn % 100 == 0)
 		regen = true;
 
-	/* Process the monsters (backwards) */
-	for (i = cave_monster_max(c) - 1; i >= 1; i--) {
-		struct monster *mon;
-		bool moving;
-
-		/* Handle "leaving" */
-		if (player->is_dead || player->upkeep->generate_level) break;
+	/* Dormant monsters the player has come near take their turns again */
+	promote_monsters(c);
 
-		/* Get a 'live' monster */
-		mon = cave_monster(c, i);
-		if (!mon->race) continue;
+	/* Process the monsters */
+	while (handled && (n = collect_acting_monsters(c, regen)) > 0) {
+		handled = false;
+		for (i = 0; i < n; i++) {
+			struct monster *mon;
+			bool moving;
 
-		/* Ignore monsters that have already been handled */
-		if (mflag_has(mon->mflag, MFLAG_HANDLED))
-			continue;
+			/* Handle "leaving" */
+			if (player->is_dead || player->upkeep->generate_level) break;
 
-		/* Not enough energy to move yet */
-		if (mon->energy < minimum_energy) continue;
+			/* Get a 'live' monster */
+			mon = cave_monster(c, c->mon_acting[i]);
+			if (!mon->race) continue;
 
-		/* Does this monster have enough energy to move? */
-		moving = mon->energy >= z_info->move_energy ? true : false;
+			/* Ignore monsters that have already been handled */
+			if (mon->energy_turn > turn)
+				continue;
 
-		/* Prevent reprocessing */
-		mflag_on(mon->mflag, MFLAG_HANDLED);
+			/* Not enough energy to move yet */
+			monster_settle_energy(c, mon);
+			if (mon->energy < minimum_energy) continue;
 
-		/* Handle monster regeneration if requested */
-		if (regen)
-			regen_monster(mon, 1);
+			/* Does this monster have enough energy to move? */
+			moving = mon->energy >= z_info->move_energy ? true : false;
 
-		/* Calculate the net speed */
-		mspeed = mon->mspeed;
-		if (mon->m_timed[MON_TMD_FAST])
-			mspeed += 10;
-		if (mon->m_timed[MON_TMD_SLOW]) {
-			int slow_level = monster_effect_level(mon, MON_TMD_SLOW);
-			mspeed -= (2 * slow_level);
-		}
+			/* Prevent reprocessing */
+			handled = true;
 
-		/* Give this monster some energy */
-		mon->energy += turn_energy(mspeed);
+			/* Handle monster regeneration if requested */
+			if (regen)
+				regen_monster(mon, 1);
 
-		/* End the turn of monsters without enough energy to move */
-		if (!moving)
-			continue;
+			/* Give this monster some energy */
+			mon->energy += turn_energy(monster_net_speed(mon));
+			mon->energy_turn = turn + 1;
 
-		/* Use up "some" energy */
-		mon->energy -= z_info->move_energy;
+			/* Use up "some" energy */
+			if (moving)
+				mon->energy -= z_info->move_energy;
 
-		/* Mimics lie in wait */
-		if (monster_is_mimicking(mon)) continue;
+			/* Work out when it can next act */
+			monster_schedule(c, mon);
 
-		/* Check if the monster is active */
-		if (monster_check_active(c, mon)) {
-			/* Process timed effects - skip turn if necessary */
-			if (process_monster_timed(c, mon))
+			/* End the turn of monsters without enough energy to move */
+			if (!moving)
 				continue;
 
-			/* Set this monster to be the current actor */
-			c->mon_current = i;
+			/* Mimics lie in wait */
+			if (monster_is_mimicking(mon)) continue;
+
+			/* Check if the monster is active */
+			if (monster_check_active(c, mon)) {
+				/* Process timed effects - skip turn if necessary */
+				if (process_monster_timed(c, mon))
+					continue;
+
+				/* Set this monster to be the current actor */
+				c->mon_current = mon->midx;
 
-			/* The monster takes its turn */
-			monster_turn(c, mon);
+				/* The monster takes its turn */
+				monster_turn(c, mon);
 
-			/* Monster is no longer current */
-			c->mon_current = -1;
+				/* Monster is no longer current */
+				c->mon_current = -1;
+			} else {
+				/* Stop handling it if it's out of the player's reach */
+				monster_try_dormancy(c, mon);
+			}
 		}
+		if (player->is_dead || player->upkeep->generate_level) break;
 	}
 
 	/* Update monster visibility after this */
@@ -2198,26 +2572,31 @@ void process_monsters(struct chunk *c, int minimum_energy)
 }
 
 /**
- * Clear 'moved' status from all monsters.
- *
- * Clear noise if appropriate.
+ * Apply terrain damage to the monsters standing on damaging terrain, and
+ * end the game turn for monsters.
  */
 void reset_monsters(void)
 {
-	int i;
-	struct monster *mon;
+	int i, n = cave->mon_hazard_cnt;
+
+	/* Take a copy, as monsters may die */
+	memcpy(cave->mon_acting, cave->mon_hazard, n * sizeof(uint16_t));
+	sort(cave->mon_acting, n, sizeof(cave->mon_acting[0]), cmp_midx_desc);
 
 	/* Process the monsters (backwards) */
-	for (i = cave_monster_max(cave) - 1; i >= 1; i--) {
+	for (i = 0; i < n; i++) {
 		/* Access the monster */
-		mon = cave_monster(cave, i);
+		struct monster *mon = cave_monster(cave, cave->mon_acting[i]);
 
 		/* Dungeon hurts monsters */
-		monster_take_terrain_damage(mon);
-
-		/* Monster is ready to go again */
-		mflag_off(mon->mflag, MFLAG_HANDLED);
+		if (mon->race && cave->mon_hazard_pos[mon->midx]) {
+			monster_promote(cave, mon);
+			monster_take_terrain_damage(mon);
+		}
 	}
+
+	/* Every monster has now had this turn's energy */
+	cave->mon_clock = turn + 1;
 }
 
 /**
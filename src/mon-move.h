@@ -20,6 +20,14 @@
 
 
 bool multiply_monster(struct chunk *c, const struct monster *mon);
+void monster_settle_energy(struct chunk *c, struct monster *mon);
+void monster_unschedule(struct chunk *c, int midx);
+void monster_schedule(struct chunk *c, struct monster *mon);
+void monster_promote(struct chunk *c, struct monster *mon);
+void promote_monsters(struct chunk *c);
+void monster_set_energy(struct monster *mon, int energy);
+void settle_monsters(struct chunk *c);
+void schedule_monsters(struct chunk *c);
 void process_monsters(struct chunk *c, int minimum_energy);
 void reset_monsters(void);
 void restore_monsters(void);
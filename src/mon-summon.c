@@ -22,6 +22,7 @@
 #include "init.h"
 #include "mon-group.h"
 #include "mon-make.h"
+#include "mon-move.h"
 #include "mon-summon.h"
 #include "mon-util.h"
 #include "parser.h"
@@ -382,7 +383,7 @@ static int call_monster(struct loc grid)
 	monster_wake(mon, false, 100);
 
 	/* Set it's energy to 0 */
-	mon->energy = 0;
+	monster_set_energy(mon, 0);
 
 	return (mon->race->level);
 }
@@ -563,7 +564,7 @@ int summon_specific(struct loc grid, struct monster_race *summoner, int lev, int
 	 * including holding faster monsters for the required number of turns */
 	if (delay) {
 		int turns = (mon->race->speed + 9 - player->state.speed) / 10;
-		mon->energy = 0;
+		monster_set_energy(mon, 0);
 		if (turns) {
 			/* Set timer directly to avoid resistance */
 			mon->m_timed[MON_TMD_HOLD] = turns;
@@ -19,6 +19,7 @@
 #include "angband.h"
 #include "mon-desc.h"
 #include "mon-lore.h"
+#include "mon-move.h"
 #include "mon-msg.h"
 #include "mon-predicate.h"
 #include "mon-spell.h"
@@ -154,6 +155,8 @@ static bool mon_set_timed(struct monster *mon,
 
 	int m_note = 0;
 	int old_timer = mon->m_timed[effect_type];
+	bool speed = effect_type == MON_TMD_FAST || effect_type == MON_TMD_SLOW ||
+		effect_type == MON_TMD_CHANGED;
 
 	/* Limit time of effect */
 	if (timer > effect->max_timer) {
@@ -182,6 +185,9 @@ static bool mon_set_timed(struct monster *mon,
 		check_resist = false;
 	}
 
+	/* Energy so far was gained at the old speed */
+	if (speed) monster_settle_energy(cave, mon);
+
 	/* Determine if the monster resisted or not, if appropriate */
 	if (check_resist && does_resist(mon, effect_type, timer, flag)) {
 		resisted = true;
@@ -221,6 +227,9 @@ static bool mon_set_timed(struct monster *mon,
 		player->upkeep->redraw |= (PR_MONLIST);
 	}
 
+	/* Work out when it can next act at the new speed */
+	if (speed) monster_schedule(cave, mon);
+
 	return !resisted;
 }
 
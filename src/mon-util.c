@@ -25,6 +25,7 @@
 #include "mon-list.h"
 #include "mon-lore.h"
 #include "mon-make.h"
+#include "mon-move.h"
 #include "mon-msg.h"
 #include "mon-predicate.h"
 #include "mon-spell.h"
@@ -51,6 +52,7 @@
 #include "ui-store.h"
 #include "world.h"
 #include "z-set.h"
+#include "z-strmap.h"
 
 
 static void gain_mon_exp(const struct monster *mon, bool funny);
@@ -120,6 +122,46 @@ void create_mon_flag_mask(bitflag *f, ...)
  * ------------------------------------------------------------------------
  * Lookup utilities
  * ------------------------------------------------------------------------ */
+/**
+ * Monster races by name, ignoring case
+ */
+static struct strmap *race_names;
+
+/**
+ * Index the monster races by name, once monster.txt has been read.  Where two
+ * share a name, the first is the one found, as with a search of r_info.
+ */
+void index_monster_names(void)
+{
+	int i;
+
+	free_monster_names();
+	race_names = strmap_new(true);
+	for (i = 0; i < z_info->r_max; i++) {
+		if (r_info[i].name)
+			strmap_add(race_names, r_info[i].name, i);
+	}
+}
+
+void free_monster_names(void)
+{
+	strmap_free(race_names);
+	race_names = NULL;
+}
+
+/**
+ * Find the race with exactly the given name, ignoring case, from the index.
+ */
+static struct monster_race *find_monster_name(const char *name)
+{
+	int i = strmap_get(race_names, name);
+
+	if (i < 0 || i >= z_info->r_max || !r_info[i].name ||
+		my_stricmp(name, r_info[i].name))
+		return NULL;
+	return &r_info[i];
+}
+
 /**
  * Returns the monster with the given name. If no monster has the exact name
  * given, returns the first monster with the given name as a (case-insensitive)
@@ -128,7 +170,9 @@ void create_mon_flag_mask(bitflag *f, ...)
 struct monster_race *lookup_monster(const char *name)
 {
 	int i;
-	struct monster_race *closest = NULL;
+	struct monster_race *closest = find_monster_name(name);
+
+	if (closest) return closest;
 
 	/* Look for it */
 	for (i = 0; i < z_info->r_max; i++) {
@@ -162,6 +206,8 @@ int lookup_all_monsters(const char *name, struct monster_race **race, int maxrac
 	int races = 0;
 
 	/* Look for it */
+	*race = find_monster_name(name);
+	if (*race) return 1;
 	for (i = 0; i < z_info->r_max; i++) {
 		struct monster_race *r = &r_info[i];
 		if (!r->name)
@@ -684,6 +730,7 @@ void monster_swap(struct loc grid1, struct loc grid2)
 			}
 		}
 		mon->grid = grid2;
+		monster_promote(cave, mon);
 		update_mon(mon, cave, true);
 
 		/* Affect light? */
@@ -696,6 +743,7 @@ void monster_swap(struct loc grid1, struct loc grid2)
 		/* Player */
 		player->grid = grid2;
 		player_leaving(pgrid, player->grid);
+		promote_monsters(cave);
 
 		/* Update the trap detection status */
 		player->upkeep->redraw |= (PR_DTRAP);
@@ -731,6 +779,7 @@ void monster_swap(struct loc grid1, struct loc grid2)
 			}
 		}
 		mon->grid = grid1;
+		monster_promote(cave, mon);
 		update_mon(mon, cave, true);
 
 		/* Affect light? */
@@ -743,6 +792,7 @@ void monster_swap(struct loc grid1, struct loc grid2)
 		/* Player */
 		player->grid = grid1;
 		player_leaving(pgrid, player->grid);
+		promote_monsters(cave);
 
 		/* Update the trap detection status */
 		player->upkeep->redraw |= (PR_DTRAP);
@@ -805,6 +855,9 @@ void monster_wake(struct monster *mon, bool notify, int aware_chance)
 	if (randint0(100) < aware_chance) {
 		mflag_on(mon->mflag, MFLAG_AWARE);
 	}
+
+	/* Anything disturbing the monster makes it worth processing */
+	monster_promote(cave, mon);
 }
 
 /**
@@ -992,6 +1045,17 @@ static struct monster *get_injured_kin(struct chunk *c,
 	return kin;
 }
 
+/**
+ * Is kin an injured monster which qualifies for get_injured_kin()?
+ */
+static bool injured_kin_visit(struct chunk *c, struct monster *kin,
+							  void *data)
+{
+	const struct monster *mon = data;
+
+	return get_injured_kin(c, mon, kin->grid) != NULL;
+}
+
 /**
  * Find out if there are any injured monsters nearby.
  *
@@ -999,15 +1063,30 @@ static struct monster *get_injured_kin(struct chunk *c,
  */
 bool find_any_nearby_injured_kin(struct chunk *c, const struct monster *mon)
 {
-	struct loc grid;
-	for (grid.y = mon->grid.y - MAX_KIN_RADIUS;
-		 grid.y <= mon->grid.y + MAX_KIN_RADIUS; grid.y++) {
-		for (grid.x = mon->grid.x - MAX_KIN_RADIUS;
-			 grid.x <= mon->grid.x + MAX_KIN_RADIUS; grid.x++) {
-			if (get_injured_kin(c, mon, grid) != NULL) {
-				return true;
-			}
-		}
+	struct loc offset = loc(MAX_KIN_RADIUS, MAX_KIN_RADIUS);
+
+	return cave_monsters_in_rect(c, loc_diff(mon->grid, offset),
+		loc_sum(mon->grid, offset), injured_kin_visit, (void *) mon) != NULL;
+}
+
+/**
+ * Context for collecting injured kin into a set
+ */
+struct injured_kin_set {
+	const struct monster *mon;
+	struct set *set;
+};
+
+/**
+ * Add kin to the set if it qualifies for get_injured_kin().
+ */
+static bool injured_kin_collect(struct chunk *c, struct monster *kin,
+								void *data)
+{
+	struct injured_kin_set *kin_set = data;
+
+	if (get_injured_kin(c, kin_set->mon, kin->grid) != NULL) {
+		set_add(kin_set->set, kin);
 	}
 
 	return false;
@@ -1016,28 +1095,20 @@ bool find_any_nearby_injured_kin(struct chunk *c, const struct monster *mon)
 /**
  * Choose one injured monster of the same base in LOS of the provided monster.
  *
- * Scan MAX_KIN_RADIUS grids around the monster to find potential grids,
- * make a list of kin, and choose a random one.
+ * Look for monsters within MAX_KIN_RADIUS grids of the monster, make a list
+ * of kin, and choose a random one.
  */
 struct monster *choose_nearby_injured_kin(struct chunk *c,
 										  const struct monster *mon)
 {
-	struct set *set = set_new();
-	struct loc grid;
-
-	for (grid.y = mon->grid.y - MAX_KIN_RADIUS;
-		 grid.y <= mon->grid.y + MAX_KIN_RADIUS; grid.y++) {
-		for (grid.x = mon->grid.x - MAX_KIN_RADIUS;
-			 grid.x <= mon->grid.x + MAX_KIN_RADIUS; grid.x++) {
-			struct monster *kin = get_injured_kin(c, mon, grid);
-			if (kin != NULL) {
-				set_add(set, kin);
-			}
-		}
-	}
+	struct injured_kin_set kin_set = { mon, set_new() };
+	struct loc offset = loc(MAX_KIN_RADIUS, MAX_KIN_RADIUS);
+
+	cave_monsters_in_rect(c, loc_diff(mon->grid, offset),
+		loc_sum(mon->grid, offset), injured_kin_collect, &kin_set);
 
-	struct monster *found = set_choose(set);
-	set_free(set);
+	struct monster *found = set_choose(kin_set.set);
+	set_free(kin_set.set);
 
 	return found;
 }
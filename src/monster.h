@@ -413,6 +413,7 @@ struct monster {
 
 	uint8_t mspeed;				/* Monster "speed" */
 	uint8_t energy;				/* Monster "energy" */
+	int32_t energy_turn;		/* Game turn energy has been given up to */
 
 	uint8_t cdis;				/* Current dis from player */
 
@@ -65,6 +65,14 @@ static double *obj_total_tval;
  */
 static double *obj_total_tval_great;
 
+/**
+ * The indices of the object kinds of each tval, in order.  Those of tval, tv,
+ * are obj_tval_kinds[obj_tval_start[tv]] up to but not including
+ * obj_tval_kinds[obj_tval_start[tv + 1]].
+ */
+static int *obj_tval_kinds;
+static int *obj_tval_start;
+
 static alloc_entry *alloc_ego_table;
 
 static int gold_value(int lev, bool explode);
@@ -89,7 +97,7 @@ static bool kind_is_good(const struct object_kind *kind, int level);
  * Initialize object allocation info
  */
 static void alloc_init_objects(void) {
-	int item, lev;
+	int item, lev, tv;
 	int k_max = z_info->k_max;
 
 	/* Allocate */
@@ -97,6 +105,19 @@ static void alloc_init_objects(void) {
 	obj_alloc_great = mem_alloc_alt((z_info->max_obj_depth + 1) * (k_max + 1) * sizeof(*obj_alloc_great));
 	obj_total_tval = mem_zalloc_alt((z_info->max_obj_depth + 1) * TV_MAX * sizeof(*obj_total_tval));
 	obj_total_tval_great = mem_zalloc_alt((z_info->max_obj_depth + 1) * TV_MAX * sizeof(*obj_total_tval));
+	obj_tval_kinds = mem_zalloc(MAX(k_max, 1) * sizeof(*obj_tval_kinds));
+	obj_tval_start = mem_zalloc((TV_MAX + 1) * sizeof(*obj_tval_start));
+
+	/* List the kinds of each tval, counting where each list ends first */
+	for (item = 0; item < k_max; item++) {
+		obj_tval_start[k_info[item].tval]++;
+	}
+	for (tv = 0; tv < TV_MAX; tv++) {
+		obj_tval_start[tv + 1] += obj_tval_start[tv];
+	}
+	for (item = k_max - 1; item >= 0; item--) {
+		obj_tval_kinds[--obj_tval_start[k_info[item].tval]] = item;
+	}
 
 	/* The cumulative chance starts at zero for each level. */
 	for (lev = 0; lev <= z_info->max_obj_depth; lev++) {
@@ -200,6 +221,8 @@ static void cleanup_obj_make(void) {
 	mem_free_alt(obj_total_tval);
 	mem_free_alt(obj_alloc_great);
 	mem_free_alt(obj_alloc);
+	mem_free(obj_tval_start);
+	mem_free(obj_tval_kinds);
 }
 
 /*** Make an ego item ***/
@@ -1259,7 +1282,7 @@ static struct object_kind *get_obj_num_by_kind(int level, bool good, int tval)
 	uint32_t total = 0;
 	uint32_t value;
 
-	int item;
+	int i, item;
 
 	assert(level >= 0 && level <= z_info->max_obj_depth);
 	assert(tval >= 0 && tval < TV_MAX);
@@ -1282,15 +1305,19 @@ static struct object_kind *get_obj_num_by_kind(int level, bool good, int tval)
 	 * Find it.  Having a loop to calculate the cumulative probability
 	 * here with only the tval and applying a binary search was slower
 	 * for a test of getting a TV_SWORD from 4.2's available objects.
-	 * So continue to use the O(N) search.
+	 * So continue to use the O(N) search, but only over the kinds of
+	 * that tval.
 	 */
-	for (item = 0; item < z_info->k_max; item++) {
-		if (objkind_byid(item)->tval == tval) {
-			double prob = objects[item + 1] - objects[item];
+	item = z_info->k_max;
+	for (i = obj_tval_start[tval]; i < obj_tval_start[tval + 1]; i++) {
+		double prob = objects[obj_tval_kinds[i] + 1] -
+			objects[obj_tval_kinds[i]];
 
-			if (value < prob) break;
-			value -= prob;
+		if (value < prob) {
+			item = obj_tval_kinds[i];
+			break;
 		}
+		value -= prob;
 	}
 
 	/* Return the item index */
@@ -33,6 +33,10 @@
  * Each hook has a list of specs, which are essentially named formal parameters;
  * when we run a particular hook across a line, each spec in the hook is
  * assigned a value.
+ *
+ * Lines are split up where they lie, so the values of sym and str fields are
+ * pieces of the line itself; the value nodes are kept from line to line, and
+ * the hooks are found through a hash table on their directives.
  */
 
 enum {
@@ -65,10 +69,13 @@ struct parser_value {
 
 struct parser_hook {
 	struct parser_hook *next;
+	struct parser_hook *chain;
 	enum parser_error (*func)(struct parser *p);
 	char *dir;
+	uint32_t hash;
 	struct parser_spec *fhead;
 	struct parser_spec *ftail;
+	size_t nspecs;
 };
 
 struct parser {
@@ -77,8 +84,15 @@ struct parser {
 	unsigned int colno;
 	char errmsg[1024];
 	struct parser_hook *hooks;
+	struct parser_hook **table;
+	size_t table_size;
+	size_t hook_count;
+	struct parser_value *values;
+	size_t values_max;
 	struct parser_value *fhead;
 	struct parser_value *ftail;
+	char *line;
+	size_t line_size;
 	void *priv;
 };
 
@@ -90,26 +104,98 @@ struct parser *parser_new(void) {
 	return p;
 }
 
+static uint32_t hash_directive(const char *dir) {
+	uint32_t hash = 5381;
+
+	while (*dir) {
+		hash = hash * 33 + (unsigned char) *dir++;
+	}
+	return hash;
+}
+
 static struct parser_hook *findhook(struct parser *p, const char *dir) {
-	struct parser_hook *h = p->hooks;
+	uint32_t hash = hash_directive(dir);
+	struct parser_hook *h;
+
+	if (!p->table_size) return NULL;
+	h = p->table[hash & (p->table_size - 1)];
 	while (h) {
-		if (streq(h->dir, dir))
+		if (h->hash == hash && streq(h->dir, dir))
 			break;
-		h = h->next;
+		h = h->chain;
 	}
 	return h;
 }
 
+/**
+ * Adds a hook, not yet on the list, to the hash table, making the table bigger
+ * when it gets full.  A later hook is found ahead of an earlier one with the
+ * same directive.
+ */
+static void addhook(struct parser *p, struct parser_hook *h) {
+	struct parser_hook **bucket;
+
+	p->hook_count++;
+	if (p->hook_count > p->table_size) {
+		struct parser_hook *old;
+
+		mem_free(p->table);
+		p->table_size = p->table_size ? p->table_size * 2 : 16;
+		p->table = mem_zalloc(p->table_size * sizeof(*p->table));
+
+		/* The list runs newest first, so each goes on the end of its chain */
+		for (old = p->hooks; old; old = old->next) {
+			bucket = &p->table[old->hash & (p->table_size - 1)];
+			while (*bucket) {
+				bucket = &(*bucket)->chain;
+			}
+			old->chain = NULL;
+			*bucket = old;
+		}
+	}
+
+	bucket = &p->table[h->hash & (p->table_size - 1)];
+	h->chain = *bucket;
+	*bucket = h;
+}
+
 static void parser_freeold(struct parser *p) {
-	struct parser_value *v;
-	while (p->fhead) {
-		int t = p->fhead->spec.type & ~PARSE_T_OPT;
-		v = (struct parser_value *)p->fhead->spec.next;
-		if (t == PARSE_T_SYM || t == PARSE_T_STR)
-			mem_free(p->fhead->u.sval);
-		mem_free(p->fhead);
-		p->fhead = v;
+	p->fhead = NULL;
+	p->ftail = NULL;
+}
+
+/**
+ * Splits the next field delimited by ':' off the line, as strtok() would.
+ */
+static char *next_field(char **cursor) {
+	char *s = *cursor;
+	char *tok;
+
+	while (*s == ':')
+		s++;
+	if (!*s) {
+		*cursor = s;
+		return NULL;
 	}
+	tok = s;
+	while (*s && *s != ':')
+		s++;
+	if (*s)
+		*s++ = '\0';
+	*cursor = s;
+	return tok;
+}
+
+/**
+ * Takes whatever is left of the line.
+ */
+static char *rest_of_line(char **cursor) {
+	char *s = *cursor;
+
+	if (!*s)
+		return NULL;
+	*cursor = s + strlen(s);
+	return s;
 }
 
 void quit_fmt_p(struct parser *p, const char *fmt, ...) {
@@ -222,17 +308,18 @@ static bool parse_random(const char *str, random_value *bonus) {
 }
 
 /**
- * Parses the provided line.
+ * Parses the provided line, which is split up where it lies.
  *
  * This runs the first parser hook registered with `p` that matches `line`.
+ * The values found point into `line`, so it must be left as it is until
+ * the next line is parsed.
  */
-enum parser_error parser_parse(struct parser *p, const char *line) {
-	char *cline;
+enum parser_error parser_parse_line(struct parser *p, char *line) {
 	char *tok;
 	struct parser_hook *h;
 	struct parser_spec *s;
 	struct parser_value *v;
-	char *sp = NULL;
+	char *sp;
 
 	assert(p);
 	assert(line);
@@ -241,20 +328,16 @@ enum parser_error parser_parse(struct parser *p, const char *line) {
 
 	p->lineno++;
 	p->colno = 1;
-	p->fhead = NULL;
-	p->ftail = NULL;
 
 	/* Ignore empty lines and comments. */
-	while (*line && (isspace(*line)))
+	while (*line && (isspace((unsigned char) *line)))
 		line++;
 	if (!*line || *line == '#')
 		return PARSE_ERROR_NONE;
 
-	cline = string_make(line);
-
-	tok = strtok(cline, ":");
+	sp = line;
+	tok = next_field(&sp);
 	if (!tok) {
-		mem_free(cline);
 		p->error = PARSE_ERROR_MISSING_FIELD;
 		return PARSE_ERROR_MISSING_FIELD;
 	}
@@ -263,7 +346,6 @@ enum parser_error parser_parse(struct parser *p, const char *line) {
 	if (!h) {
 		my_strcpy(p->errmsg, tok, sizeof(p->errmsg));
 		p->error = PARSE_ERROR_UNDEFINED_DIRECTIVE;
-		mem_free(cline);
 		return PARSE_ERROR_UNDEFINED_DIRECTIVE;
 	}
 
@@ -271,6 +353,7 @@ enum parser_error parser_parse(struct parser *p, const char *line) {
 	 * types. The optional flag has a bit assigned to it in the spec's type
 	 * tag; we compute a temporary type for the spec with that flag removed
 	 * and use that instead. */
+	v = p->values;
 	for (s = h->fhead; s; s = s->next) {
 		int t = s->type & ~PARSE_T_OPT;
 		p->colno++;
@@ -279,28 +362,25 @@ enum parser_error parser_parse(struct parser *p, const char *line) {
 		 * at all (i.e., they consume the remainder of the line) */
 		if (t == PARSE_T_INT || t == PARSE_T_SYM || t == PARSE_T_RAND ||
 			t == PARSE_T_UINT) {
-			tok = strtok(sp, ":");
-			sp = NULL;
+			tok = next_field(&sp);
 		} else if (t == PARSE_T_CHAR) {
-			tok = strtok(sp, "");
+			/* A char takes the one after it as its delimiter */
+			tok = rest_of_line(&sp);
 			if (tok)
-				sp = tok + 2;
+				sp = tok[1] ? tok + 2 : tok + 1;
 		} else {
-			tok = strtok(sp, "");
-			sp = NULL;
+			tok = rest_of_line(&sp);
 		}
 		if (!tok) {
 			if (!(s->type & PARSE_T_OPT)) {
 				my_strcpy(p->errmsg, s->name, sizeof(p->errmsg));
 				p->error = PARSE_ERROR_MISSING_FIELD;
-				mem_free(cline);
 				return PARSE_ERROR_MISSING_FIELD;
 			}
 			break;
 		}
 
-		/* Allocate a value node. */
-		v = mem_alloc(sizeof *v);
+		/* Take the next value node. */
 		v->spec.next = NULL;
 		v->spec.type = s->type;
 		v->spec.name = s->name;
@@ -310,8 +390,6 @@ enum parser_error parser_parse(struct parser *p, const char *line) {
 			char *z = NULL;
 			v->u.ival = strtol(tok, &z, 0);
 			if (z == tok) {
-				mem_free(v);
-				mem_free(cline);
 				my_strcpy(p->errmsg, s->name, sizeof(p->errmsg));
 				p->error = PARSE_ERROR_NOT_NUMBER;
 				return PARSE_ERROR_NOT_NUMBER;
@@ -320,8 +398,6 @@ enum parser_error parser_parse(struct parser *p, const char *line) {
 			char *z = NULL;
 			v->u.uval = strtoul(tok, &z, 0);
 			if (z == tok || *tok == '-') {
-				mem_free(v);
-				mem_free(cline);
 				my_strcpy(p->errmsg, s->name, sizeof(p->errmsg));
 				p->error = PARSE_ERROR_NOT_NUMBER;
 				return PARSE_ERROR_NOT_NUMBER;
@@ -329,11 +405,9 @@ enum parser_error parser_parse(struct parser *p, const char *line) {
 		} else if (t == PARSE_T_CHAR) {
 			text_mbstowcs(&v->u.cval, tok, 1);
 		} else if (t == PARSE_T_SYM || t == PARSE_T_STR) {
-			v->u.sval = string_make(tok);
+			v->u.sval = tok;
 		} else if (t == PARSE_T_RAND) {
 			if (!parse_random(tok, &v->u.rval)) {
-				mem_free(v);
-				mem_free(cline);
 				my_strcpy(p->errmsg, s->name, sizeof(p->errmsg));
 				p->error = PARSE_ERROR_NOT_RANDOM;
 				return PARSE_ERROR_NOT_RANDOM;
@@ -346,14 +420,35 @@ enum parser_error parser_parse(struct parser *p, const char *line) {
 		else
 			p->ftail->spec.next = &v->spec;
 		p->ftail = v;
+		v++;
 	}
 
-	mem_free(cline);
-
 	p->error = h->func(p);
 	return p->error;
 }
 
+/**
+ * Parses the provided line.
+ *
+ * This runs the first parser hook registered with `p` that matches `line`.
+ */
+enum parser_error parser_parse(struct parser *p, const char *line) {
+	size_t len;
+
+	assert(p);
+	assert(line);
+
+	/* Work on the parser's own copy */
+	len = strlen(line) + 1;
+	if (len > p->line_size) {
+		p->line_size = MAX(len, 256);
+		p->line = mem_realloc(p->line, p->line_size);
+	}
+	memcpy(p->line, line, len);
+
+	return parser_parse_line(p, p->line);
+}
+
 /**
  * Gets parser's private data.
  */
@@ -414,6 +509,9 @@ void parser_destroy(struct parser *p) {
 		mem_free(p->hooks);
 		p->hooks = h;
 	}
+	mem_free(p->table);
+	mem_free(p->values);
+	mem_free(p->line);
 	mem_free(p);
 }
 
@@ -430,8 +528,10 @@ static errr parse_specs(struct parser_hook *h, char *fmt) {
 	if (!name)
 		return -EINVAL;
 	h->dir = string_make(name);
+	h->hash = hash_directive(h->dir);
 	h->fhead = NULL;
 	h->ftail = NULL;
+	h->nspecs = 0;
 	while (name) {
 		/* Lack of a type is legal; that means we're at the end of the line. */
 		stype = strtok(NULL, " ");
@@ -472,6 +572,7 @@ static errr parse_specs(struct parser_hook *h, char *fmt) {
 		else
 			h->fhead = s;
 		h->ftail = s;
+		h->nspecs++;
 	}
 
 	return 0;
@@ -511,8 +612,16 @@ errr parser_reg(struct parser *p, const char *fmt,
 		return r;
 	}
 
+	addhook(p, h);
 	p->hooks = h;
 	mem_free(cfmt);
+
+	/* Make sure there are value nodes enough for any line */
+	if (h->nspecs > p->values_max) {
+		p->values_max = h->nspecs;
+		p->values = mem_realloc(p->values,
+			p->values_max * sizeof(*p->values));
+	}
 	return 0;
 }
 
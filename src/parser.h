@@ -49,6 +49,7 @@ struct parser_state {
 
 extern struct parser *parser_new(void);
 extern enum parser_error parser_parse(struct parser *p, const char *line);
+extern enum parser_error parser_parse_line(struct parser *p, char *line);
 extern void parser_destroy(struct parser *p);
 extern void *parser_priv(struct parser *p);
 extern void parser_setpriv(struct parser *p, void *v);
@@ -21,6 +21,7 @@
 #include "cmds.h"
 #include "game-event.h"
 #include "game-world.h"
+#include "generate.h"
 #include "init.h"
 #include "mon-lore.h"
 #include "monster.h"
@@ -1540,7 +1541,7 @@ void do_cmd_accept_character(struct command *cmd)
 	player->obj_k->modifiers[OBJ_MOD_USE_ENERGY] = 1;
 
 	/* Initialise the stores, dungeon */
-	chunk_list_max = 0;
+	chunk_list_free();
 
 	/* Player learns innate icons */
 	player_learn_innate(player);
@@ -82,47 +82,16 @@ const char *proj_idx_to_name(int type)
  * Projection paths
  * ------------------------------------------------------------------------ */
 /**
- * Determine the path taken by a projection.
- *
- * The projection will always start from the grid1, and will travel
- * towards grid2, touching one grid per unit of distance along
- * the major axis, and stopping when it enters the finish grid or a
- * wall grid, or has travelled the maximum legal distance of "range".
- *
- * Note that "distance" in this function (as in the "update_view()" code)
- * is defined as "MAX(dy,dx) + MIN(dy,dx)/2", which means that the player
- * actually has an "octagon of projection" not a "circle of projection".
- *
- * The path grids are saved into the grid array pointed to by "gp", and
- * there should be room for at least "range" grids in "gp".  Note that
- * due to the way in which distance is calculated, this function normally
- * uses fewer than "range" grids for the projection path, so the result
- * of this function should never be compared directly to "range".  Note
- * that the initial grid grid1 is never saved into the grid array, not
- * even if the initial grid is also the final grid.  XXX XXX XXX
- *
- * The "flg" flags can be used to modify the behavior of this function.
- *
- * In particular, the "PROJECT_STOP" and "PROJECT_THRU" flags have the same
- * semantics as they do for the "project" function, namely, that the path
- * will stop as soon as it hits a monster, or that the path will continue
- * through the finish grid, respectively.
- *
- * The "PROJECT_JUMP" flag, which for the "project()" function means to
- * start at a special grid (which makes no sense in this function), means
- * that the path should be "angled" slightly if needed to avoid any wall
- * grids, allowing the player to "target" any grid which is in "view".
- * This flag is non-trivial and has not yet been implemented, but could
- * perhaps make use of the "vinfo" array (above).  XXX XXX XXX
- *
- * This function returns the number of grids (if any) in the path.  This
- * function will return zero if and only if grid1 and grid2 are equal.
- *
- * This algorithm is similar to, but slightly different from, the one used
- * by "update_view_los()", and very different from the one used by "los()".
+ * Help project_path():  find the grids, relative to the start, that a
+ * projection aimed at offset d passes through until it has travelled range,
+ * ignoring anything that would stop it.
+ * \param d Is the offset aimed at; must not be (0, 0).
+ * \param range Is the range of the projection.
+ * \param gp Receives the grids; must have room for range grids.
+ * \param dist If not NULL, receives the distance travelled at each grid.
+ * \return the number of grids.
  */
-int project_path(struct chunk *c, struct loc *gp, int range, struct loc grid1,
-	struct loc grid2, int flg)
+static int path_trace(struct loc d, int range, struct loc *gp, int *dist)
 {
 	int y, x;
 
@@ -144,28 +113,21 @@ int project_path(struct chunk *c, struct loc *gp, int range, struct loc grid1,
 	/* Slope */
 	int m;
 
-	/* Possible decoy */
-	struct loc decoy = cave_find_decoy(c);
-
-	/* No path necessary (or allowed) */
-	if (loc_eq(grid1, grid2)) return (0);
-
-
 	/* Analyze "dy" */
-	if (grid2.y < grid1.y) {
-		ay = (grid1.y - grid2.y);
+	if (d.y < 0) {
+		ay = -d.y;
 		sy = -1;
 	} else {
-		ay = (grid2.y - grid1.y);
+		ay = d.y;
 		sy = 1;
 	}
 
 	/* Analyze "dx" */
-	if (grid2.x < grid1.x) {
-		ax = (grid1.x - grid2.x);
+	if (d.x < 0) {
+		ax = -d.x;
 		sx = -1;
 	} else {
-		ax = (grid2.x - grid1.x);
+		ax = d.x;
 		sx = 1;
 	}
 
@@ -186,39 +148,18 @@ int project_path(struct chunk *c, struct loc *gp, int range, struct loc grid1,
 		m = frac << 1;
 
 		/* Start */
-		y = grid1.y + sy;
-		x = grid1.x;
+		y = sy;
+		x = 0;
 
 		/* Create the projection path */
 		while (1) {
 			/* Save grid */
+			if (dist) dist[n] = n + 1 + (k >> 1);
 			gp[n++] = loc(x, y);
 
 			/* Hack -- Check maximum range */
 			if ((n + (k >> 1)) >= range) break;
 
-			/* Sometimes stop at finish grid */
-			if (!(flg & (PROJECT_THRU)))
-				if (loc_eq(loc(x, y), grid2)) break;
-
-			/* Don't stop if making paths through rock for generation */
-			if (!(flg & (PROJECT_ROCK))) {
-				/* Stop at non-initial wall grids, except where that would
-				 * leak info during targetting */
-				if (!(flg & (PROJECT_INFO))) {
-					if ((n > 0) && !square_isprojectable(c, loc(x, y)))
-						break;
-				} else if ((n > 0) && square_isbelievedwall(c, loc(x, y))) {
-					break;
-				}
-			}
-
-			/* Sometimes stop at non-initial monsters/players, decoys */
-			if (flg & (PROJECT_STOP)) {
-				if ((n > 0) && (square(c, loc(x, y))->mon != 0)) break;
-				if (loc_eq(loc(x, y), decoy)) break;
-			}
-
 			/* Slant */
 			if (m) {
 				/* Advance (X) part 1 */
@@ -251,39 +192,18 @@ int project_path(struct chunk *c, struct loc *gp, int range, struct loc grid1,
 		m = frac << 1;
 
 		/* Start */
-		y = grid1.y;
-		x = grid1.x + sx;
+		y = 0;
+		x = sx;
 
 		/* Create the projection path */
 		while (1) {
 			/* Save grid */
+			if (dist) dist[n] = n + 1 + (k >> 1);
 			gp[n++] = loc(x, y);
 
 			/* Hack -- Check maximum range */
 			if ((n + (k >> 1)) >= range) break;
 
-			/* Sometimes stop at finish grid */
-			if (!(flg & (PROJECT_THRU)))
-				if (loc_eq(loc(x, y), grid2)) break;
-
-			/* Don't stop if making paths through rock for generation */
-			if (!(flg & (PROJECT_ROCK))) {
-				/* Stop at non-initial wall grids, except where that would
-				 * leak info during targetting */
-				if (!(flg & (PROJECT_INFO))) {
-					if ((n > 0) && !square_isprojectable(c, loc(x, y)))
-						break;
-				} else if ((n > 0) && square_isbelievedwall(c, loc(x, y))) {
-					break;
-				}
-			}
-
-			/* Sometimes stop at non-initial monsters/players, decoys */
-			if (flg & (PROJECT_STOP)) {
-				if ((n > 0) && (square(c, loc(x, y))->mon != 0)) break;
-				if (loc_eq(loc(x, y), decoy)) break;
-			}
-
 			/* Slant */
 			if (m) {
 				/* Advance (Y) part 1 */
@@ -310,39 +230,18 @@ int project_path(struct chunk *c, struct loc *gp, int range, struct loc grid1,
 	/* Diagonal */
 	else {
 		/* Start */
-		y = grid1.y + sy;
-		x = grid1.x + sx;
+		y = sy;
+		x = sx;
 
 		/* Create the projection path */
 		while (1) {
 			/* Save grid */
+			if (dist) dist[n] = n + 1 + ((n + 1) >> 1);
 			gp[n++] = loc(x, y);
 
 			/* Hack -- Check maximum range */
 			if ((n + (n >> 1)) >= range) break;
 
-			/* Sometimes stop at finish grid */
-			if (!(flg & (PROJECT_THRU)))
-				if (loc_eq(loc(x, y), grid2)) break;
-
-			/* Don't stop if making paths through rock for generation */
-			if (!(flg & (PROJECT_ROCK))) {
-				/* Stop at non-initial wall grids, except where that would
-				 * leak info during targetting */
-				if (!(flg & (PROJECT_INFO))) {
-					if ((n > 0) && !square_isprojectable(c, loc(x, y)))
-						break;
-				} else if ((n > 0) && square_isbelievedwall(c, loc(x, y))) {
-					break;
-				}
-			}
-
-			/* Sometimes stop at non-initial monsters/players, decoys */
-			if (flg & (PROJECT_STOP)) {
-				if ((n > 0) && (square(c, loc(x, y))->mon != 0)) break;
-				if (loc_eq(loc(x, y), decoy)) break;
-			}
-
 			/* Advance */
 			y += sy;
 			x += sx;
@@ -353,6 +252,191 @@ int project_path(struct chunk *c, struct loc *gp, int range, struct loc grid1,
 	return (n);
 }
 
+/**
+ * Precomputed projection paths.  For each offset of up to path_table_range
+ * grids in either direction, the grids of the path aimed at that offset
+ * (relative to the start) and the distance travelled at each, out to
+ * path_table_range.
+ */
+struct path_entry {
+	int start;	/* Index of the first grid in path_table_grids */
+	int len;	/* Number of grids */
+};
+
+static struct path_entry *path_table;
+static struct loc *path_table_grids;
+static int *path_table_dists;
+static int path_table_range;
+
+/**
+ * Get the index of the path for an offset, or -1 if it is out of range
+ */
+static int path_table_index(struct loc d)
+{
+	if (!path_table || ABS(d.x) > path_table_range ||
+		ABS(d.y) > path_table_range)
+		return -1;
+	return (d.y + path_table_range) * (2 * path_table_range + 1) + d.x +
+		path_table_range;
+}
+
+/**
+ * Build the path table, covering z_info->max_range
+ */
+static void init_path_table(void)
+{
+	int size, n = 0;
+	struct loc d;
+
+	path_table_range = z_info->max_range;
+	size = 2 * path_table_range + 1;
+	path_table = mem_zalloc(size * size * sizeof(*path_table));
+	path_table_grids = mem_zalloc(size * size * path_table_range *
+		sizeof(*path_table_grids));
+	path_table_dists = mem_zalloc(size * size * path_table_range *
+		sizeof(*path_table_dists));
+
+	for (d.y = -path_table_range; d.y <= path_table_range; d.y++) {
+		for (d.x = -path_table_range; d.x <= path_table_range; d.x++) {
+			struct path_entry *entry = &path_table[path_table_index(d)];
+
+			entry->start = n;
+			if (loc_is_zero(d)) continue;
+			entry->len = path_trace(d, path_table_range,
+				path_table_grids + n, path_table_dists + n);
+			n += entry->len;
+		}
+	}
+}
+
+static void cleanup_path_table(void)
+{
+	mem_free(path_table);
+	path_table = NULL;
+	mem_free(path_table_grids);
+	path_table_grids = NULL;
+	mem_free(path_table_dists);
+	path_table_dists = NULL;
+	path_table_range = 0;
+}
+
+struct init_module project_module = {
+	.name = "project",
+	.init = init_path_table,
+	.cleanup = cleanup_path_table
+};
+
+/**
+ * Help project_path():  check whether a projection stops at a grid it has
+ * entered (other than by running out of range).
+ */
+static bool path_stops(struct chunk *c, struct loc grid, struct loc grid2,
+		struct loc decoy, int flg)
+{
+	/* Sometimes stop at finish grid */
+	if (!(flg & (PROJECT_THRU)))
+		if (loc_eq(grid, grid2)) return true;
+
+	/* Don't stop if making paths through rock for generation */
+	if (!(flg & (PROJECT_ROCK))) {
+		/* Stop at non-initial wall grids, except where that would
+		 * leak info during targetting */
+		if (!(flg & (PROJECT_INFO))) {
+			if (!square_isprojectable(c, grid))
+				return true;
+		} else if (square_isbelievedwall(c, grid)) {
+			return true;
+		}
+	}
+
+	/* Sometimes stop at non-initial monsters/players, decoys */
+	if (flg & (PROJECT_STOP)) {
+		if (square(c, grid)->mon != 0) return true;
+		if (loc_eq(grid, decoy)) return true;
+	}
+
+	return false;
+}
+
+/**
+ * Determine the path taken by a projection.
+ *
+ * The projection will always start from the grid1, and will travel
+ * towards grid2, touching one grid per unit of distance along
+ * the major axis, and stopping when it enters the finish grid or a
+ * wall grid, or has travelled the maximum legal distance of "range".
+ *
+ * Note that "distance" in this function (as in the "update_view()" code)
+ * is defined as "MAX(dy,dx) + MIN(dy,dx)/2", which means that the player
+ * actually has an "octagon of projection" not a "circle of projection".
+ *
+ * The path grids are saved into the grid array pointed to by "gp", and
+ * there should be room for at least "range" grids in "gp".  Note that
+ * due to the way in which distance is calculated, this function normally
+ * uses fewer than "range" grids for the projection path, so the result
+ * of this function should never be compared directly to "range".  Note
+ * that the initial grid grid1 is never saved into the grid array, not
+ * even if the initial grid is also the final grid.  XXX XXX XXX
+ *
+ * The "flg" flags can be used to modify the behavior of this function.
+ *
+ * In particular, the "PROJECT_STOP" and "PROJECT_THRU" flags have the same
+ * semantics as they do for the "project" function, namely, that the path
+ * will stop as soon as it hits a monster, or that the path will continue
+ * through the finish grid, respectively.
+ *
+ * The "PROJECT_JUMP" flag, which for the "project()" function means to
+ * start at a special grid (which makes no sense in this function), means
+ * that the path should be "angled" slightly if needed to avoid any wall
+ * grids, allowing the player to "target" any grid which is in "view".
+ * This flag is non-trivial and has not yet been implemented, but could
+ * perhaps make use of the "vinfo" array (above).  XXX XXX XXX
+ *
+ * This function returns the number of grids (if any) in the path.  This
+ * function will return zero if and only if grid1 and grid2 are equal.
+ *
+ * This algorithm is similar to, but slightly different from, the one used
+ * by "update_view_los()", and very different from the one used by "los()".
+ *
+ * The shape of the path only depends on the offset from grid1 to grid2, so
+ * the paths for nearby offsets are worked out once at startup by
+ * path_trace(); only the stopping conditions are checked here.
+ */
+int project_path(struct chunk *c, struct loc *gp, int range, struct loc grid1,
+	struct loc grid2, int flg)
+{
+	struct loc d = loc_diff(grid2, grid1);
+	int idx = path_table_index(d);
+	int n, len;
+
+	/* Possible decoy */
+	struct loc decoy = cave_find_decoy(c);
+
+	/* No path necessary (or allowed) */
+	if (loc_eq(grid1, grid2)) return (0);
+
+	if (idx >= 0 && range <= path_table_range) {
+		/* Use the stored path, cut short at the range */
+		const struct loc *grid = path_table_grids + path_table[idx].start;
+		const int *dist = path_table_dists + path_table[idx].start;
+
+		for (n = 0; n < path_table[idx].len; n++) {
+			gp[n] = loc_sum(grid1, grid[n]);
+			if (dist[n] >= range) return n + 1;
+			if (path_stops(c, gp[n], grid2, decoy, flg)) return n + 1;
+		}
+		return n;
+	}
+
+	/* Work the path out */
+	len = path_trace(d, range, gp, NULL);
+	for (n = 0; n < len; n++) {
+		gp[n] = loc_sum(grid1, gp[n]);
+		if (path_stops(c, gp[n], grid2, decoy, flg)) return n + 1;
+	}
+	return len;
+}
+
 
 /**
  * Determine if a bolt spell cast from grid1 to grid2 will arrive
@@ -23,6 +23,7 @@
 #include "mon-group.h"
 #include "mon-lore.h"
 #include "mon-make.h"
+#include "mon-move.h"
 #include "monster.h"
 #include "object.h"
 #include "obj-desc.h"
@@ -481,6 +482,17 @@ void wr_world(void)
 	rdwr_world();
 }
 
+void wr_level_visits(void)
+{
+	int i, n = z_info->town_max * z_info->max_depth;
+
+	wr_u16b(z_info->town_max);
+	wr_u16b(z_info->max_depth);
+	for (i = 0; i < n; i++) {
+		wr_u16b(world_level_visits ? world_level_visits[i] : 0);
+	}
+}
+
 void rdwr_spell_state(struct spell_state *spell)
 {
 	rdwr_s32b(&spell->cooldown);
@@ -1058,8 +1070,11 @@ static void wr_objects_aux(struct chunk *c)
 
 /**
  * Write the monster list
+ *
+ * The custom race is written with the current level only; stored levels
+ * are written ahead of time, when it may since have changed.
  */
-static void wr_monsters_aux(struct chunk *c)
+static void wr_monsters_aux(struct chunk *c, bool custom)
 {
 	int i;
 
@@ -1070,7 +1085,7 @@ static void wr_monsters_aux(struct chunk *c)
 	wr_u16b(cave_monster_max(c));
 
 	/* Write custom monster(s) */
-	if (rdwr_race(&r_info[1]))
+	if (custom && rdwr_race(&r_info[1]))
 		return;
 
 	/* Dump the monsters */
@@ -1141,8 +1156,10 @@ void wr_objects(void)
 
 void wr_monsters(void)
 {
-	wr_monsters_aux(cave);
-	wr_monsters_aux(player->cave);
+	/* Monsters on this level are only given energy when they need it */
+	settle_monsters(cave);
+	wr_monsters_aux(cave, true);
+	wr_monsters_aux(player->cave, true);
 }
 
 void wr_traps(void)
@@ -1151,6 +1168,50 @@ void wr_traps(void)
 	wr_traps_aux(player->cave);
 }
 
+/*
+ * Write one stored chunk
+ */
+void wr_chunk(struct chunk *c)
+{
+	bool packed = c->packed != NULL;
+
+	/* Open the level out to write it */
+	cave_unpack(c);
+
+	/* Write the terrain and info */
+	wr_dungeon_aux(c);
+
+	/* Write the objects */
+	wr_objects_aux(c);
+
+	/* Write the monsters */
+	wr_monsters_aux(c, false);
+
+	/* Write the traps */
+	wr_traps_aux(c);
+
+	/* Write other chunk info */
+	if (OPT(player, birth_levels_persist)) {
+		int i;
+
+		wr_string(c->name);
+		wr_s32b(c->turn);
+		wr_u16b(c->depth);
+		wr_byte(c->feeling);
+		wr_u32b(c->obj_rating);
+		wr_u32b(c->mon_rating);
+		wr_byte(c->good_item ? 1 : 0);
+		wr_u16b(c->height);
+		wr_u16b(c->width);
+		wr_u16b(c->feeling_squares);
+		for (i = 0; i < z_info->f_max + 1; i++) {
+			wr_u16b(c->feat_count[i]);
+		}
+	}
+
+	if (packed) cave_pack(c);
+}
+
 /*
  * Write the chunk list
  */
@@ -1167,35 +1228,11 @@ void wr_chunks(void)
 	for (j = 0; j < chunk_list_max; j++) {
 		struct chunk *c = chunk_list[j];
 
-		/* Write the terrain and info */
-		wr_dungeon_aux(c);
-
-		/* Write the objects */
-		wr_objects_aux(c);
-
-		/* Write the monsters */
-		wr_monsters_aux(c);
-
-		/* Write the traps */
-		wr_traps_aux(c);
-
-		/* Write other chunk info */
-		if (OPT(player, birth_levels_persist)) {
-			int i;
-
-			wr_string(c->name);
-			wr_s32b(c->turn);
-			wr_u16b(c->depth);
-			wr_byte(c->feeling);
-			wr_u32b(c->obj_rating);
-			wr_u32b(c->mon_rating);
-			wr_byte(c->good_item ? 1 : 0);
-			wr_u16b(c->height);
-			wr_u16b(c->width);
-			wr_u16b(c->feeling_squares);
-			for (i = 0; i < z_info->f_max + 1; i++) {
-				wr_u16b(c->feat_count[i]);
-			}
+		/* A level out in its side file is already written */
+		if (c->spill) {
+			savefile_copy_chunk(c->spill);
+		} else {
+			wr_chunk(c);
 		}
 	}
 }
@@ -22,6 +22,11 @@
 #include "savefile.h"
 #include "save-charoutput.h"
 
+#ifdef UNIX
+# include <signal.h>
+# include <sys/wait.h>
+#endif
+
 /**
  * The savefile code.
  *
@@ -115,6 +120,7 @@ static const struct {
 	{ "monster memory", wr_monster_memory, 1 },
 	{ "object memory", wr_object_memory, 1 },
 	{ "world", wr_world, 1 },
+	{ "level visits", wr_level_visits, 1 },
 	{ "quests", wr_quests, 1 },
 	{ "player", wr_player, 1 },
 	{ "ignore", wr_ignore, 1 },
@@ -128,7 +134,7 @@ static const struct {
 	{ "objects", wr_objects, 1 },
 	{ "monsters", wr_monsters, 1 },
 	{ "traps", wr_traps, 1 },
-	{ "chunks", wr_chunks, 1 },
+	{ "chunks", wr_chunks, 2 },
 	{ "history", wr_history, 1 },
 };
 
@@ -144,6 +150,7 @@ static const struct blockinfo loaders[] = {
 	{ "object memory", rd_object_memory, 1 },
 	{ "quests", rd_quests, 1 },
 	{ "world", rd_world, 1 },
+	{ "level visits", rd_level_visits, 1 },
 	{ "player", rd_player, 1 },
 	{ "ignore", rd_ignore, 1 },
 	{ "misc", rd_misc, 1 },
@@ -156,7 +163,8 @@ static const struct blockinfo loaders[] = {
 	{ "objects", rd_objects, 1 },	
 	{ "monsters", rd_monsters, 1 },
 	{ "traps", rd_traps, 1 },
-	{ "chunks", rd_chunks, 1 },
+	{ "chunks", rd_chunks_1, 1 },
+	{ "chunks", rd_chunks, 2 },
 	{ "history", rd_history, 1 },
 };
 
@@ -166,11 +174,13 @@ static uint8_t *buffer;
 static uint32_t buffer_size;
 static uint32_t buffer_pos;
 static uint32_t buffer_check;
+static bool buffer_failed;	/* Something couldn't be put in the block */
 
 #define BUFFER_INITIAL_SIZE		1024
 #define BUFFER_BLOCK_INCREMENT	1024
 
 #define SAVEFILE_HEAD_SIZE		28
+#define SIDEFILE_HEAD_SIZE		12
 
 
 /**
@@ -435,12 +445,34 @@ void rdwr_string_null(char **str)
  * ------------------------------------------------------------------------ */
 
 
-static bool try_save(ang_file *file)
+/**
+ * A savefile as it is to be written, put together in memory
+ */
+struct save_image {
+	uint8_t *data;
+	size_t size;
+	size_t alloc;
+};
+
+static void image_put(struct save_image *image, const void *data, size_t len)
+{
+	if (image->size + len > image->alloc) {
+		image->alloc = MAX(image->alloc * 2, image->size + len);
+		image->data = mem_realloc(image->data, image->alloc);
+	}
+	memcpy(image->data + image->size, data, len);
+	image->size += len;
+}
+
+static bool try_save(struct save_image *image)
 {
 	uint8_t savefile_head[SAVEFILE_HEAD_SIZE];
 	size_t i, pos;
 	bool success = true;
 
+	image_put(image, savefile_magic, 4);
+	image_put(image, savefile_name, 4);
+
 	/* Start off the buffer */
 	buffer = mem_alloc(BUFFER_INITIAL_SIZE);
 	buffer_size = BUFFER_INITIAL_SIZE;
@@ -448,8 +480,12 @@ static bool try_save(ang_file *file)
 	for (i = 0; i < N_ELEMENTS(savers); i++) {
 		buffer_pos = 0;
 		buffer_check = 0;
+		buffer_failed = false;
 
 		savers[i].save();
+		if (buffer_failed) {
+			success = false;
+		}
 
 		/* 16-byte block name */
 		pos = my_strcpy((char *)savefile_head,
@@ -470,19 +506,12 @@ static bool try_save(ang_file *file)
 
 		assert(pos == SAVEFILE_HEAD_SIZE);
 
-		if (! file_write(file, (char *)savefile_head,
-				SAVEFILE_HEAD_SIZE)) {
-			success = false;
-		}
-		if (! file_write(file, (char *)buffer, buffer_pos)) {
-			success = false;
-		}
+		image_put(image, savefile_head, SAVEFILE_HEAD_SIZE);
+		image_put(image, buffer, buffer_pos);
 
 		/* pad to 4 byte multiples */
 		if (buffer_pos % 4) {
-			if (! file_write(file, "xxx", 4 - (buffer_pos % 4))) {
-				success = false;
-			}
+			image_put(image, "xxx", 4 - (buffer_pos % 4));
 		}
 	}
 
@@ -491,16 +520,33 @@ static bool try_save(ang_file *file)
 	return success;
 }
 
+/**
+ * Make up the name of a file, next to the savefile, that doesn't exist yet
+ */
+static void savefile_temp_name(char *buf, size_t len, const char *path,
+		const char *suffix)
+{
+	int count = 0;
+
+	strnfmt(buf, len, "%s%u.%s", path, Rand_simple(1000000), suffix);
+	while (file_exists(buf) && (count++ < 100))
+		strnfmt(buf, len, "%s%u%u.%s", path, Rand_simple(1000000),
+			count, suffix);
+}
+
 /**
  * Attempt to save the player in a savefile
  */
 bool savefile_save(const char *path)
 {
+	struct save_image image = { NULL, 0, 0 };
 	ang_file *file;
-	int count = 0;
 	char new_savefile[1024];
 	char old_savefile[1024];
 
+	/* Let any save still being written finish first */
+	(void) savefile_save_finished(true, NULL);
+
 	/* Now saving */
 	saving = true;
 
@@ -508,35 +554,21 @@ bool savefile_save(const char *path)
 	(void) save_charoutput();
 
 	/* New savefile */
-	strnfmt(old_savefile, sizeof(old_savefile), "%s%u.old", path,
-			Rand_simple(1000000));
-	while (file_exists(old_savefile) && (count++ < 100))
-		strnfmt(old_savefile, sizeof(old_savefile), "%s%u%u.old", path,
-				Rand_simple(1000000),count);
-
-	count = 0;
+	savefile_temp_name(old_savefile, sizeof(old_savefile), path, "old");
 
 	/* Open the savefile */
 	safe_setuid_grab();
-	strnfmt(new_savefile, sizeof(new_savefile), "%s%u.new", path,
-			Rand_simple(1000000));
-	while (file_exists(new_savefile) && (count++ < 100))
-		strnfmt(new_savefile, sizeof(new_savefile), "%s%u%u.new", path,
-				Rand_simple(1000000),count);
-
+	savefile_temp_name(new_savefile, sizeof(new_savefile), path, "new");
 	file = file_open(new_savefile, MODE_WRITE, FTYPE_SAVE);
 	safe_setuid_drop();
 
 	if (file) {
-		if (file_write(file, (char *) &savefile_magic, 4)
-			&& file_write(file, (char *) &savefile_name, 4)) {
-			character_saved = try_save(file);
-		} else {
-			character_saved = false;
-		}
+		character_saved = try_save(&image) &&
+			file_write(file, (char *) image.data, image.size);
 		player_hook(loadsave, true);
 		file_close(file);
 	}
+	mem_free(image.data);
 
 	if (character_saved) {
 		bool err = false;
@@ -572,6 +604,217 @@ bool savefile_save(const char *path)
 	return false;
 }
 
+/**
+ * The savefile being written in the background
+ */
+static struct {
+	bool pending;		/* Started, and not yet heard of */
+	bool written;		/* How it went, if it was done at once */
+#ifdef UNIX
+	pid_t pid;		/* Process writing it, or 0 if it was done at once */
+	char path[1024];	/* Where it is being written */
+#endif
+} save_behind;
+
+#ifdef UNIX
+/**
+ * Write out a savefile put together in memory and, once it is safely on disk,
+ * put it in place of the old one.  Returns true on success.
+ */
+static bool write_image(ang_file *file, const struct save_image *image,
+		const char *new_savefile, const char *path)
+{
+	bool success = file_write(file, (const char *) image->data,
+		image->size) && file_sync(file);
+
+	safe_setuid_grab();
+	if (success) {
+		success = file_move(new_savefile, path);
+	}
+	if (!success) {
+		file_delete(new_savefile);
+	}
+	safe_setuid_drop();
+	return success;
+}
+#endif
+
+#ifdef UNIX
+/**
+ * Put back the default handling of the signals the game catches, so that
+ * the copy writing the savefile doesn't act on them as if it were the game
+ * (saving, drawing on the terminal, or quitting as it does)
+ */
+static void save_behind_signals(void)
+{
+	static const int sigs[] = {
+#ifdef SIGHUP
+		SIGHUP,
+#endif
+#ifdef SIGTSTP
+		SIGTSTP,
+#endif
+#ifdef SIGINT
+		SIGINT,
+#endif
+#ifdef SIGQUIT
+		SIGQUIT,
+#endif
+#ifdef SIGFPE
+		SIGFPE,
+#endif
+#ifdef SIGILL
+		SIGILL,
+#endif
+#ifdef SIGTRAP
+		SIGTRAP,
+#endif
+#ifdef SIGIOT
+		SIGIOT,
+#endif
+#ifdef SIGBUS
+		SIGBUS,
+#endif
+#ifdef SIGSEGV
+		SIGSEGV,
+#endif
+#ifdef SIGTERM
+		SIGTERM,
+#endif
+#ifdef SIGPIPE
+		SIGPIPE,
+#endif
+#ifdef SIGEMT
+		SIGEMT,
+#endif
+#ifdef SIGDANGER
+		SIGDANGER,
+#endif
+#ifdef SIGSYS
+		SIGSYS,
+#endif
+#ifdef SIGXCPU
+		SIGXCPU,
+#endif
+#ifdef SIGPWR
+		SIGPWR,
+#endif
+	};
+	size_t i;
+
+	for (i = 0; i < N_ELEMENTS(sigs); i++) {
+		(void) signal(sigs[i], SIG_DFL);
+	}
+}
+#endif
+
+/**
+ * Attempt to save the player in a savefile, going on with the game while it
+ * is written.
+ *
+ * The game is put together in memory at once, and a copy of the game made
+ * by fork() writes it out, syncs it and renames it into place.  Where that
+ * can't be done it is all done before this returns.  Either way, how it went
+ * is told by savefile_save_finished().  Returns false if the save failed
+ * before it could be written.
+ */
+bool savefile_save_background(const char *path)
+{
+#ifdef UNIX
+	struct save_image image = { NULL, 0, 0 };
+	ang_file *file;
+	char new_savefile[1024];
+
+	/* Only one at a time */
+	(void) savefile_save_finished(true, NULL);
+
+	/* Now saving */
+	saving = true;
+	(void) save_charoutput();
+
+	safe_setuid_grab();
+	savefile_temp_name(new_savefile, sizeof(new_savefile), path, "new");
+	file = file_open(new_savefile, MODE_WRITE, FTYPE_SAVE);
+	safe_setuid_drop();
+	if (!file) return false;
+
+	if (!try_save(&image)) {
+		player_hook(loadsave, true);
+		file_close(file);
+		safe_setuid_grab();
+		file_delete(new_savefile);
+		safe_setuid_drop();
+		mem_free(image.data);
+		return false;
+	}
+	player_hook(loadsave, true);
+
+	save_behind.pid = fork();
+	if (save_behind.pid == 0) {
+		/* The copy writes the file, and leaves without tidying up */
+		save_behind_signals();
+		_exit(write_image(file, &image, new_savefile, path) ? 0 : 1);
+	} else if (save_behind.pid > 0) {
+		my_strcpy(save_behind.path, new_savefile, sizeof(save_behind.path));
+	} else {
+		/* No copy could be made, so write it now */
+		save_behind.pid = 0;
+		save_behind.written = write_image(file, &image, new_savefile,
+			path);
+	}
+	file_close(file);
+	mem_free(image.data);
+#else
+	save_behind.written = savefile_save(path);
+#endif
+
+	save_behind.pending = true;
+	return true;
+}
+
+/**
+ * See whether a save started by savefile_save_background() is done.
+ * \param wait whether to wait for it
+ * \param written if not NULL, set to whether the savefile was written
+ * \return whether there was such a save, now done and not heard of before
+ */
+bool savefile_save_finished(bool wait, bool *written)
+{
+	bool success;
+
+	if (!save_behind.pending) return false;
+
+#ifdef UNIX
+	if (save_behind.pid) {
+		int status;
+		pid_t done;
+
+		do {
+			done = waitpid(save_behind.pid, &status, wait ? 0 : WNOHANG);
+		} while (done < 0 && errno == EINTR);
+		if (done == 0) return false;
+
+		success = done == save_behind.pid && WIFEXITED(status) &&
+			WEXITSTATUS(status) == 0;
+		save_behind.pid = 0;
+
+		/* A copy that was stopped short leaves its file behind */
+		if (!success) {
+			safe_setuid_grab();
+			file_delete(save_behind.path);
+			safe_setuid_drop();
+		}
+	} else
+#endif
+	{
+		success = save_behind.written;
+	}
+
+	save_behind.pending = false;
+	if (written) *written = success;
+	return true;
+}
+
 
 
 /**
@@ -801,3 +1044,155 @@ void savefile_get_panic_name(char *buf, size_t len, const char *path)
 		buf[0] = '\0';
 	}
 }
+
+
+/**
+ * ------------------------------------------------------------------------
+ * Side files for stored levels
+ * ------------------------------------------------------------------------ */
+
+/**
+ * The block being saved or loaded, put aside while a stored level goes out
+ * to or comes back from its side file
+ */
+struct buffer_state {
+	uint8_t *buffer;
+	uint32_t size;
+	uint32_t pos;
+	uint32_t check;
+	bool saving;
+};
+
+static void buffer_put_aside(struct buffer_state *state)
+{
+	state->buffer = buffer;
+	state->size = buffer_size;
+	state->pos = buffer_pos;
+	state->check = buffer_check;
+	state->saving = saving;
+}
+
+static void buffer_take_back(const struct buffer_state *state)
+{
+	buffer = state->buffer;
+	buffer_size = state->size;
+	buffer_pos = state->pos;
+	buffer_check = state->check;
+	saving = state->saving;
+}
+
+/**
+ * Read what a side file holds into memory; the caller frees it.
+ *
+ * A side file is the savefile header followed by the size of what was
+ * written, and then exactly what wr_chunk() wrote.
+ */
+static uint8_t *read_side_file(const char *path, uint32_t *size)
+{
+	uint8_t savefile_head[SIDEFILE_HEAD_SIZE];
+	uint8_t *body = NULL;
+	ang_file *f = file_open(path, MODE_READ, FTYPE_RAW);
+
+	if (!f) return NULL;
+	if (file_read(f, (char *) savefile_head, SIDEFILE_HEAD_SIZE) ==
+			SIDEFILE_HEAD_SIZE &&
+			memcmp(&savefile_head[0], savefile_magic, 4) == 0 &&
+			memcmp(&savefile_head[4], savefile_name, 4) == 0) {
+		*size = RECONSTRUCT_U32B(8);
+		body = mem_alloc(*size + 1);
+		if (file_read(f, (char *) body, *size) != (int) *size) {
+			mem_free(body);
+			body = NULL;
+		}
+	}
+	file_close(f);
+	return body;
+}
+
+/**
+ * Write a stored level to a side file of its own, in the form it takes in
+ * the chunks block.  Returns true on success, false otherwise.
+ */
+bool savefile_save_chunk(const char *path, struct chunk *c)
+{
+	uint8_t savefile_head[SIDEFILE_HEAD_SIZE];
+	struct buffer_state outer;
+	size_t pos = 8;
+	ang_file *f;
+	bool success = false;
+
+	buffer_put_aside(&outer);
+	saving = true;
+	buffer = mem_alloc(BUFFER_INITIAL_SIZE);
+	buffer_size = BUFFER_INITIAL_SIZE;
+	buffer_pos = 0;
+	buffer_check = 0;
+
+	wr_chunk(c);
+
+	memcpy(&savefile_head[0], savefile_magic, 4);
+	memcpy(&savefile_head[4], savefile_name, 4);
+	SAVE_U32B(buffer_pos);
+	assert(pos == SIDEFILE_HEAD_SIZE);
+
+	f = file_open(path, MODE_WRITE, FTYPE_RAW);
+	if (f) {
+		success = file_write(f, (char *) savefile_head,
+			SIDEFILE_HEAD_SIZE) &&
+			file_write(f, (char *) buffer, buffer_pos);
+		if (!file_close(f)) success = false;
+		if (!success) file_delete(path);
+	}
+
+	mem_free(buffer);
+	buffer_take_back(&outer);
+	return success;
+}
+
+/**
+ * Read back a stored level written by savefile_save_chunk().  Returns the
+ * level, or NULL if the side file can't be read.
+ */
+struct chunk *savefile_load_chunk(const char *path)
+{
+	struct buffer_state outer;
+	struct chunk *c = NULL;
+	uint32_t size;
+	uint8_t *body = read_side_file(path, &size);
+
+	if (!body) return NULL;
+
+	buffer_put_aside(&outer);
+	saving = false;
+	buffer = body;
+	buffer_size = size;
+	buffer_pos = 0;
+	buffer_check = 0;
+
+	if (rd_side_chunk(&c) || buffer_pos != size) {
+		c = NULL;
+	}
+
+	mem_free(body);
+	buffer_take_back(&outer);
+	return c;
+}
+
+/**
+ * Copy a stored level from its side file into the chunks block being saved,
+ * just as wr_chunk() would have written it
+ */
+void savefile_copy_chunk(const char *path)
+{
+	uint32_t i, size;
+	uint8_t *body = read_side_file(path, &size);
+
+	if (!body) {
+		buffer_failed = true;
+		return;
+	}
+	for (i = 0; i < size; i++) {
+		sf_put(body[i]);
+	}
+	mem_free(body);
+}
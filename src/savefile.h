@@ -37,6 +37,20 @@ extern bool character_saved;
  */
 bool savefile_save(const char *path);
 
+/**
+ * Save to the given location, going on with the game while it is written;
+ * savefile_save_finished() says how it went.  Returns false if it failed at
+ * once.
+ */
+bool savefile_save_background(const char *path);
+
+/**
+ * Check whether a background save is done, waiting for it if wait is true.
+ * Returns true, and sets written if not NULL, only for a save that is done
+ * and hasn't been checked on before.
+ */
+bool savefile_save_finished(bool wait, bool *written);
+
 /**
  * Load the savefile given.  Returns true on succcess, false otherwise.
  */
@@ -54,6 +68,15 @@ extern bool saving;
  */
 void savefile_get_panic_name(char *buffer, size_t len, const char *path);
 
+/**
+ * Write a stored level to a side file of its own, read it back, or copy it
+ * into the chunks block of the savefile being written.
+ */
+struct chunk;
+bool savefile_save_chunk(const char *path, struct chunk *c);
+struct chunk *savefile_load_chunk(const char *path);
+void savefile_copy_chunk(const char *path);
+
 
 /**
  * ------------------------------------------------------------------------
@@ -175,6 +198,7 @@ int rd_player(void);
 void rdwr_player_levels(void);
 int rdwr_race(struct monster_race *r);
 int rd_world(void);
+int rd_level_visits(void);
 int rd_ignore(void);
 int rd_misc(void);
 int rd_player_hp(void);
@@ -182,6 +206,8 @@ int rd_player_spells(void);
 int rd_gear(void);
 int rd_stores(void);
 int rd_dungeon(void);
+int rd_side_chunk(struct chunk **c);
+int rd_chunks_1(void);
 int rd_chunks(void);
 int rd_objects(void);
 int rd_monsters(void);
@@ -203,6 +229,7 @@ void rdwr_quests(void);
 void wr_quests(void);
 void rdwr_world(void);
 void wr_world(void);
+void wr_level_visits(void);
 void wr_artifacts(void);
 void wr_player(void);
 void wr_ignore(void);
@@ -215,6 +242,7 @@ void wr_randarts(void);
 void wr_gear(void);
 void wr_stores(void);
 void wr_dungeon(void);
+void wr_chunk(struct chunk *c);
 void wr_chunks(void);
 void wr_objects(void);
 void wr_monsters(void);
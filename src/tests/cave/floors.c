@@ -0,0 +1,126 @@
+/* cave/floors */
+/* Check the index of floor grids against a scan of the level as the terrain
+ * changes, and that searches of it find every grid they should. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "cave.h"
+#include "init.h"
+
+static int check_index(struct chunk *c)
+{
+	struct loc grid;
+	int count = 0;
+
+	for (grid.y = 0; grid.y < c->height; grid.y++) {
+		for (grid.x = 0; grid.x < c->width; grid.x++) {
+			int pos = c->floor_pos[grid.y * c->width + grid.x];
+
+			if (square_isfloor(c, grid)) {
+				count++;
+				require(pos > 0 && pos <= c->floor_cnt);
+				eq(c->floor_grids[pos - 1], grid.y * c->width + grid.x);
+			} else {
+				eq(pos, 0);
+			}
+		}
+	}
+	eq(c->floor_cnt, count);
+	eq(c->floor_cnt, c->feat_count[FEAT_FLOOR]);
+	return 0;
+}
+
+/* Only the grids in the top left corner pass */
+static bool in_corner(struct chunk *c, struct loc grid)
+{
+	return grid.x < 4 && grid.y < 4;
+}
+
+static bool never(struct chunk *c, struct loc grid)
+{
+	return false;
+}
+
+int setup_tests(void **state) {
+	/* Need the terrain information. */
+	set_file_paths();
+	if (!init_angband()) {
+		*state = NULL;
+		return 1;
+	}
+	Rand_init();
+
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	cleanup_angband();
+	return 0;
+}
+
+static int test_index(void *state) {
+	struct chunk *c = make_test_cave(66, 198, 100);
+	struct loc grid;
+	int i, result = 0;
+
+	/* Nothing has searched the floor yet, so there is no index */
+	null(c->floor_pos);
+	for (i = 0; i < 500; i++) {
+		square_set_feat(c, random_interior_grid(c), FEAT_FLOOR);
+	}
+	eq(cave_floor_grids(c), c->feat_count[FEAT_FLOOR]);
+
+	/* Change the terrain, and search now and then to stir the index up */
+	for (i = 0; i < 5000 && !result; i++) {
+		square_set_feat(c, random_interior_grid(c),
+			one_in_(2) ? FEAT_FLOOR : FEAT_GRANITE);
+		if (i % 10 == 0) {
+			require(cave_find_floor(c, &grid, square_isfloor));
+			require(square_isfloor(c, grid));
+		}
+		if (i % 100 == 0) result = check_index(c);
+	}
+
+	cave_free(c);
+	require(!result);
+	ok;
+}
+
+static int test_find(void *state) {
+	struct chunk *c = make_test_cave(22, 66, 100);
+	int seen[4][4];
+	struct loc grid;
+	int i;
+
+	/* No floor, or none that passes */
+	require(!cave_find_floor(c, &grid, square_isfloor));
+	for (grid.y = 1; grid.y < c->height - 1; grid.y++) {
+		for (grid.x = 1; grid.x < c->width - 1; grid.x++) {
+			square_set_feat(c, grid, FEAT_FLOOR);
+		}
+	}
+	require(!cave_find_floor(c, &grid, never));
+
+	/* Every grid that passes turns up */
+	memset(seen, 0, sizeof(seen));
+	for (i = 0; i < 900; i++) {
+		require(cave_find_floor(c, &grid, in_corner));
+		require(in_corner(c, grid) && square_isfloor(c, grid));
+		seen[grid.y][grid.x]++;
+	}
+	for (grid.y = 1; grid.y < 4; grid.y++) {
+		for (grid.x = 1; grid.x < 4; grid.x++) {
+			require(seen[grid.y][grid.x] > 0);
+		}
+	}
+
+	cave_free(c);
+	ok;
+}
+
+const char *suite_name = "cave/floors";
+struct test tests[] = {
+	{ "index", test_index },
+	{ "find", test_find },
+	{ NULL, NULL }
+};
@@ -0,0 +1,131 @@
+/* cave/flow */
+/* Check shared flow fields against a plain search from each target, as the
+ * terrain changes and targets come and go. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "cave.h"
+#include "init.h"
+
+/* Steps to the target from each grid, plus one, searched afresh */
+static void ref_flow(struct chunk *c, struct loc target, int kind,
+		uint16_t *steps)
+{
+	struct loc *queue = mem_zalloc(c->height * c->width * sizeof(*queue));
+	int head = 0, tail = 0, d;
+
+	memset(steps, 0, c->height * c->width * sizeof(*steps));
+	steps[target.y * c->width + target.x] = 1;
+	queue[tail++] = target;
+
+	while (head < tail) {
+		struct loc next = queue[head++];
+		int dist = steps[next.y * c->width + next.x] + 1;
+
+		if (dist > FLOW_DEPTH + 1) break;
+		for (d = 0; d < 8; d++) {
+			struct loc grid = loc_sum(next, ddgrid_ddd[d]);
+			bool passes;
+
+			if (!square_in_bounds(c, grid)) continue;
+			if (steps[grid.y * c->width + grid.x]) continue;
+			if (kind == FLOW_WALLS) {
+				passes = !square_isperm(c, grid);
+			} else {
+				passes = square_ispassable(c, grid) ||
+					square_iscloseddoor(c, grid);
+				if (kind == FLOW_WALK && square_isdamaging(c, grid))
+					passes = false;
+			}
+			if (!passes) continue;
+
+			steps[grid.y * c->width + grid.x] = dist;
+			queue[tail++] = grid;
+		}
+	}
+	mem_free(queue);
+}
+
+/* A quarter granite, with some lava and doors among the floor */
+static struct chunk *create_random_cave(int height, int width)
+{
+	struct chunk *c = make_test_cave(height, width, 25);
+	struct loc grid;
+
+	for (grid.y = 1; grid.y < height - 1; grid.y++) {
+		for (grid.x = 1; grid.x < width - 1; grid.x++) {
+			if (!square_isfloor(c, grid)) continue;
+			if (one_in_(20)) {
+				square_set_feat(c, grid, FEAT_LAVA);
+			} else if (one_in_(30)) {
+				square_set_feat(c, grid, FEAT_CLOSED);
+			}
+		}
+	}
+	return c;
+}
+
+int setup_tests(void **state) {
+	/* Need the terrain information. */
+	set_file_paths();
+	if (!init_angband()) {
+		*state = NULL;
+		return 1;
+	}
+	Rand_init();
+
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	cleanup_angband();
+	return 0;
+}
+
+static int test_flow(void *state) {
+	struct chunk *c = create_random_cave(66, 198);
+	uint16_t *ref = mem_zalloc(c->height * c->width * sizeof(uint16_t));
+	struct loc targets[FLOW_FIELDS + 4];
+	int i, n, y, x;
+
+	for (i = 0; i < (int) N_ELEMENTS(targets); i++) {
+		targets[i] = random_interior_grid(c);
+	}
+
+	for (n = 0; n < 200; n++) {
+		struct loc target = targets[randint0(N_ELEMENTS(targets))];
+		int kind = randint0(FLOW_MAX);
+		const struct flow_field *flow;
+
+		/* Work it out, or find it kept from before */
+		(void) cave_flow_field(c, target, kind);
+
+		/* Sometimes change the terrain, or a target moves */
+		if (one_in_(5)) {
+			square_set_feat(c, random_interior_grid(c),
+				one_in_(2) ? FEAT_FLOOR : FEAT_GRANITE);
+		}
+		if (one_in_(5)) {
+			targets[randint0(N_ELEMENTS(targets))] =
+				random_interior_grid(c);
+		}
+
+		flow = cave_flow_field(c, target, kind);
+		ref_flow(c, target, kind, ref);
+		for (y = 0; y < c->height; y++) {
+			for (x = 0; x < c->width; x++) {
+				eq(flow->steps.grids[y][x], ref[y * c->width + x]);
+			}
+		}
+	}
+
+	mem_free(ref);
+	cave_free(c);
+	ok;
+}
+
+const char *suite_name = "cave/flow";
+struct test tests[] = {
+	{ "flow", test_flow },
+	{ NULL, NULL }
+};
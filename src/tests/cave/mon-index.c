@@ -0,0 +1,152 @@
+/* cave/mon-index */
+/* Check the monster buckets against a scan of every monster as monsters are
+ * placed, moved, swapped and removed. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "cave.h"
+#include "init.h"
+#include "monster.h"
+
+#define TEST_MONSTERS 120
+
+/* Stand-in for a race, so the test monsters count as alive */
+static struct monster_race test_race;
+
+/* Change the level the way the game does, through square_set_mon() */
+static void random_change(struct chunk *c)
+{
+	int midx = randint1(TEST_MONSTERS);
+	struct monster *mon = cave_monster(c, midx);
+	struct loc grid = random_interior_grid(c);
+	int there = square(c, grid)->mon;
+
+	if (!mon->race) {
+		/* Place */
+		if (there) return;
+		mon->race = &test_race;
+		mon->midx = midx;
+		mon->grid = grid;
+		square_set_mon(c, grid, midx);
+	} else if (one_in_(10)) {
+		/* Remove */
+		square_set_mon(c, mon->grid, 0);
+		memset(mon, 0, sizeof(*mon));
+	} else {
+		/* Move or swap, as monster_swap() does */
+		struct loc from = mon->grid;
+
+		if (randint0(3)) {
+			grid = loc_sum(from, ddgrid_ddd[randint0(8)]);
+			if (!square_in_bounds_fully(c, grid)) return;
+			there = square(c, grid)->mon;
+		}
+		square_set_mon(c, from, there);
+		square_set_mon(c, grid, midx);
+		mon->grid = grid;
+		if (there > 0) cave_monster(c, there)->grid = from;
+	}
+}
+
+static bool count_visit(struct chunk *c, struct monster *mon, void *data)
+{
+	int *seen = data;
+
+	seen[mon->midx]++;
+	return false;
+}
+
+static bool accept_visit(struct chunk *c, struct monster *mon, void *data)
+{
+	int *accepted = data;
+
+	return accepted[mon->midx] != 0;
+}
+
+static bool in_rect(struct loc grid, struct loc tl, struct loc br)
+{
+	return grid.x >= tl.x && grid.x <= br.x && grid.y >= tl.y &&
+		grid.y <= br.y;
+}
+
+static int compare_queries(struct chunk *c)
+{
+	int seen[TEST_MONSTERS + 1], accepted[TEST_MONSTERS + 1];
+	struct loc centre = random_interior_grid(c);
+	struct loc tl = loc_sum(centre, loc(-randint0(20), -randint0(12)));
+	struct loc br = loc_sum(centre, loc(randint0(20), randint0(12)));
+	int radius = randint0(25);
+	struct monster *nearest = NULL;
+	int best = 0, i;
+
+	/* Rectangle */
+	memset(seen, 0, sizeof(seen));
+	null(cave_monsters_in_rect(c, tl, br, count_visit, seen));
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		struct monster *mon = cave_monster(c, i);
+		bool want = mon->race && in_rect(mon->grid, tl, br);
+		eq(seen[i], (want ? 1 : 0));
+	}
+
+	/* Radius */
+	memset(seen, 0, sizeof(seen));
+	null(cave_monsters_in_radius(c, centre, radius, count_visit, seen));
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		struct monster *mon = cave_monster(c, i);
+		bool want = mon->race && distance(centre, mon->grid) <= radius;
+		eq(seen[i], (want ? 1 : 0));
+	}
+
+	/* Nearest, with only some monsters acceptable */
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		struct monster *mon = cave_monster(c, i);
+		struct loc d = loc_diff(mon->grid, centre);
+		int dist = d.x * d.x + d.y * d.y;
+
+		accepted[i] = one_in_(3) ? 0 : 1;
+		if (!mon->race || !accepted[i]) continue;
+		if (!nearest || dist < best) {
+			nearest = mon;
+			best = dist;
+		}
+	}
+	ptreq(cave_monster_nearest(c, centre, accept_visit, accepted), nearest);
+	return 0;
+}
+
+int setup_tests(void **state) {
+	/* Need the terrain information. */
+	set_file_paths();
+	if (!init_angband()) {
+		*state = NULL;
+		return 1;
+	}
+	Rand_init();
+
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	cleanup_angband();
+	return 0;
+}
+
+static int test_mon_index(void *state) {
+	struct chunk *c = make_test_cave(66, 198, 0);
+	int i, result = 0;
+
+	for (i = 0; i < 5000 && !result; i++) {
+		random_change(c);
+		if (i % 10 == 0) result = compare_queries(c);
+	}
+
+	cave_free(c);
+	require(!result);
+	ok;
+}
+
+const char *suite_name = "cave/mon-index";
+struct test tests[] = {
+	{ "mon_index", test_mon_index },
+	{ NULL, NULL }
+};
@@ -0,0 +1,171 @@
+/* cave/pack */
+/* Check that a level packed away for storing comes back grid for grid, with
+ * its monsters filed where they stand. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "cave.h"
+#include "init.h"
+#include "monster.h"
+#include "object.h"
+#include "trap.h"
+
+#define TEST_MONSTERS 120
+#define TEST_PILES 40
+
+/* Stand-ins for a race, objects and traps; only where they are matters */
+static struct monster_race test_race;
+static struct object test_objects[TEST_PILES];
+static struct trap test_traps[TEST_PILES];
+
+/* Terrain in runs of varying length, with some info flags and tags */
+static struct chunk *create_mixed_cave(int height, int width)
+{
+	struct chunk *c = cave_new(height, width);
+	int feats[4] = { FEAT_FLOOR, FEAT_GRANITE, FEAT_LAVA, FEAT_WATER };
+	int feat = FEAT_FLOOR;
+	struct loc grid;
+
+	for (grid.y = 0; grid.y < height; grid.y++) {
+		for (grid.x = 0; grid.x < width; grid.x++) {
+			if (one_in_(20)) feat = feats[randint0(4)];
+			square_set_feat(c, grid, square_in_bounds_fully(c, grid) ?
+				feat : FEAT_PERM);
+			if (one_in_(3)) {
+				sqinfo_on(square(c, grid)->info,
+					randint1(SQUARE_MAX - 1));
+			}
+			if (one_in_(50)) square_set_tag(c, grid, randint1(10));
+		}
+	}
+	return c;
+}
+
+static void fill_cave(struct chunk *c)
+{
+	int i;
+
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		struct monster *mon = cave_monster(c, i);
+		struct loc grid = random_interior_grid(c);
+
+		if (square(c, grid)->mon) continue;
+		mon->race = &test_race;
+		mon->midx = i;
+		mon->grid = grid;
+		square_set_mon(c, grid, i);
+		c->mon_cnt++;
+	}
+	c->mon_max = TEST_MONSTERS + 1;
+	square_set_mon(c, random_interior_grid(c), -1);
+
+	for (i = 0; i < TEST_PILES; i++) {
+		square(c, random_interior_grid(c))->obj = &test_objects[i];
+		square(c, random_interior_grid(c))->trap = &test_traps[i];
+	}
+}
+
+/* Take the stand-ins away again so cave_free() leaves them alone */
+static void empty_cave(struct chunk *c)
+{
+	struct loc grid;
+
+	for (grid.y = 0; grid.y < c->height; grid.y++) {
+		for (grid.x = 0; grid.x < c->width; grid.x++) {
+			square(c, grid)->obj = NULL;
+			square(c, grid)->trap = NULL;
+		}
+	}
+}
+
+static int compare_caves(struct chunk *c, const struct square *before,
+		int hazards)
+{
+	struct loc grid;
+	int i;
+
+	for (grid.y = 0; grid.y < c->height; grid.y++) {
+		for (grid.x = 0; grid.x < c->width; grid.x++) {
+			const struct square *old = &before[grid.y * c->width + grid.x];
+			const struct square *sq = square(c, grid);
+
+			eq(sq->feat, old->feat);
+			eq(sq->tag, old->tag);
+			require(sqinfo_is_equal(sq->info, old->info));
+			ptreq(sq->obj, old->obj);
+			ptreq(sq->trap, old->trap);
+			eq(sq->mon, old->mon);
+			eq(sq->light, 0);
+		}
+	}
+	for (i = 1; i < cave_monster_max(c); i++) {
+		struct monster *mon = cave_monster(c, i);
+
+		if (!mon->race) continue;
+		require(loc_eq(c->mon_filed[i], mon->grid));
+		ptreq(square_monster(c, mon->grid), mon);
+	}
+	eq(c->mon_hazard_cnt, hazards);
+	return 0;
+}
+
+int setup_tests(void **state) {
+	/* Need the terrain information. */
+	set_file_paths();
+	if (!init_angband()) {
+		*state = NULL;
+		return 1;
+	}
+	Rand_init();
+
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	cleanup_angband();
+	return 0;
+}
+
+static int test_round_trip(void *state) {
+	struct chunk *c = create_mixed_cave(66, 198);
+	struct square *before;
+	int i, hazards, result = 0;
+
+	fill_cave(c);
+	hazards = c->mon_hazard_cnt;
+	before = mem_alloc(c->height * c->width * sizeof(*before));
+	memcpy(before, c->squares[0], c->height * c->width * sizeof(*before));
+
+	/* Twice over, to be sure a level can be stored more than once */
+	for (i = 0; i < 2 && !result; i++) {
+		cave_pack(c);
+		notnull(c->packed);
+		null(c->squares);
+		null(c->mon_bucket);
+		cave_unpack(c);
+		null(c->packed);
+		result = compare_caves(c, before, hazards);
+	}
+
+	mem_free(before);
+	empty_cave(c);
+	cave_free(c);
+	require(!result);
+	ok;
+}
+
+static int test_free_packed(void *state) {
+	struct chunk *c = create_mixed_cave(22, 66);
+
+	/* A level can be freed without being opened out first */
+	cave_pack(c);
+	cave_free(c);
+	ok;
+}
+
+const char *suite_name = "cave/pack";
+struct test tests[] = {
+	{ "round_trip", test_round_trip },
+	{ "free_packed", test_free_packed },
+	{ NULL, NULL }
+};
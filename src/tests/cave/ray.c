@@ -0,0 +1,515 @@
+/* cave/ray */
+/* Check the precomputed los_flag() and project_path() rays against the
+ * step-by-step algorithms they replaced, on random maps. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "cave.h"
+#include "init.h"
+#include "project.h"
+
+/* The line of sight algorithm as it was before the ray table */
+static bool ref_los_flag(struct chunk *c, struct loc grid1, struct loc grid2,
+		unsigned flag)
+{
+	/* Delta */
+	int dx, dy;
+
+	/* Absolute */
+	int ax, ay;
+
+	/* Signs */
+	int sx, sy;
+
+	/* Fractions */
+	int qx, qy;
+
+	/* Scanners */
+	int tx, ty;
+
+	/* Scale factors */
+	int f1, f2;
+
+	/* Slope, or 1/Slope, of LOS */
+	int m;
+
+	/* Extract the offset */
+	dy = grid2.y - grid1.y;
+	dx = grid2.x - grid1.x;
+
+	/* Extract the absolute offset */
+	ay = ABS(dy);
+	ax = ABS(dx);
+
+	/* Handle adjacent (or identical) grids */
+	if ((ax < 2) && (ay < 2)) return (true);
+
+	/* Directly South/North */
+	if (!dx) {
+		/* South -- check for walls */
+		if (dy > 0) {
+			for (ty = grid1.y + 1; ty < grid2.y; ty++)
+				if (!square_hasflag(c, loc(grid1.x, ty), flag)) return (false);
+		} else { /* North -- check for walls */
+			for (ty = grid1.y - 1; ty > grid2.y; ty--)
+				if (!square_hasflag(c, loc(grid1.x, ty), flag)) return (false);
+		}
+
+		/* Assume los */
+		return (true);
+	}
+
+	/* Directly East/West */
+	if (!dy) {
+		/* East -- check for walls */
+		if (dx > 0) {
+			for (tx = grid1.x + 1; tx < grid2.x; tx++)
+				if (!square_hasflag(c, loc(tx, grid1.y), flag)) return (false);
+		} else { /* West -- check for walls */
+			for (tx = grid1.x - 1; tx > grid2.x; tx--)
+				if (!square_hasflag(c, loc(tx, grid1.y), flag)) return (false);
+		}
+
+		/* Assume los */
+		return (true);
+	}
+
+
+	/* Extract some signs */
+	sx = (dx < 0) ? -1 : 1;
+	sy = (dy < 0) ? -1 : 1;
+
+	/* Vertical and horizontal "knights" */
+	if ((ax == 1) && (ay == 2) &&
+		square_hasflag(c, loc(grid1.x, grid1.y + sy), flag)) {
+		return (true);
+	} else if ((ay == 1) && (ax == 2) &&
+			   square_hasflag(c, loc(grid1.x + sx, grid1.y), flag)) {
+		return (true);
+	}
+
+	/* Calculate scale factor div 2 */
+	f2 = (ax * ay);
+
+	/* Calculate scale factor */
+	f1 = f2 << 1;
+
+
+	/* Travel horizontally */
+	if (ax >= ay) {
+		/* Let m = dy / dx * 2 * (dy * dx) = 2 * dy * dy */
+		qy = ay * ay;
+		m = qy << 1;
+
+		tx = grid1.x + sx;
+
+		/* Consider the special case where slope == 1. */
+		if (qy == f2) {
+			ty = grid1.y + sy;
+			qy -= f1;
+		} else {
+			ty = grid1.y;
+		}
+
+		/* Note (below) the case (qy == f2), where */
+		/* the LOS exactly meets the corner of a tile. */
+		while (grid2.x - tx) {
+			if (!square_hasflag(c, loc(tx, ty), flag))
+				return (false);
+
+			qy += m;
+
+			if (qy < f2) {
+				tx += sx;
+			} else if (qy > f2) {
+				ty += sy;
+				if (!square_hasflag(c, loc(tx, ty), flag))
+					return (false);
+				qy -= f1;
+				tx += sx;
+			} else {
+				ty += sy;
+				qy -= f1;
+				tx += sx;
+			}
+		}
+	} else { /* Travel vertically */
+		/* Let m = dx / dy * 2 * (dx * dy) = 2 * dx * dx */
+		qx = ax * ax;
+		m = qx << 1;
+
+		ty = grid1.y + sy;
+
+		if (qx == f2) {
+			tx = grid1.x + sx;
+			qx -= f1;
+		} else {
+			tx = grid1.x;
+		}
+
+		/* Note (below) the case (qx == f2), where */
+		/* the LOS exactly meets the corner of a tile. */
+		while (grid2.y - ty) {
+			if (!square_hasflag(c, loc(tx, ty), flag))
+				return (false);
+
+			qx += m;
+
+			if (qx < f2) {
+				ty += sy;
+			} else if (qx > f2) {
+				tx += sx;
+				if (!square_hasflag(c, loc(tx, ty), flag))
+					return (false);
+				qx -= f1;
+				ty += sy;
+			} else {
+				tx += sx;
+				qx -= f1;
+				ty += sy;
+			}
+		}
+	}
+
+	/* Assume los */
+	return (true);
+}
+
+/* The projection path algorithm as it was before the path table */
+static int ref_project_path(struct chunk *c, struct loc *gp, int range,
+		struct loc grid1, struct loc grid2, int flg)
+{
+	int y, x;
+
+	int n = 0;
+	int k = 0;
+
+	/* Absolute */
+	int ay, ax;
+
+	/* Offsets */
+	int sy, sx;
+
+	/* Fractions */
+	int frac;
+
+	/* Scale factors */
+	int full, half;
+
+	/* Slope */
+	int m;
+
+	/* Possible decoy */
+	struct loc decoy = cave_find_decoy(c);
+
+	/* No path necessary (or allowed) */
+	if (loc_eq(grid1, grid2)) return (0);
+
+
+	/* Analyze "dy" */
+	if (grid2.y < grid1.y) {
+		ay = (grid1.y - grid2.y);
+		sy = -1;
+	} else {
+		ay = (grid2.y - grid1.y);
+		sy = 1;
+	}
+
+	/* Analyze "dx" */
+	if (grid2.x < grid1.x) {
+		ax = (grid1.x - grid2.x);
+		sx = -1;
+	} else {
+		ax = (grid2.x - grid1.x);
+		sx = 1;
+	}
+
+
+	/* Number of "units" in one "half" grid */
+	half = (ay * ax);
+
+	/* Number of "units" in one "full" grid */
+	full = half << 1;
+
+
+	/* Vertical */
+	if (ay > ax) {
+		/* Start at tile edge */
+		frac = ax * ax;
+
+		/* Let m = ((dx/dy) * full) = (dx * dx * 2) = (frac * 2) */
+		m = frac << 1;
+
+		/* Start */
+		y = grid1.y + sy;
+		x = grid1.x;
+
+		/* Create the projection path */
+		while (1) {
+			/* Save grid */
+			gp[n++] = loc(x, y);
+
+			/* Hack -- Check maximum range */
+			if ((n + (k >> 1)) >= range) break;
+
+			/* Sometimes stop at finish grid */
+			if (!(flg & (PROJECT_THRU)))
+				if (loc_eq(loc(x, y), grid2)) break;
+
+			/* Don't stop if making paths through rock for generation */
+			if (!(flg & (PROJECT_ROCK))) {
+				/* Stop at non-initial wall grids, except where that would
+				 * leak info during targetting */
+				if (!(flg & (PROJECT_INFO))) {
+					if ((n > 0) && !square_isprojectable(c, loc(x, y)))
+						break;
+				} else if ((n > 0) && square_isbelievedwall(c, loc(x, y))) {
+					break;
+				}
+			}
+
+			/* Sometimes stop at non-initial monsters/players, decoys */
+			if (flg & (PROJECT_STOP)) {
+				if ((n > 0) && (square(c, loc(x, y))->mon != 0)) break;
+				if (loc_eq(loc(x, y), decoy)) break;
+			}
+
+			/* Slant */
+			if (m) {
+				/* Advance (X) part 1 */
+				frac += m;
+
+				/* Horizontal change */
+				if (frac >= half) {
+					/* Advance (X) part 2 */
+					x += sx;
+
+					/* Advance (X) part 3 */
+					frac -= full;
+
+					/* Track distance */
+					k++;
+				}
+			}
+
+			/* Advance (Y) */
+			y += sy;
+		}
+	}
+
+	/* Horizontal */
+	else if (ax > ay) {
+		/* Start at tile edge */
+		frac = ay * ay;
+
+		/* Let m = ((dy/dx) * full) = (dy * dy * 2) = (frac * 2) */
+		m = frac << 1;
+
+		/* Start */
+		y = grid1.y;
+		x = grid1.x + sx;
+
+		/* Create the projection path */
+		while (1) {
+			/* Save grid */
+			gp[n++] = loc(x, y);
+
+			/* Hack -- Check maximum range */
+			if ((n + (k >> 1)) >= range) break;
+
+			/* Sometimes stop at finish grid */
+			if (!(flg & (PROJECT_THRU)))
+				if (loc_eq(loc(x, y), grid2)) break;
+
+			/* Don't stop if making paths through rock for generation */
+			if (!(flg & (PROJECT_ROCK))) {
+				/* Stop at non-initial wall grids, except where that would
+				 * leak info during targetting */
+				if (!(flg & (PROJECT_INFO))) {
+					if ((n > 0) && !square_isprojectable(c, loc(x, y)))
+						break;
+				} else if ((n > 0) && square_isbelievedwall(c, loc(x, y))) {
+					break;
+				}
+			}
+
+			/* Sometimes stop at non-initial monsters/players, decoys */
+			if (flg & (PROJECT_STOP)) {
+				if ((n > 0) && (square(c, loc(x, y))->mon != 0)) break;
+				if (loc_eq(loc(x, y), decoy)) break;
+			}
+
+			/* Slant */
+			if (m) {
+				/* Advance (Y) part 1 */
+				frac += m;
+
+				/* Vertical change */
+				if (frac >= half) {
+					/* Advance (Y) part 2 */
+					y += sy;
+
+					/* Advance (Y) part 3 */
+					frac -= full;
+
+					/* Track distance */
+					k++;
+				}
+			}
+
+			/* Advance (X) */
+			x += sx;
+		}
+	}
+
+	/* Diagonal */
+	else {
+		/* Start */
+		y = grid1.y + sy;
+		x = grid1.x + sx;
+
+		/* Create the projection path */
+		while (1) {
+			/* Save grid */
+			gp[n++] = loc(x, y);
+
+			/* Hack -- Check maximum range */
+			if ((n + (n >> 1)) >= range) break;
+
+			/* Sometimes stop at finish grid */
+			if (!(flg & (PROJECT_THRU)))
+				if (loc_eq(loc(x, y), grid2)) break;
+
+			/* Don't stop if making paths through rock for generation */
+			if (!(flg & (PROJECT_ROCK))) {
+				/* Stop at non-initial wall grids, except where that would
+				 * leak info during targetting */
+				if (!(flg & (PROJECT_INFO))) {
+					if ((n > 0) && !square_isprojectable(c, loc(x, y)))
+						break;
+				} else if ((n > 0) && square_isbelievedwall(c, loc(x, y))) {
+					break;
+				}
+			}
+
+			/* Sometimes stop at non-initial monsters/players, decoys */
+			if (flg & (PROJECT_STOP)) {
+				if ((n > 0) && (square(c, loc(x, y))->mon != 0)) break;
+				if (loc_eq(loc(x, y), decoy)) break;
+			}
+
+			/* Advance */
+			y += sy;
+			x += sx;
+		}
+	}
+
+	/* Length */
+	return (n);
+}
+
+/* Granite turned into a mix of walls, doors and rubble */
+static struct chunk *create_random_cave(int height, int width, int walls)
+{
+	struct chunk *c = make_test_cave(height, width, walls);
+	int feats[] = { FEAT_GRANITE, FEAT_RUBBLE, FEAT_PASS_RUBBLE,
+		FEAT_CLOSED, FEAT_OPEN };
+	struct loc grid;
+
+	for (grid.y = 1; grid.y < height - 1; grid.y++) {
+		for (grid.x = 1; grid.x < width - 1; grid.x++) {
+			if (square_isgranite(c, grid)) {
+				square_set_feat(c, grid,
+					feats[randint0(N_ELEMENTS(feats))]);
+			}
+			/* A few occupied grids for PROJECT_STOP */
+			if (one_in_(20)) square_set_mon(c, grid, 1);
+		}
+	}
+	return c;
+}
+
+/* A second grid, usually near the first so most pairs use the table */
+static struct loc random_nearby_grid(struct chunk *c, struct loc grid)
+{
+	int r = one_in_(4) ? MAX(c->width, c->height) : z_info->max_range + 2;
+	struct loc near = loc(grid.x + rand_range(-r, r),
+		grid.y + rand_range(-r, r));
+
+	if (!square_in_bounds(c, near)) return random_interior_grid(c);
+	return near;
+}
+
+int setup_tests(void **state) {
+	/* Need the terrain information and the ray tables. */
+	set_file_paths();
+	if (!init_angband()) {
+		*state = NULL;
+		return 1;
+	}
+	Rand_init();
+
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	cleanup_angband();
+	return 0;
+}
+
+static int test_los(void *state) {
+	int walls, i;
+
+	for (walls = 10; walls <= 70; walls += 30) {
+		struct chunk *c = create_random_cave(66, 198, walls);
+
+		for (i = 0; i < 20000; i++) {
+			struct loc grid1 = random_interior_grid(c);
+			struct loc grid2 = random_nearby_grid(c, grid1);
+
+			eq(los_flag(c, grid1, grid2, TF_LOS),
+				ref_los_flag(c, grid1, grid2, TF_LOS));
+			eq(los_flag(c, grid1, grid2, TF_PROJECT),
+				ref_los_flag(c, grid1, grid2, TF_PROJECT));
+			eq(los(c, grid1, grid2),
+				ref_los_flag(c, grid1, grid2, TF_PROJECT));
+		}
+		cave_free(c);
+	}
+	ok;
+}
+
+static int test_project_path(void *state) {
+	int flags[] = { 0, PROJECT_STOP, PROJECT_THRU, PROJECT_ROCK,
+		PROJECT_STOP | PROJECT_THRU, PROJECT_THRU | PROJECT_ROCK };
+	struct loc path[256], ref_path[256];
+	int walls, i, j;
+
+	for (walls = 10; walls <= 70; walls += 30) {
+		struct chunk *c = create_random_cave(66, 198, walls);
+
+		for (i = 0; i < 20000; i++) {
+			struct loc grid1 = random_interior_grid(c);
+			struct loc grid2 = random_nearby_grid(c, grid1);
+			int flg = flags[randint0(N_ELEMENTS(flags))];
+			int range = one_in_(4) ? randint1(60) : z_info->max_range;
+			int n = project_path(c, path, range, grid1, grid2, flg);
+			int ref_n = ref_project_path(c, ref_path, range, grid1,
+				grid2, flg);
+
+			eq(n, ref_n);
+			for (j = 0; j < n; j++) {
+				require(loc_eq(path[j], ref_path[j]));
+			}
+		}
+		cave_free(c);
+	}
+	ok;
+}
+
+const char *suite_name = "cave/ray";
+struct test tests[] = {
+	{ "los", test_los },
+	{ "project_path", test_project_path },
+	{ NULL, NULL }
+};
@@ -0,0 +1,225 @@
+/* cave/scent */
+/* Check the scent clock against scent that is aged grid by grid, and that
+ * monsters tracking by scent make the same choices with either. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "cave.h"
+#include "game-world.h"
+#include "init.h"
+#include "player-timed.h"
+
+/* Scent aged and laid down as it was before the scent clock */
+static void ref_update_scent(struct chunk *c, uint16_t **ref,
+		struct player *p)
+{
+	int y, x;
+	static const uint8_t scent_strength[5][5] = {
+		{2, 2, 2, 2, 2},
+		{2, 1, 1, 1, 2},
+		{2, 1, 0, 1, 2},
+		{2, 1, 1, 1, 2},
+		{2, 2, 2, 2, 2},
+	};
+
+	/* Update scent for all grids */
+	for (y = 1; y < c->height - 1; y++) {
+		for (x = 1; x < c->width - 1; x++) {
+			if (ref[y][x] > 0) {
+				ref[y][x]++;
+			}
+		}
+	}
+
+	/* Scentless player */
+	if (p->timed[TMD_COVERTRACKS]) return;
+
+	/* Lay down new scent around the player */
+	for (y = 0; y < 5; y++) {
+		for (x = 0; x < 5; x++) {
+			struct loc scent;
+			int new_scent = scent_strength[y][x];
+			int d;
+			bool add_scent = false;
+
+			/* Initialize */
+			scent.y = y + p->grid.y - 2;
+			scent.x = x + p->grid.x - 2;
+
+			/* Ignore invalid or non-scent-carrying grids */
+			if (!square_in_bounds(c, scent)) continue;
+			if (square_isnoscent(c, scent)) continue;
+
+			/* Check scent is spreading on floors, not going through walls */
+			for (d = 0; d < 8; d++)	{
+				struct loc adj = loc_sum(scent, ddgrid_ddd[d]);
+
+				if (!square_in_bounds(c, adj)) {
+					continue;
+				}
+
+				/* Player grid is always valid */
+				if (x == 2 && y == 2) {
+					add_scent = true;
+				}
+
+				/* Adjacent to a closer grid, so valid */
+				if (ref[adj.y][adj.x] == new_scent - 1) {
+					add_scent = true;
+				}
+			}
+
+			/* Not valid */
+			if (!add_scent) {
+				continue;
+			}
+
+			/* Mark the scent */
+			ref[scent.y][scent.x] = new_scent;
+		}
+	}
+}
+
+/* The grid a monster tracking by scent would pick in get_move_advance(),
+ * given the scent on each of the grids around it; -1 if it can't smell any */
+static int track_scent(const int *scents, int smell)
+{
+	int best_scent = 0, best = -1, i;
+
+	for (i = 0; i < 8; i++) {
+		int smelled_scent = smell - scents[i];
+		if ((smelled_scent > best_scent) && (scents[i] != 0)) {
+			best_scent = smelled_scent;
+			best = i;
+		}
+	}
+	return best;
+}
+
+static uint16_t **ref_new(struct chunk *c)
+{
+	uint16_t **ref = mem_zalloc(c->height * sizeof(uint16_t*));
+	int y;
+
+	for (y = 0; y < c->height; y++) {
+		ref[y] = mem_zalloc(c->width * sizeof(uint16_t));
+	}
+	return ref;
+}
+
+static void ref_free(struct chunk *c, uint16_t **ref)
+{
+	int y;
+
+	for (y = 0; y < c->height; y++) {
+		mem_free(ref[y]);
+	}
+	mem_free(ref);
+}
+
+/* Move the player at random, sometimes covering their tracks, and compare
+ * the scent and the scent tracking of monsters around them every turn */
+static int walk_and_compare(struct chunk *c, struct player *p, uint16_t **ref,
+		int turns)
+{
+	int i, y, x;
+
+	for (i = 0; i < turns; i++) {
+		struct loc next = loc_sum(p->grid, ddgrid_ddd[randint0(8)]);
+
+		if (square_ispassable(c, next)) p->grid = next;
+		if (one_in_(50)) {
+			p->timed[TMD_COVERTRACKS] = p->timed[TMD_COVERTRACKS] ? 0 : 1;
+		}
+		update_scent(c, p);
+		ref_update_scent(c, ref, p);
+
+		for (y = 1; y < c->height - 1; y++) {
+			for (x = 1; x < c->width - 1; x++) {
+				struct loc grid = loc(x, y);
+				int scents[8], ref_scents[8], smell, d;
+
+				eq(square_scent(c, grid), ref[y][x]);
+				if (!ref[y][x]) continue;
+
+				for (d = 0; d < 8; d++) {
+					struct loc adj = loc_sum(grid, ddgrid_ddd[d]);
+					scents[d] = square_scent(c, adj);
+					ref_scents[d] = ref[adj.y][adj.x];
+				}
+				for (smell = 10; smell <= 50; smell += 20) {
+					eq(track_scent(scents, smell),
+						track_scent(ref_scents, smell));
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+int setup_tests(void **state) {
+	/* Need the terrain information. */
+	set_file_paths();
+	if (!init_angband()) {
+		*state = NULL;
+		return 1;
+	}
+	Rand_init();
+
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	cleanup_angband();
+	return 0;
+}
+
+static int test_scent(void *state) {
+	struct chunk *c = make_test_cave(22, 66, 25);
+	uint16_t **ref = ref_new(c);
+	struct player p;
+	int result;
+
+	memset(&p, 0, sizeof(p));
+	p.timed = mem_zalloc(TMD_MAX * sizeof(int16_t));
+	p.grid = loc(c->width / 2, c->height / 2);
+	square_set_feat(c, p.grid, FEAT_FLOOR);
+
+	result = walk_and_compare(c, &p, ref, 2000);
+
+	mem_free(p.timed);
+	ref_free(c, ref);
+	cave_free(c);
+	require(!result);
+	ok;
+}
+
+static int test_scent_clock_rebase(void *state) {
+	struct chunk *c = make_test_cave(22, 66, 25);
+	uint16_t **ref = ref_new(c);
+	struct player p;
+	int result;
+
+	memset(&p, 0, sizeof(p));
+	p.timed = mem_zalloc(TMD_MAX * sizeof(int16_t));
+	p.grid = loc(c->width / 2, c->height / 2);
+	square_set_feat(c, p.grid, FEAT_FLOOR);
+
+	/* Start the clock just short of running out */
+	c->scent_clock = 0xFFFF - 100;
+
+	result = walk_and_compare(c, &p, ref, 500);
+
+	mem_free(p.timed);
+	ref_free(c, ref);
+	cave_free(c);
+	require(!result);
+	ok;
+}
+
+const char *suite_name = "cave/scent";
+struct test tests[] = {
+	{ "scent", test_scent },
+	{ "scent_clock_rebase", test_scent_clock_rebase },
+	{ NULL, NULL }
+};
@@ -1 +1 @@
-TESTPROGS += cave/scatter
+TESTPROGS += cave/floors cave/flow cave/mon-index cave/pack cave/ray cave/scatter cave/scent
@@ -112,6 +112,22 @@ static int test_newgame(void *state) {
 	ok;
 }
 
+static int test_savebehind(void *state) {
+	bool written = false;
+	(void)state;
+
+	/* Save again, going on while the file is written */
+	eq(savefile_save_background("Test1"), true);
+	eq(savefile_save_finished(true, &written), true);
+	eq(written, true);
+	eq(file_exists("Test1"), true);
+
+	/* Once heard of, it's gone */
+	eq(savefile_save_finished(true, &written), false);
+
+	ok;
+}
+
 static int test_loadgame(void *state) {
 	(void)state;
 	reset_before_load();
@@ -180,6 +196,56 @@ static int test_stairs2(void *state)
 	ok;
 }
 
+/* Sum up the terrain of a level, so two levels can be compared */
+static uint32_t terrain_checksum(struct chunk *c)
+{
+	uint32_t sum = 0;
+	int y, x;
+
+	for (y = 0; y < c->height; y++) {
+		for (x = 0; x < c->width; x++) {
+			sum = sum * 31 + square(c, loc(x, y))->feat;
+		}
+	}
+	return sum;
+}
+
+static uint32_t load_and_go_down(bool reseed)
+{
+	reset_before_load();
+	if (!savefile_load("Test1", false)) return 0;
+	if (reseed) Rand_state_init(42);
+	cmdq_push(CMD_GO_DOWN);
+	run_game_loop();
+	return terrain_checksum(cave);
+}
+
+static int test_stairs_repeat(void *state)
+{
+	(void)state;
+	bool (*orig_get_check_hook)(const char *) = get_check_hook;
+	uint32_t first, second;
+
+	get_check_hook = test_check_hook;
+
+	/* The same game going down the same stairs gets the same level, however
+	 * the game's random numbers have gone */
+	first = load_and_go_down(false);
+	second = load_and_go_down(true);
+	require(first != 0);
+	eq(first, second);
+
+	/* Going down again from there gets a different one */
+	cmdq_push(CMD_GO_UP);
+	run_game_loop();
+	cmdq_push(CMD_GO_DOWN);
+	run_game_loop();
+	require(terrain_checksum(cave) != first);
+
+	get_check_hook = orig_get_check_hook;
+	ok;
+}
+
 static int test_drop_pickup(void *state)
 {
 	(void)state;
@@ -251,9 +317,11 @@ static int test_drop_eat(void *state)
 const char *suite_name = "game/basic";
 struct test tests[] = {
 	{ "newgame", test_newgame },
+	{ "savebehind", test_savebehind },
 	{ "loadgame", test_loadgame },
 	{ "stairs1", test_stairs1 },
 	{ "stairs2", test_stairs2 },
+	{ "stairs_repeat", test_stairs_repeat },
 	{ "droppickup", test_drop_pickup },
 	{ "dropeat", test_drop_eat },
 	{ NULL, NULL }
@@ -0,0 +1,282 @@
+/* game/levels */
+/* Check that stored levels are found by name, and that those spilled to side
+ * files come back as they went, whether read back in play or from a save,
+ * without bringing back the custom race as it was when they were written. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "cave.h"
+#include "generate.h"
+#include "init.h"
+#include "mon-make.h"
+#include "monster.h"
+#include "player-birth.h"
+#include "savefile.h"
+
+#define TEST_LEVELS 3
+
+/* What is kept of each level to check it by */
+static struct {
+	char name[20];
+	int height;
+	int floors;
+	int monsters;
+	int objects;
+	int known_objects;
+} levels[TEST_LEVELS];
+
+static int count_objects(struct chunk *c)
+{
+	int i, n = 0;
+
+	for (i = 1; i < c->obj_max; i++) {
+		if (c->objects[i]) n++;
+	}
+	return n;
+}
+
+static long count_alive(void)
+{
+	long n = 0;
+	int i;
+
+	for (i = 0; i < z_info->r_max; i++) {
+		n += r_info[i].cur_num;
+	}
+	return n;
+}
+
+/* Build levels and store them, each with the player's map of it */
+static void store_levels(void)
+{
+	int i;
+
+	player->depth = 5;
+	for (i = 0; i < TEST_LEVELS; i++) {
+		struct chunk *c = cave_generate(player, 0, 0);
+		struct chunk *known = player->cave;
+
+		player->cave = NULL;
+		strnfmt(levels[i].name, sizeof(levels[i].name), "Level %d", i);
+		string_free(c->name);
+		c->name = string_make(levels[i].name);
+		string_free(known->name);
+		known->name = string_make(format("%s known", levels[i].name));
+		levels[i].height = c->height;
+		levels[i].floors = c->feat_count[FEAT_FLOOR];
+		levels[i].monsters = c->mon_cnt;
+		levels[i].objects = count_objects(c);
+		levels[i].known_objects = count_objects(known);
+
+		cave_pack(c);
+		cave_pack(known);
+		chunk_list_add(c);
+		chunk_list_add(known);
+	}
+}
+
+static int check_level(int i)
+{
+	struct chunk *c = chunk_find_name(levels[i].name);
+	struct chunk *known = chunk_find_name(format("%s known",
+		levels[i].name));
+
+	notnull(c);
+	notnull(known);
+	null(c->spill);
+	null(known->spill);
+	notnull(c->packed);
+	eq(c->feat_count[FEAT_FLOOR], levels[i].floors);
+	eq(c->mon_cnt, levels[i].monsters);
+	eq(count_objects(c), levels[i].objects);
+	eq(count_objects(known), levels[i].known_objects);
+	return 0;
+}
+
+int setup_tests(void **state) {
+	set_file_paths();
+	if (!init_angband()) {
+		*state = NULL;
+		return 1;
+	}
+#ifdef UNIX
+	create_needed_dirs();
+#endif
+	if (!player_make_simple(NULL, NULL, NULL, "Tester")) {
+		cleanup_angband();
+		return 1;
+	}
+	Rand_init();
+
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	cleanup_angband();
+	return 0;
+}
+
+static int test_names(void *state) {
+	struct chunk *first, *second;
+	int i;
+
+	chunk_list_free();
+	z_info->levels_kept = 0;
+	for (i = 0; i < 300; i++) {
+		struct chunk *c = cave_new(4, 4);
+
+		c->name = string_make(format("Level %d", i));
+		chunk_list_add(c);
+	}
+	first = cave_new(4, 4);
+	first->name = string_make("Twin");
+	chunk_list_add(first);
+	second = cave_new(4, 4);
+	second->name = string_make("Twin");
+	chunk_list_add(second);
+
+	for (i = 0; i < 300; i++) {
+		const char *name = format("Level %d", i);
+		struct chunk *c = chunk_find_name(name);
+
+		notnull(c);
+		require(streq(c->name, name));
+		if (i % 2) {
+			require(chunk_list_remove(name));
+			cave_free(c);
+		}
+	}
+	for (i = 0; i < 300; i++) {
+		struct chunk *c = chunk_find_name(format("Level %d", i));
+
+		if (i % 2) {
+			null(c);
+		} else {
+			notnull(c);
+		}
+	}
+	eq(chunk_list_max, 152);
+	null(chunk_find_name("Level"));
+
+	/* The first of two with the same name is found, and removed, first */
+	ptreq(chunk_find_name("Twin"), first);
+	require(chunk_list_remove("Twin"));
+	ptreq(chunk_find_name("Twin"), second);
+	cave_free(first);
+
+	chunk_list_free();
+	eq(chunk_list_max, 0);
+	null(chunk_find_name("Level 0"));
+	ok;
+}
+
+static int test_spill(void *state) {
+	char paths[2][1024];
+	long alive;
+	struct chunk *c, *known;
+	int i;
+
+	chunk_list_free();
+	alive = count_alive();
+	z_info->levels_kept = 1;
+	store_levels();
+
+	/* All but the last level left are out in side files */
+	for (i = 0; i < TEST_LEVELS; i++) {
+		c = chunk_find_name(levels[i].name);
+		known = chunk_find_name(format("%s known", levels[i].name));
+		notnull(c);
+		notnull(known);
+		if (i == TEST_LEVELS - 1) {
+			null(c->spill);
+			null(known->spill);
+			continue;
+		}
+		notnull(c->spill);
+		notnull(known->spill);
+		null(c->squares);
+		null(c->monsters);
+		require(file_exists(c->spill));
+		require(file_exists(known->spill));
+		eq(c->height, levels[i].height);
+	}
+
+	/* Their monsters still count as alive */
+	require(count_alive() > alive);
+	alive = count_alive();
+
+	/* Reading the map of a level brings the level back too */
+	known = chunk_find_name(format("%s known", levels[0].name));
+	c = chunk_find_name(levels[0].name);
+	my_strcpy(paths[0], c->spill, sizeof(paths[0]));
+	my_strcpy(paths[1], known->spill, sizeof(paths[1]));
+	require(chunk_list_load(known));
+	require(!check_level(0));
+	require(!file_exists(paths[0]));
+	require(!file_exists(paths[1]));
+	eq(count_alive(), alive);
+
+	/* Freeing the list clears the side files away */
+	c = chunk_find_name(levels[1].name);
+	my_strcpy(paths[0], c->spill, sizeof(paths[0]));
+	chunk_list_free();
+	require(!file_exists(paths[0]));
+	ok;
+}
+
+static int test_race(void *state) {
+	struct chunk *known;
+	int avg_hp = r_info[1].avg_hp, seen;
+
+	chunk_list_free();
+	z_info->levels_kept = 1;
+	store_levels();
+
+	/* The custom race changes in play while a level is out */
+	r_info[1].avg_hp = avg_hp + 1;
+	known = chunk_find_name(format("%s known", levels[0].name));
+	notnull(known->spill);
+	require(chunk_list_load(known));
+	seen = r_info[1].avg_hp;
+	r_info[1].avg_hp = avg_hp;
+	eq(seen, avg_hp + 1);
+	chunk_list_free();
+	ok;
+}
+
+static int test_save(void *state) {
+	int i, avg_hp;
+
+	chunk_list_free();
+	z_info->levels_kept = 1;
+	store_levels();
+	cave = cave_generate(player, 0, 0);
+
+	/* The custom race is saved as it is, not as levels saved before had it */
+	require(savefile_save("Test-levels"));
+	avg_hp = ++r_info[1].avg_hp;
+	require(savefile_save("Test-levels"));
+
+	/* What was spilled loads just as what wasn't */
+	play_again = true;
+	cleanup_angband();
+	init_angband();
+	play_again = false;
+	z_info->levels_kept = 0;
+	require(savefile_load("Test-levels", false));
+	for (i = 0; i < TEST_LEVELS; i++) {
+		require(!check_level(i));
+	}
+	eq(r_info[1].avg_hp, avg_hp);
+	file_delete("Test-levels");
+	ok;
+}
+
+const char *suite_name = "game/levels";
+struct test tests[] = {
+	{ "names", test_names },
+	{ "spill", test_spill },
+	{ "race", test_race },
+	{ "save", test_save },
+	{ NULL, NULL }
+};
@@ -1,2 +1,4 @@
 TESTPROGS += game/basic \
-	game/mage
+	game/levels \
+	game/mage \
+	game/vaults
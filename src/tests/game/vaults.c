@@ -0,0 +1,179 @@
+/* game/vaults */
+/* Check that vaults and room templates chosen through their indexes are the
+ * ones a scan of the lists would allow, and that each can be chosen. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "generate.h"
+#include "init.h"
+
+int setup_tests(void **state) {
+	set_file_paths();
+	if (!init_angband()) {
+		*state = NULL;
+		return 1;
+	}
+	Rand_init();
+
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	cleanup_angband();
+	return 0;
+}
+
+static bool vault_fits(const struct vault *v, int depth, const char *typ)
+{
+	return streq(v->typ, typ) && v->min_lev <= depth && v->max_lev >= depth;
+}
+
+static int test_random(void *state) {
+	int i, depth;
+
+	require(vault_type_max > 0);
+	for (i = 0; i < vault_type_max; i++) {
+		const char *typ = vault_types[i].name;
+
+		for (depth = 1; depth < z_info->max_depth; depth += 7) {
+			struct vault *v;
+			int fit = 0, j;
+
+			for (v = vaults; v; v = v->next) {
+				if (vault_fits(v, depth, typ)) fit++;
+			}
+			for (j = 0; j < 20; j++) {
+				v = random_vault(depth, typ);
+				if (!fit) {
+					null(v);
+					break;
+				}
+				notnull(v);
+				require(vault_fits(v, depth, typ));
+			}
+		}
+	}
+	null(random_vault(10, "No such vault"));
+	ok;
+}
+
+static int test_named(void *state) {
+	struct vault *v;
+
+	for (v = vaults; v; v = v->next) {
+		struct vault *found = named_vault(v->name, v->typ);
+
+		notnull(found);
+		require(streq(found->name, v->name) && streq(found->typ, v->typ));
+	}
+	null(named_vault(vaults->name, NULL));
+	null(named_vault("No such vault", vaults->typ));
+	ok;
+}
+
+static int test_named_shared(void *state) {
+	struct vault_type *t = &vault_types[0];
+	struct vault **by_name = t->by_name, *v, *first = NULL, *found;
+	char **names = mem_zalloc(t->count * sizeof(*names));
+	int i = 0;
+
+	/* Give a whole type one name, indexed as it would be, in list order */
+	t->by_name = mem_zalloc(t->count * sizeof(*t->by_name));
+	for (v = vaults; v; v = v->next) {
+		if (!streq(v->typ, t->name)) continue;
+		if (!first) first = v;
+		names[i] = v->name;
+		v->name = first->name;
+		t->by_name[i++] = v;
+	}
+
+	/* The first of them is found, as by a search of the list */
+	found = named_vault(first->name, t->name);
+	for (i = 0; i < t->count; i++) {
+		t->by_name[i]->name = names[i];
+	}
+	mem_free(t->by_name);
+	t->by_name = by_name;
+	mem_free(names);
+	ptreq(found, first);
+	ok;
+}
+
+static int test_races(void *state) {
+	struct vault *v;
+
+	for (v = vaults; v; v = v->next) {
+		const char *t;
+
+		notnull(v->races);
+		for (t = v->text; *t; t++) {
+			if (isalpha(*t) && *t != 'x' && *t != 'X') {
+				require(strchr(v->races, *t));
+			}
+		}
+		for (t = v->races; *t; t++) {
+			require(strchr(v->text, *t));
+			require(!strchr(t + 1, *t));
+		}
+	}
+	ok;
+}
+
+static int test_templates(void *state) {
+	int i;
+
+	require(room_template_max > 0);
+	for (i = 1; i < room_template_max; i++) {
+		const struct room_template *a = room_template_index[i - 1];
+		const struct room_template *b = room_template_index[i];
+
+		require(a->typ < b->typ || (a->typ == b->typ && a->rat <= b->rat));
+	}
+	ok;
+}
+
+/* Sum up the vaults and room templates, to tell whether they came back */
+static uint32_t sum_templates(void)
+{
+	struct vault *v;
+	int i;
+	uint32_t sum = 0;
+
+	for (v = vaults; v; v = v->next) {
+		sum = sum * 31 + djb2_hash(v->name) + djb2_hash(v->typ) +
+			djb2_hash(v->text) + djb2_hash(v->races);
+		sum = sum * 31 + v->rat + (v->hgt << 8) + (v->wid << 16) +
+			(v->min_lev << 24) + v->max_lev;
+	}
+	for (i = 0; i < room_template_max; i++) {
+		const struct room_template *t = room_template_index[i];
+
+		sum = sum * 31 + djb2_hash(t->name) + djb2_hash(t->text);
+		sum = sum * 31 + t->typ + (t->rat << 8) + (t->hgt << 16) +
+			(t->wid << 24) + t->dor + t->tval;
+	}
+	return sum;
+}
+
+static int test_cache(void *state) {
+	uint32_t before = sum_templates();
+
+	/* The second time round they are read from the compiled cache */
+	play_again = true;
+	cleanup_angband();
+	init_angband();
+	play_again = false;
+	eq(sum_templates(), before);
+	ok;
+}
+
+const char *suite_name = "game/vaults";
+struct test tests[] = {
+	{ "random", test_random },
+	{ "named", test_named },
+	{ "named_shared", test_named_shared },
+	{ "races", test_races },
+	{ "templates", test_templates },
+	{ "cache", test_cache },
+	{ NULL, NULL }
+};
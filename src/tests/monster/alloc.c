@@ -0,0 +1,106 @@
+/* monster/alloc */
+/* Check that get_mon_num() keeps to its restrictions while it reuses its
+ * totals from one call to the next, and sees uniques come and go. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "init.h"
+#include "mon-make.h"
+#include "mon-util.h"
+#include "monster.h"
+#include "player-birth.h"
+
+#define DRAWS 400
+
+static struct monster_race *unique;
+static struct monster_race *common;
+
+static bool only_two(struct monster_race *race) {
+	return race == unique || race == common;
+}
+
+int setup_tests(void **state) {
+	set_file_paths();
+	if (!init_angband()) {
+		*state = NULL;
+		return 1;
+	}
+	if (!player_make_simple(NULL, NULL, NULL, "Tester")) {
+		cleanup_angband();
+		return 1;
+	}
+	Rand_init();
+
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	get_mon_num_prep(NULL);
+	cleanup_angband();
+	return 0;
+}
+
+/* Count how many of DRAWS picks at the unique's depth are the unique */
+static int count_unique(void) {
+	int i, n = 0;
+
+	for (i = 0; i < DRAWS; i++) {
+		struct monster_race *race = get_mon_num(unique->level, unique->level);
+
+		if (race != unique && race != common) return -1;
+		if (race == unique) n++;
+	}
+	return n;
+}
+
+static int test_prep(void *state) {
+	int i;
+
+	unique = lookup_monster("Grip, Slick's dog");
+	common = lookup_monster("green lemming");
+	notnull(unique);
+	notnull(common);
+	require(rf_has(unique->flags, RF_UNIQUE));
+	require(!rf_has(common->flags, RF_UNIQUE));
+	unique->mut_chance = 0;
+	common->mut_chance = 0;
+
+	get_mon_num_prep(only_two);
+	require(count_unique() > 0);
+
+	/* Deeper or shallower, nothing else gets through */
+	for (i = 0; i < DRAWS; i++) {
+		struct monster_race *race = get_mon_num(1 + i % 20, 1 + i % 20);
+
+		require(race == NULL || only_two(race));
+	}
+	ok;
+}
+
+static int test_unique(void *state) {
+	/* Gone, then back, with the same level asked for each time */
+	unique->cur_num = unique->max_num;
+	eq(count_unique(), 0);
+	unique->cur_num = 0;
+	require(count_unique() > 0);
+	ok;
+}
+
+static int test_none(void *state) {
+	/* Nothing left to pick, then something again */
+	common = unique;
+	get_mon_num_prep(only_two);
+	unique->cur_num = unique->max_num;
+	null(get_mon_num(unique->level, unique->level));
+	unique->cur_num = 0;
+	ptreq(get_mon_num(unique->level, unique->level), unique);
+	ok;
+}
+
+const char *suite_name = "monster/alloc";
+struct test tests[] = {
+	{ "prep", test_prep },
+	{ "unique", test_unique },
+	{ "none", test_none },
+	{ NULL, NULL }
+};
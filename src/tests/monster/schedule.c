@@ -0,0 +1,290 @@
+/* monster/schedule */
+/* Check that monsters given energy by the scheduling wheel, or left dormant
+ * away from the player, end every game turn with the energy they would have
+ * had from being given it each turn, and that those within reach of the
+ * player, by hearing or by scent, are not left dormant. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "cave.h"
+#include "game-world.h"
+#include "init.h"
+#include "mon-move.h"
+#include "mon-timed.h"
+#include "mon-util.h"
+#include "monster.h"
+#include "player-birth.h"
+
+#define TEST_MONSTERS 40
+
+/* Stands in for a mimicked object, so the monsters never take a turn */
+static struct object dummy_obj;
+
+int setup_tests(void **state) {
+	set_file_paths();
+	if (!init_angband()) {
+		*state = NULL;
+		return 1;
+	}
+	if (!player_make_simple(NULL, NULL, NULL, "Tester")) {
+		cleanup_angband();
+		return 1;
+	}
+	Rand_init();
+
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	cleanup_angband();
+	return 0;
+}
+
+/* Speed as process_monsters() used to work it out */
+static int ref_speed(const struct monster *mon)
+{
+	int mspeed = mon->mspeed;
+
+	if (mon->m_timed[MON_TMD_FAST])
+		mspeed += 10;
+	if (mon->m_timed[MON_TMD_SLOW])
+		mspeed -= 2 * monster_effect_level(mon, MON_TMD_SLOW);
+	return mspeed;
+}
+
+static struct chunk *setup_level(struct monster_race *race, int height,
+		int width, bool mimics)
+{
+	struct chunk *c = make_test_cave(height, width, 0);
+	int i;
+
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		struct monster *mon = &c->monsters[i];
+
+		mon->race = race;
+		mon->midx = i;
+		mon->grid = loc(width - 2 - i, 1 + i % (height - 2));
+		mon->hp = mon->maxhp = 10;
+		mon->mspeed = 110 + randint0(21) - 10;
+		mon->energy = randint0(100);
+		if (mimics) {
+			mflag_on(mon->mflag, MFLAG_CAMOUFLAGE);
+			mon->mimicked_obj = &dummy_obj;
+		}
+		square_set_mon(c, mon->grid, i);
+	}
+	c->mon_max = TEST_MONSTERS + 1;
+	c->mon_cnt = TEST_MONSTERS;
+	return c;
+}
+
+/* Speed some monsters up and slow others down between turns */
+static void random_speed_change(struct chunk *c)
+{
+	struct monster *mon = cave_monster(c, randint1(TEST_MONSTERS));
+	int effect = one_in_(2) ? MON_TMD_FAST : MON_TMD_SLOW;
+
+	if (one_in_(3)) {
+		mon_clear_timed(mon, effect, MON_TMD_FLG_NOMESSAGE);
+	} else {
+		mon_inc_timed(mon, effect, randint1(20),
+			MON_TMD_FLG_NOMESSAGE | MON_TMD_FLG_NOFAIL);
+	}
+}
+
+/* Run a game turn, and the same turn the old way, where every monster gets
+ * energy every turn */
+static void run_turn(struct chunk *c, int *ref)
+{
+	int i;
+
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		bool moving = ref[i] >= z_info->move_energy;
+
+		ref[i] += turn_energy(ref_speed(cave_monster(c, i)));
+		if (moving) ref[i] -= z_info->move_energy;
+	}
+
+	process_monsters(c, 0);
+	reset_monsters();
+	turn++;
+}
+
+static int test_schedule(void *state) {
+	struct monster_race *race = lookup_monster("green lemming");
+	struct chunk *c;
+	int ref[TEST_MONSTERS + 1];
+	int i, t;
+
+	turn = 1;
+	c = setup_level(race, 22, 66, true);
+	cave = c;
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		ref[i] = c->monsters[i].energy;
+	}
+	schedule_monsters(c);
+
+	for (t = 0; t < 1000; t++) {
+		if (one_in_(5)) random_speed_change(c);
+		run_turn(c, ref);
+
+		settle_monsters(c);
+		for (i = 1; i <= TEST_MONSTERS; i++) {
+			eq(cave_monster(c, i)->energy, ref[i]);
+		}
+	}
+
+	cave = NULL;
+	cave_free(c);
+	ok;
+}
+
+static int test_dormant(void *state) {
+	struct monster_race *race = lookup_monster("green lemming");
+	struct chunk *c;
+	int ref[TEST_MONSTERS + 1];
+	int i, t, dormant = 0;
+
+	turn = 1;
+	c = setup_level(race, 66, 198, false);
+	cave = c;
+	player->grid = loc(1, 1);
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		ref[i] = c->monsters[i].energy;
+	}
+	schedule_monsters(c);
+
+	for (t = 0; t < 1000; t++) {
+		if (one_in_(20)) random_speed_change(c);
+
+		/* Walk over to the monsters and back */
+		if (t % 4 == 0) {
+			player->grid.x = t < 500 ? player->grid.x + 1 : player->grid.x - 1;
+		}
+
+		run_turn(c, ref);
+		dormant = MAX(dormant, c->mon_dormant_cnt);
+
+		/* Nothing the player is near is left dormant */
+		for (i = 1; i <= TEST_MONSTERS; i++) {
+			struct monster *mon = cave_monster(c, i);
+
+			if (c->mon_dormant[i]) {
+				require(ABS(mon->grid.x - player->grid.x) >
+					z_info->max_sight);
+			}
+		}
+
+		/* Check one monster at a time, to leave the rest dormant */
+		i = 1 + t % TEST_MONSTERS;
+		monster_settle_energy(c, cave_monster(c, i));
+		eq(cave_monster(c, i)->energy, ref[i]);
+	}
+	require(dormant > 0);
+
+	settle_monsters(c);
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		eq(cave_monster(c, i)->energy, ref[i]);
+	}
+
+	cave = NULL;
+	cave_free(c);
+	ok;
+}
+
+static int test_walls(void *state) {
+	struct monster_race race = *lookup_monster("green lemming");
+	struct chunk *c;
+	int ref[TEST_MONSTERS + 1];
+	int stealth = player->state.skills[SKILL_STEALTH];
+	int i, t, dormant;
+
+	/* A wall passer that hears further than the player's stealth allows */
+	rf_on(race.flags, RF_KILL_WALL);
+	race.hearing = 40;
+	player->state.skills[SKILL_STEALTH] = 30;
+
+	turn = 1;
+	c = setup_level(&race, 66, 198, false);
+	cave = c;
+	player->grid = loc(1, 1);
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		ref[i] = c->monsters[i].energy;
+		c->monsters[i].cdis = distance(c->monsters[i].grid, player->grid);
+	}
+	schedule_monsters(c);
+	for (t = 0; t < 20; t++) {
+		run_turn(c, ref);
+	}
+	for (i = 1, dormant = 0; i <= 5; i++) {
+		if (c->mon_dormant[i]) dormant++;
+	}
+	require(dormant > 0);
+
+	/* Come within full hearing of those, though not within reach by stealth */
+	player->grid = loc(cave_monster(c, 1)->grid.x - 35, 1);
+	promote_monsters(c);
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		require(!c->mon_dormant[i]);
+	}
+
+	settle_monsters(c);
+	for (i = 1; i <= TEST_MONSTERS; i++) {
+		eq(cave_monster(c, i)->energy, ref[i]);
+	}
+
+	player->state.skills[SKILL_STEALTH] = stealth;
+	cave = NULL;
+	cave_free(c);
+	ok;
+}
+
+static int test_scent(void *state) {
+	struct monster_race race = *lookup_monster("green lemming");
+	struct chunk *c;
+	struct monster *mon;
+	int i, t, woken = 0;
+
+	race.smell = 20;
+	turn = 1;
+	c = setup_level(&race, 66, 198, false);
+	cave = c;
+	player->grid = loc(1, 1);
+
+	/* The player's trail runs under the first monster, held in place */
+	mon = cave_monster(c, 1);
+	c->scent_clock = 10;
+	c->scent.grids[mon->grid.y][mon->grid.x] = c->scent_clock;
+	mon->m_timed[MON_TMD_HOLD] = 100;
+	schedule_monsters(c);
+	for (t = 0; t < 20; t++) {
+		process_monsters(c, 0);
+		reset_monsters();
+		turn++;
+	}
+	require(!c->mon_dormant[1]);
+
+	/* Scent laid on the grid of a dormant monster brings it back */
+	for (i = 2; i <= TEST_MONSTERS && !woken; i++) {
+		if (!c->mon_dormant[i]) continue;
+		mon = cave_monster(c, i);
+		player->grid = loc(mon->grid.x - 1, mon->grid.y);
+		update_scent(c, player);
+		require(!c->mon_dormant[i]);
+		woken = i;
+	}
+	require(woken > 0);
+
+	cave = NULL;
+	cave_free(c);
+	ok;
+}
+
+const char *suite_name = "monster/schedule";
+struct test tests[] = {
+	{ "schedule", test_schedule },
+	{ "dormant", test_dormant },
+	{ "walls", test_walls },
+	{ "scent", test_scent },
+	{ NULL, NULL }
+};
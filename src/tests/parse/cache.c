@@ -0,0 +1,170 @@
+/* parse/cache */
+/* Check that a parser with a compiled cache reads the cache back while its
+ * data file and flag names are unchanged, and parses the file again when
+ * they aren't. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "datafile.h"
+#include "init.h"
+
+#define MAX_VALUES 10
+
+static int values[MAX_VALUES];
+static int value_count;
+static int times_parsed;
+static const char *test_flags[] = { "NONE", "FIRST", NULL };
+static char data_path[1024];
+static char cache_path[1024];
+
+static enum parser_error parse_value(struct parser *p) {
+	if (value_count == MAX_VALUES)
+		return PARSE_ERROR_TOO_MANY_ENTRIES;
+	values[value_count++] = parser_getint(p, "value");
+	return PARSE_ERROR_NONE;
+}
+
+static struct parser *init_parse_test(void) {
+	struct parser *p = parser_new();
+
+	parser_reg(p, "value int value", parse_value);
+	value_count = 0;
+	times_parsed++;
+	return p;
+}
+
+static errr run_parse_test(struct parser *p) {
+	return parse_file(p, "cachetest");
+}
+
+static errr finish_parse_test(struct parser *p) {
+	parser_destroy(p);
+	return 0;
+}
+
+static void cleanup_test(void) {
+	value_count = 0;
+}
+
+static void write_test_cache(struct data_cache *dc) {
+	int i;
+
+	cache_put_u32(dc, value_count);
+	for (i = 0; i < value_count; i++) {
+		cache_put_u32(dc, values[i]);
+	}
+}
+
+static bool read_test_cache(struct data_cache *dc) {
+	int i;
+
+	value_count = cache_get_u32(dc);
+	if (value_count > MAX_VALUES) return false;
+	for (i = 0; i < value_count; i++) {
+		values[i] = cache_get_u32(dc);
+	}
+	return true;
+}
+
+static struct file_parser test_parser = {
+	"cachetest",
+	init_parse_test,
+	run_parse_test,
+	finish_parse_test,
+	cleanup_test,
+	1,
+	write_test_cache,
+	read_test_cache,
+	test_flags
+};
+
+static bool write_file(const char *path, const char *text) {
+	ang_file *f = file_open(path, MODE_WRITE, FTYPE_TEXT);
+
+	if (!f) return false;
+	file_put(f, text);
+	return file_close(f);
+}
+
+int setup_tests(void **state) {
+	char dir[1024];
+
+	set_file_paths();
+	if (!dir_create(ANGBAND_DIR_USER)) return 1;
+	path_build(data_path, sizeof(data_path), ANGBAND_DIR_USER,
+		"cachetest.txt");
+	path_build(dir, sizeof(dir), ANGBAND_DIR_USER, "cache");
+	path_build(cache_path, sizeof(cache_path), dir, "cachetest.dat");
+	file_delete(cache_path);
+	return !write_file(data_path, "value:1\nvalue:2\n");
+}
+
+int teardown_tests(void *state) {
+	file_delete(data_path);
+	file_delete(cache_path);
+	return 0;
+}
+
+static int test_parsed(void *state) {
+	eq(run_parser(&test_parser), 0);
+	eq(times_parsed, 1);
+	eq(value_count, 2);
+	require(file_exists(cache_path));
+	ok;
+}
+
+static int test_cached(void *state) {
+	cleanup_parser(&test_parser);
+	eq(run_parser(&test_parser), 0);
+	eq(times_parsed, 1);
+	eq(value_count, 2);
+	eq(values[0], 1);
+	eq(values[1], 2);
+	ok;
+}
+
+static int test_changed(void *state) {
+	cleanup_parser(&test_parser);
+	require(write_file(data_path, "value:3\n"));
+	eq(run_parser(&test_parser), 0);
+	eq(times_parsed, 2);
+	eq(value_count, 1);
+	eq(values[0], 3);
+	ok;
+}
+
+static int test_broken(void *state) {
+	cleanup_parser(&test_parser);
+
+	/* A cache cut short is no use, so the file is parsed again */
+	require(write_file(cache_path, "xdc1"));
+	eq(run_parser(&test_parser), 0);
+	eq(times_parsed, 3);
+	eq(value_count, 1);
+	eq(values[0], 3);
+	ok;
+}
+
+static int test_flags_changed(void *state) {
+	cleanup_parser(&test_parser);
+	eq(run_parser(&test_parser), 0);
+	eq(times_parsed, 3);
+
+	/* Bits written under other flag names can't be read back */
+	cleanup_parser(&test_parser);
+	test_flags[1] = "SECOND";
+	eq(run_parser(&test_parser), 0);
+	eq(times_parsed, 4);
+	eq(value_count, 1);
+	ok;
+}
+
+const char *suite_name = "parse/cache";
+struct test tests[] = {
+	{ "parsed", test_parsed },
+	{ "cached", test_cached },
+	{ "changed", test_changed },
+	{ "broken", test_broken },
+	{ "flags", test_flags_changed },
+	{ NULL, NULL }
+};
@@ -394,6 +394,47 @@ static int test_char1(void *state) {
 	ok;
 }
 
+static enum parser_error helper_char2(struct parser *p) {
+	char c = parser_getchar(p, "c");
+	int *wasok = parser_priv(p);
+
+	if (c != 'C' || parser_hasval(p, "i"))
+		return PARSE_ERROR_GENERIC;
+	*wasok = 1;
+	return PARSE_ERROR_NONE;
+}
+
+static int test_char2(void *state) {
+	int wasok = 0;
+	errr r = parser_reg(state, "test-char2 char c ?int i", helper_char2);
+	enum parser_error e;
+	eq(r, 0);
+	parser_setpriv(state, &wasok);
+	e = parser_parse(state, "test-char2:C");
+	eq(e, PARSE_ERROR_NONE);
+	eq(wasok, 1);
+	ok;
+}
+
+static enum parser_error helper_redef(struct parser *p) {
+	return PARSE_ERROR_GENERIC;
+}
+
+static int test_redef(void *state) {
+	int i;
+
+	/* The later of two hooks for a directive is the one run, however
+	 * many others there are */
+	eq(parser_reg(state, "test-redef int i", helper_redef), 0);
+	for (i = 0; i < 40; i++) {
+		eq(parser_reg(state, format("test-redef%d int i", i), ignored), 0);
+	}
+	eq(parser_reg(state, "test-redef sym s", ignored), 0);
+	eq(parser_parse(state, "test-redef:abc"), PARSE_ERROR_NONE);
+	eq(parser_parse(state, "test-redef39:1"), PARSE_ERROR_NONE);
+	ok;
+}
+
 const char *suite_name = "parse/parser";
 struct test tests[] = {
 	{ "priv", test_priv },
@@ -434,6 +475,9 @@ struct test tests[] = {
 
 	{ "char0", test_char0 },
 	{ "char1", test_char1 },
+	{ "char2", test_char2 },
+
+	{ "redef", test_redef },
 
 	{ "baddir", test_baddir },
 
@@ -0,0 +1,175 @@
+/* parse/throughput */
+/* Check that a data file parsed whole comes out as it does a line at a time,
+ * and time how fast the biggest of them, vault.txt, goes through the parser. */
+
+#include "unit-test.h"
+#include "test-utils.h"
+#include "datafile.h"
+#include "init.h"
+#include <time.h>
+
+#define PASSES 5
+
+static double pass_secs;
+static long pass_lines;
+
+/* What is seen of the file */
+static struct {
+	uint32_t hash;
+	long lines;
+	long rows;
+	long text;
+	long bytes;
+} seen;
+
+static void hash_text(const char *s) {
+	while (*s) {
+		seen.hash = (seen.hash ^ (uint8_t) *s++) * 16777619;
+	}
+	seen.hash = (seen.hash ^ 0xFF) * 16777619;
+}
+
+static void hash_value(unsigned int value) {
+	hash_text(format("%u", value));
+}
+
+static enum parser_error parse_str(struct parser *p, const char *name) {
+	const char *s = parser_getstr(p, name);
+
+	seen.lines++;
+	seen.bytes += strlen(s);
+	hash_text(s);
+	return PARSE_ERROR_NONE;
+}
+
+static enum parser_error parse_name(struct parser *p) {
+	return parse_str(p, "name");
+}
+
+static enum parser_error parse_type(struct parser *p) {
+	return parse_str(p, "type");
+}
+
+static enum parser_error parse_flags(struct parser *p) {
+	return parse_str(p, "flags");
+}
+
+static enum parser_error parse_rating(struct parser *p) {
+	seen.lines++;
+	hash_value(parser_getint(p, "rating"));
+	return PARSE_ERROR_NONE;
+}
+
+static enum parser_error parse_rows(struct parser *p) {
+	unsigned int rows = parser_getuint(p, "height");
+
+	seen.lines++;
+	seen.rows += rows;
+	hash_value(rows);
+	return PARSE_ERROR_NONE;
+}
+
+static enum parser_error parse_columns(struct parser *p) {
+	seen.lines++;
+	hash_value(parser_getuint(p, "width"));
+	return PARSE_ERROR_NONE;
+}
+
+static enum parser_error parse_depth(struct parser *p) {
+	seen.lines++;
+	hash_value(parser_getuint(p, "depth"));
+	return PARSE_ERROR_NONE;
+}
+
+static enum parser_error parse_d(struct parser *p) {
+	seen.text++;
+	return parse_str(p, "text");
+}
+
+static struct parser *vault_parser(void) {
+	struct parser *p = parser_new();
+
+	parser_reg(p, "name str name", parse_name);
+	parser_reg(p, "type str type", parse_type);
+	parser_reg(p, "rating int rating", parse_rating);
+	parser_reg(p, "rows uint height", parse_rows);
+	parser_reg(p, "columns uint width", parse_columns);
+	parser_reg(p, "min-depth uint depth", parse_depth);
+	parser_reg(p, "max-depth uint depth", parse_depth);
+	parser_reg(p, "flags str flags", parse_flags);
+	parser_reg(p, "D str text", parse_d);
+	return p;
+}
+
+int setup_tests(void **state) {
+	set_file_paths();
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	if (verbose && pass_secs > 0) {
+		printf("vault.txt: %.1f ms a pass, %.0f lines/s\n", pass_secs * 1000,
+			pass_lines / pass_secs);
+	}
+	return 0;
+}
+
+static int test_whole(void *state) {
+	char path[1024];
+	char buf[1024];
+	struct parser *p = vault_parser();
+	ang_file *fh;
+	uint32_t hash;
+	long lines, bytes;
+
+	/* Parse it the old way, a line at a time */
+	path_build(path, sizeof(path), ANGBAND_DIR_GAMEDATA, "vault.txt");
+	fh = file_open(path, MODE_READ, FTYPE_TEXT);
+	notnull(fh);
+	memset(&seen, 0, sizeof(seen));
+	while (file_getl(fh, buf, sizeof(buf))) {
+		eq(parser_parse(p, buf), PARSE_ERROR_NONE);
+	}
+	file_close(fh);
+	parser_destroy(p);
+	require(seen.lines > 0);
+	eq(seen.text, seen.rows);
+	hash = seen.hash;
+	lines = seen.lines;
+	bytes = seen.bytes;
+
+	/* Then whole */
+	p = vault_parser();
+	memset(&seen, 0, sizeof(seen));
+	eq(parse_file(p, "vault"), 0);
+	parser_destroy(p);
+	eq(seen.lines, lines);
+	eq(seen.bytes, bytes);
+	eq(seen.hash, hash);
+	ok;
+}
+
+static int test_speed(void *state) {
+	clock_t start = clock();
+	int i;
+
+	for (i = 0; i < PASSES; i++) {
+		struct parser *p = vault_parser();
+
+		memset(&seen, 0, sizeof(seen));
+		eq(parse_file(p, "vault"), 0);
+		parser_destroy(p);
+		eq(seen.text, seen.rows);
+	}
+
+	pass_secs = (double) (clock() - start) / CLOCKS_PER_SEC / PASSES;
+	pass_lines = seen.lines;
+	ok;
+}
+
+const char *suite_name = "parse/throughput";
+struct test tests[] = {
+	{ "whole", test_whole },
+	{ "speed", test_speed },
+	{ NULL, NULL }
+};
@@ -7,6 +7,7 @@
  */
 
 #include "h-basic.h"
+#include "cave.h"
 #include "config.h"
 #include "init.h"
 #include "test-utils.h"
@@ -55,6 +56,35 @@ void read_edit_files(void) {
 	init_arrays();
 }
 
+/*
+ * Make a level walled in with permanent rock, with the given percentage of
+ * the grids inside granite and the rest floor.  Needs the terrain information.
+ */
+struct chunk *make_test_cave(int height, int width, int walls) {
+	struct chunk *c = cave_new(height, width);
+	struct loc grid;
+
+	for (grid.y = 0; grid.y < height; grid.y++) {
+		for (grid.x = 0; grid.x < width; grid.x++) {
+			if (!square_in_bounds_fully(c, grid)) {
+				square_set_feat(c, grid, FEAT_PERM);
+			} else if (randint0(100) < walls) {
+				square_set_feat(c, grid, FEAT_GRANITE);
+			} else {
+				square_set_feat(c, grid, FEAT_FLOOR);
+			}
+		}
+	}
+	return c;
+}
+
+/*
+ * Pick a grid inside the permanent wall around a level.
+ */
+struct loc random_interior_grid(struct chunk *c) {
+	return loc(rand_range(1, c->width - 2), rand_range(1, c->height - 2));
+}
+
 const char *ornull(const char *text)
 {
 	return (text ? text : "(null)");
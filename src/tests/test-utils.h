@@ -9,7 +9,12 @@
 #ifndef TEST_UTILS_H
 #define TEST_UTILS_H
 
+struct chunk;
+struct loc;
+
 void set_file_paths(void);
 void read_edit_files(void);
+struct chunk *make_test_cave(int height, int width, int walls);
+struct loc random_interior_grid(struct chunk *c);
 
 #endif /* TEST_UTIL_H */
@@ -0,0 +1,98 @@
+/* z-strmap/strmap.c */
+
+#include "unit-test.h"
+#include "z-strmap.h"
+#include "z-form.h"
+
+int setup_tests(void **state)
+{
+	(void)state;
+	return 0;
+}
+
+int teardown_tests(void *state)
+{
+	(void)state;
+	return 0;
+}
+
+static int test_add(void *state)
+{
+	struct strmap *m = strmap_new(false);
+
+	(void)state;
+	require(strmap_add(m, "foo", 1));
+	require(strmap_add(m, "bar", 2));
+	require(strmap_add(m, "Foo", 3));
+	eq(strmap_get(m, "foo"), 1);
+	eq(strmap_get(m, "bar"), 2);
+	eq(strmap_get(m, "Foo"), 3);
+	eq(strmap_get(m, "baz"), -1);
+	eq(strmap_get(m, ""), -1);
+	eq(strmap_count(m), 3);
+	strmap_free(m);
+	ok;
+}
+
+static int test_first(void *state)
+{
+	struct strmap *m = strmap_new(false);
+
+	(void)state;
+	require(strmap_add(m, "foo", 1));
+	require(!strmap_add(m, "foo", 2));
+	eq(strmap_get(m, "foo"), 1);
+	eq(strmap_count(m), 1);
+	strmap_free(m);
+	ok;
+}
+
+static int test_fold(void *state)
+{
+	struct strmap *m = strmap_new(true);
+
+	(void)state;
+	require(strmap_add(m, "Grip, Farmer Maggot's Dog", 1));
+	require(!strmap_add(m, "GRIP, FARMER MAGGOT'S DOG", 2));
+	eq(strmap_get(m, "grip, farmer maggot's dog"), 1);
+	eq(strmap_get(m, "Grip"), -1);
+	strmap_free(m);
+	ok;
+}
+
+static int test_grow(void *state)
+{
+	struct strmap *m = strmap_new(false);
+	int i;
+
+	(void)state;
+	for (i = 0; i < 1000; i++) {
+		require(strmap_add(m, format("key %d", i), i));
+	}
+	eq(strmap_count(m), 1000);
+	for (i = 0; i < 1000; i++) {
+		eq(strmap_get(m, format("key %d", i)), i);
+	}
+	eq(strmap_get(m, "key 1000"), -1);
+	strmap_free(m);
+	ok;
+}
+
+static int test_null(void *state)
+{
+	(void)state;
+	eq(strmap_get(NULL, "foo"), -1);
+	eq(strmap_count(NULL), 0);
+	strmap_free(NULL);
+	ok;
+}
+
+const char *suite_name = "z-strmap/strmap";
+struct test tests[] = {
+	{ "add", test_add },
+	{ "first", test_first },
+	{ "fold", test_fold },
+	{ "grow", test_grow },
+	{ "null", test_null },
+	{ NULL, NULL }
+};
@@ -227,11 +227,43 @@ static int test_utf32_to_utf8(void *state)
 	ok;
 }
 
+struct sort_pair {
+	int key;
+	int order;
+};
+
+static int cmp_sort_pair(const void *a, const void *b)
+{
+	return ((const struct sort_pair *) a)->key -
+		((const struct sort_pair *) b)->key;
+}
+
+static int test_sort_stable(void *state)
+{
+	struct sort_pair pairs[40];
+	int i;
+
+	for (i = 0; i < (int) N_ELEMENTS(pairs); i++) {
+		pairs[i].key = (i * 7) % 5;
+		pairs[i].order = i;
+	}
+	sort_stable(pairs, N_ELEMENTS(pairs), sizeof(pairs[0]), cmp_sort_pair);
+	for (i = 1; i < (int) N_ELEMENTS(pairs); i++) {
+		require(pairs[i - 1].key <= pairs[i].key);
+		if (pairs[i - 1].key == pairs[i].key) {
+			require(pairs[i - 1].order < pairs[i].order);
+		}
+	}
+
+	ok;
+}
+
 const char *suite_name = "z-util/util";
 struct test tests[] = {
 	{ "utf8_clipto", test_alloc },
 	{ "utf8_fskip", test_utf8_fskip },
 	{ "utf8_rskip", test_utf8_rskip },
 	{ "utf32_to_utf8", test_utf32_to_utf8 },
+	{ "sort_stable", test_sort_stable },
 	{ NULL, NULL }
 };
@@ -2567,7 +2567,7 @@ static void new_level_display_update(game_event_type type,
 
 	/* If autosave is pending, do it now. */
 	if (player->upkeep->autosave) {
-		if (!save_game_checked(true))
+		if (!autosave_game())
 			msg("Autosave on entering new level failed!");
 		player->upkeep->autosave = false;
 	}
@@ -768,11 +768,11 @@ void save_game(bool quiet)
 }
 
 /**
- * Save the game.
+ * Save the game, or start saving it if background is set.
  *
- * \return whether the save was successful.
+ * \return whether the save was successful, or could be started.
  */
-bool save_game_checked(bool quiet)
+static bool save_game_aux(bool quiet, bool background)
 {
 	char path[1024];
 	bool result;
@@ -801,7 +801,8 @@ bool save_game_checked(bool quiet)
 	signals_ignore_tstp();
 
 	/* Save the player */
-	if (savefile_save(savefile)) {
+	if (background ? savefile_save_background(savefile) :
+			savefile_save(savefile)) {
 		if (!quiet)
 			prt("Saving game... done.", 0, 0);
 		result = true;
@@ -839,6 +840,27 @@ bool save_game_checked(bool quiet)
 	return result;
 }
 
+/**
+ * Save the game.
+ *
+ * \return whether the save was successful.
+ */
+bool save_game_checked(bool quiet)
+{
+	return save_game_aux(quiet, false);
+}
+
+/**
+ * Save the game quietly, going on with play while the savefile is written;
+ * savefile_save_finished() says later whether it was.
+ *
+ * \return whether the save could be started.
+ */
+bool autosave_game(void)
+{
+	return save_game_aux(true, true);
+}
+
 
 /**
  * Close up the current game (player may or may not be dead).
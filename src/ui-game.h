@@ -42,6 +42,7 @@ void savefile_set_name(const char *fname, bool make_safe, bool strip_suffix);
 
 void save_game(bool quiet);
 bool save_game_checked(bool quiet);
+bool autosave_game(void);
 void close_game(bool prompt_failed_save);
 
 #endif /* INCLUDED_UI_GAME_H */
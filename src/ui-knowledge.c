@@ -24,6 +24,7 @@
 #include "effects-info.h"
 #include "game-input.h"
 #include "game-world.h"
+#include "generate.h"
 #include "grafmode.h"
 #include "init.h"
 #include "mon-lore.h"
@@ -1513,24 +1514,34 @@ bool remove_object(struct object *target)
 	/* Stored chunk objects */
 	for (i = 0; i < chunk_list_max; i++) {
 		struct chunk *c = chunk_list[i];
+		bool packed, found = false;
 		int j;
 		if (strstr(c->name, "known")) continue;
 
+		/* Open the level out to search it, reading it back in if need be */
+		if (!chunk_list_load(c)) {
+			i--;
+			continue;
+		}
+		packed = c->packed != NULL;
+		cave_unpack(c);
+
 		/* Ground objects */
-		for (y = 1; y < c->height; y++) {
-			for (x = 1; x < c->width; x++) {
+		for (y = 1; y < c->height && !found; y++) {
+			for (x = 1; x < c->width && !found; x++) {
 				struct loc grid = loc(x, y);
 				for (obj = square_object(c, grid); obj; obj = obj->next) {
 					if (obj == target) {
 						square_delete_object(c, grid, obj, true, true);
-						return true;
+						found = true;
+						break;
 					}
 				}
 			}
 		}
 
 		/* Monster objects */
-		for (j = cave_monster_max(c) - 1; j >= 1; j--) {
+		for (j = cave_monster_max(c) - 1; j >= 1 && !found; j--) {
 			struct monster *mon = cave_monster(c, j);
 			obj = mon ? mon->held_obj : NULL;
 
@@ -1539,11 +1550,15 @@ bool remove_object(struct object *target)
 					obj->held_m_idx = 0;
 					pile_excise(&mon->held_obj, obj);
 					do_remove_object(c, NULL, &obj);
-					return true;
+					found = true;
+					break;
 				}
 				obj = obj->next;
 			}
 		}
+
+		if (packed) cave_pack(c);
+		if (found) return true;
 	}
 	return false;
 }
@@ -1650,9 +1665,19 @@ struct object *locate_object(struct object * (*fn )(struct object *, void *), vo
 		/* Stored chunk objects */
 		for (i = 0; i < chunk_list_max; i++) {
 			struct chunk *c = chunk_list[i];
+			bool packed;
 			int j;
 			if (strstr(c->name, "known")) continue;
 
+			/* Open the level out to search it, reading it back in if
+			 * need be */
+			if (!chunk_list_load(c)) {
+				i--;
+				continue;
+			}
+			packed = c->packed != NULL;
+			cave_unpack(c);
+
 			/* Ground objects */
 			for (y = 1; y < c->height; y++) {
 				for (x = 1; x < c->width; x++) {
@@ -1683,6 +1708,8 @@ struct object *locate_object(struct object * (*fn )(struct object *, void *), vo
 					obj = obj->next;
 				}
 			}
+
+			if (packed) cave_pack(c);
 		}
 	}
 
@@ -46,6 +46,9 @@ static int *world_distance;
 /* Seeds the RNG to produce town distance arrays */
 uint32_t world_town_seed;
 
+/* Number of levels made so far at each depth of each town's dungeon */
+uint16_t *world_level_visits;
+
 /* Arrays of names from town-names.txt */
 static char **town_full_name;
 static int town_full_names;
@@ -81,6 +84,8 @@ void world_cleanup_towns(void)
 	stores = NULL;
 	mem_free(t_info);
 	t_info = NULL;
+	mem_free(world_level_visits);
+	world_level_visits = NULL;
 	player->town = NULL;
 	z_info->town_max = 0;
 }
@@ -822,6 +827,22 @@ static void world_connect_complete(void)
 			world_connect_towns(t_info+i, t_info+j);
 }
 
+/**
+ * Count a new level being made at a depth of a town's dungeon, and return
+ * the number made there before it.
+ */
+uint16_t world_level_visit(struct town *t, int depth)
+{
+	int town = t ? t - t_info : 0;
+
+	if (!world_level_visits) {
+		world_level_visits = mem_zalloc(z_info->town_max * z_info->max_depth
+			* sizeof(uint16_t));
+	}
+	depth = MIN(MAX(depth, 0), z_info->max_depth - 1);
+	return world_level_visits[town * z_info->max_depth + depth]++;
+}
+
 /**
  * Generate towns, etc.
  * Returns true if successful.
@@ -39,6 +39,7 @@ struct town {
 extern struct town *t_info;
 
 extern uint32_t world_town_seed;
+extern uint16_t *world_level_visits;
 
 extern struct file_parser world_parser;
 extern struct file_parser town_names_parser;
@@ -48,6 +49,7 @@ extern bool world_level_exists(const char *dungeon, int level);
 extern int world_connections(struct town *t);
 extern bool world_init_towns(void);
 extern void world_cleanup_towns(void);
+uint16_t world_level_visit(struct town *t, int depth);
 void world_change_town(struct town *t);
 void world_connect_towns(struct town *a, struct town *b);
 int world_departure_time(struct town *from, struct town *to);
@@ -443,6 +443,22 @@ bool file_close(ang_file *f)
 }
 
 
+/**
+ * Flush what has been written to file handle 'f' out to the disk.
+ */
+bool file_sync(ang_file *f)
+{
+	if (fflush(f->fh) != 0)
+		return false;
+
+#ifdef UNIX
+	if (fsync(fileno(f->fh)) != 0)
+		return false;
+#endif
+
+	return true;
+}
+
 
 /** Locking functions **/
 
@@ -544,8 +560,6 @@ bool file_write(ang_file *f, const char *buf, size_t n)
  * Support both \r\n and \n as line endings, but not the outdated \r that used
  * to be used on Macs.  Replace non-printables with '?', and \ts with ' '.
  */
-#define TAB_COLUMNS 4
-
 bool file_getl(ang_file *f, char *buf, size_t len)
 {
 	bool seen_cr = false;
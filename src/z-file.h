@@ -165,6 +165,13 @@ extern void (*file_open_hook)(const char *path, file_type ftype);
  */
 bool file_close(ang_file *f);
 
+/**
+ * Make sure what has been written to `f` is on the disk.
+ *
+ * Returns true if successful, false otherwise.
+ */
+bool file_sync(ang_file *f);
+
 
 /** File locking **/
 
@@ -180,6 +187,12 @@ void file_unlock(ang_file *f);
 
 /** Line-based IO **/
 
+/**
+ * Width of the tab stops that tabs in text read a line at a time are
+ * expanded to.
+ */
+#define TAB_COLUMNS 4
+
 /**
  * Get a line of text from the file represented by `f`, placing it into `buf`
  * to a maximum length of `n`.
@@ -20,9 +20,11 @@
 #include "z-util.h"
 #include "z-virt.h"
 #include "z-quark.h"
+#include "z-strmap.h"
 #include "init.h"
 
 static char **quarks;
+static struct strmap *quark_map;
 static size_t nr_quarks = 1;
 static size_t alloc_quarks = 0;
 
@@ -31,11 +33,10 @@ static size_t alloc_quarks = 0;
 quark_t quark_add(const char *str)
 {
 	quark_t q;
+	int found = strmap_get(quark_map, str);
 
-	for (q = 1; q < nr_quarks; q++) {
-		if (streq(quarks[q], str))
-			return q;
-	}
+	if (found > 0)
+		return found;
 
 	if (nr_quarks == alloc_quarks) {
 		alloc_quarks *= 2;
@@ -44,6 +45,7 @@ quark_t quark_add(const char *str)
 
 	q = nr_quarks++;
 	quarks[q] = string_make(str);
+	strmap_add(quark_map, str, q);
 
 	return q;
 }
@@ -58,6 +60,7 @@ void quarks_init(void)
 	nr_quarks = 1;
 	alloc_quarks = QUARKS_INIT;
 	quarks = mem_zalloc(alloc_quarks * sizeof(char*));
+	quark_map = strmap_new(false);
 }
 
 void quarks_free(void)
@@ -69,6 +72,8 @@ void quarks_free(void)
 		string_free(quarks[i]);
 
 	mem_free(quarks);
+	strmap_free(quark_map);
+	quark_map = NULL;
 }
 
 struct init_module z_quark_module = {
@@ -0,0 +1,137 @@
+/**
+ * \file z-strmap.c
+ * \brief Hash table from strings to integers
+ *
+ * This work is free software; you can redistribute it and/or modify it
+ * under the terms of either:
+ *
+ * a) the GNU General Public License as published by the Free Software
+ *    Foundation, version 2, or
+ *
+ * b) the "Angband licence":
+ *    This software may be copied and distributed for educational, research,
+ *    and not for profit purposes provided that this copyright and statement
+ *    are included in all such copies.  Other copyrights may also apply.
+ */
+
+#include "z-strmap.h"
+#include "z-util.h"
+#include "z-virt.h"
+
+/**
+ * The table is open, probing on to the next slot from where a key hashes
+ * to, and is kept no more than three quarters full.
+ */
+#define STRMAP_INIT	16
+
+struct strmap_slot {
+	char *key;
+	uint32_t hash;
+	int value;
+};
+
+struct strmap {
+	struct strmap_slot *slots;
+	size_t size;
+	size_t count;
+	bool fold_case;
+};
+
+static uint32_t strmap_hash(const struct strmap *m, const char *key)
+{
+	uint32_t hash = 2166136261u;
+
+	while (*key) {
+		unsigned char c = (unsigned char) *key++;
+
+		if (m->fold_case) c = toupper(c);
+		hash = (hash ^ c) * 16777619;
+	}
+	return hash;
+}
+
+static bool strmap_same(const struct strmap *m, const char *a, const char *b)
+{
+	return m->fold_case ? !my_stricmp(a, b) : streq(a, b);
+}
+
+/**
+ * Find the slot that holds `key`, or the empty one it would go in.
+ */
+static struct strmap_slot *strmap_find(const struct strmap *m, const char *key,
+		uint32_t hash)
+{
+	size_t i = hash & (m->size - 1);
+
+	while (m->slots[i].key) {
+		if (m->slots[i].hash == hash && strmap_same(m, m->slots[i].key, key))
+			break;
+		i = (i + 1) & (m->size - 1);
+	}
+	return &m->slots[i];
+}
+
+struct strmap *strmap_new(bool fold_case)
+{
+	struct strmap *m = mem_zalloc(sizeof(*m));
+
+	m->size = STRMAP_INIT;
+	m->slots = mem_zalloc(m->size * sizeof(*m->slots));
+	m->fold_case = fold_case;
+	return m;
+}
+
+void strmap_free(struct strmap *m)
+{
+	size_t i;
+
+	if (!m) return;
+	for (i = 0; i < m->size; i++) {
+		string_free(m->slots[i].key);
+	}
+	mem_free(m->slots);
+	mem_free(m);
+}
+
+bool strmap_add(struct strmap *m, const char *key, int value)
+{
+	uint32_t hash = strmap_hash(m, key);
+	struct strmap_slot *slot = strmap_find(m, key, hash);
+
+	if (slot->key) return false;
+
+	/* Make room first if need be */
+	if ((m->count + 1) * 4 > m->size * 3) {
+		struct strmap_slot *old = m->slots;
+		size_t i, old_size = m->size;
+
+		m->size *= 2;
+		m->slots = mem_zalloc(m->size * sizeof(*m->slots));
+		for (i = 0; i < old_size; i++) {
+			if (old[i].key)
+				*strmap_find(m, old[i].key, old[i].hash) = old[i];
+		}
+		mem_free(old);
+		slot = strmap_find(m, key, hash);
+	}
+
+	slot->key = string_make(key);
+	slot->hash = hash;
+	slot->value = value;
+	m->count++;
+	return true;
+}
+
+int strmap_get(const struct strmap *m, const char *key)
+{
+	const struct strmap_slot *slot;
+
+	if (!m) return -1;
+	slot = strmap_find(m, key, strmap_hash(m, key));
+	return slot->key ? slot->value : -1;
+}
+
+size_t strmap_count(const struct strmap *m)
+{
+	return m ? m->count : 0;
+}
@@ -0,0 +1,54 @@
+/**
+ * \file z-strmap.h
+ * \brief Hash table from strings to integers
+ *
+ * This work is free software; you can redistribute it and/or modify it
+ * under the terms of either:
+ *
+ * a) the GNU General Public License as published by the Free Software
+ *    Foundation, version 2, or
+ *
+ * b) the "Angband licence":
+ *    This software may be copied and distributed for educational, research,
+ *    and not for profit purposes provided that this copyright and statement
+ *    are included in all such copies.  Other copyrights may also apply.
+ */
+
+#ifndef INCLUDED_Z_STRMAP_H
+#define INCLUDED_Z_STRMAP_H
+
+#include "h-basic.h"
+
+/**
+ * A map from strings, which it keeps its own copies of, to integers.
+ */
+struct strmap;
+
+/**
+ * Make an empty map; if `fold_case` is set, keys that only differ in case,
+ * as my_stricmp() sees it, are the same key.
+ */
+struct strmap *strmap_new(bool fold_case);
+
+/**
+ * Free a map and its keys.
+ */
+void strmap_free(struct strmap *m);
+
+/**
+ * Map `key` to `value`, unless `key` is already in the map, in which case
+ * what it was first given is kept.  Returns whether the key was added.
+ */
+bool strmap_add(struct strmap *m, const char *key, int value);
+
+/**
+ * Return the value for `key`, or -1 if it is not in the map.
+ */
+int strmap_get(const struct strmap *m, const char *key);
+
+/**
+ * Return the number of keys in the map.
+ */
+size_t strmap_count(const struct strmap *m);
+
+#endif /* !INCLUDED_Z_STRMAP_H */
@@ -877,6 +877,33 @@ void sort(void *base, size_t nmemb, size_t smemb,
 	qsort(base, nmemb, smemb, comp);
 }
 
+/**
+ * Sort as sort() does, but keep elements that compare equal in the order
+ * they were in, so that the result is the same whatever the C library.
+ * This is an insertion sort, meant for the short arrays made at start up.
+ */
+void sort_stable(void *base, size_t nmemb, size_t smemb,
+	  int (*comp)(const void *, const void *))
+{
+	unsigned char *elem = base;
+	size_t i, j, k;
+
+	for (i = 1; i < nmemb; i++) {
+		for (j = i; j > 0 &&
+				comp(elem + (j - 1) * smemb, elem + j * smemb) > 0; j--) {
+			unsigned char *a = elem + (j - 1) * smemb;
+			unsigned char *b = elem + j * smemb;
+
+			for (k = 0; k < smemb; k++) {
+				unsigned char t = a[k];
+
+				a[k] = b[k];
+				b[k] = t;
+			}
+		}
+	}
+}
+
 uint32_t djb2_hash(const char *str)
 {
 	uint32_t hash = 5381;
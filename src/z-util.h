@@ -213,6 +213,8 @@ extern void quit(const char *str);
  */
 extern void sort(void *array, size_t nmemb, size_t smemb,
 		 int (*comp)(const void *a, const void *b));
+extern void sort_stable(void *array, size_t nmemb, size_t smemb,
+		 int (*comp)(const void *a, const void *b));
 
 /**
  * Create a hash for a string
@@ -19,9 +19,20 @@
 #include "z-util.h"
 
 unsigned int mem_flags = 0;
+int64_t mem_in_use = 0;
+int64_t mem_peak = 0;
 
 #define SZ(uptr)	*((size_t *)((char *)(uptr) - sizeof(size_t)))
 
+/**
+ * Keep track of the bytes in use, if asked to
+ */
+static void mem_count(int64_t change)
+{
+	mem_in_use += change;
+	if (mem_in_use > mem_peak) mem_peak = mem_in_use;
+}
+
 /**
  * Allocate `len` bytes of memory.
  *
@@ -45,6 +56,8 @@ void *mem_alloc(size_t len)
 	if (mem_flags & MEM_POISON_ALLOC)
 		memset(mem, 0xCC, len);
 	SZ(mem) = len;
+	if (mem_flags & MEM_COUNT_USE)
+		mem_count(len);
 
 	return mem;
 }
@@ -63,6 +76,8 @@ void *mem_zalloc(size_t len)
 	if (mem_flags & MEM_POISON_ALLOC)
 		memset(mem, 0xCC, len);
 	SZ(mem) = len;
+	if (mem_flags & MEM_COUNT_USE)
+		mem_count(len);
 
 	return mem;
 }
@@ -73,6 +88,8 @@ void mem_free(void *p)
 
 	if (mem_flags & MEM_POISON_FREE)
 		memset(p, 0xCD, SZ(p));
+	if (mem_flags & MEM_COUNT_USE)
+		mem_count(-(int64_t)SZ(p));
 	free((char *)p - sizeof(size_t));
 }
 
@@ -83,12 +100,16 @@ void *mem_realloc(void *p, size_t len)
 	/* Fail gracefully */
 	if (len == 0) return (NULL);
 
+	if ((mem_flags & MEM_COUNT_USE) && m)
+		mem_count(-(int64_t)SZ(m));
 	m = realloc(m ? m - sizeof(size_t) : NULL, len + sizeof(size_t));
 	m += sizeof(size_t);
 
 	/* Handle OOM */
 	if (!m) quit("Out of Memory!");
 	SZ(m) = len;
+	if (mem_flags & MEM_COUNT_USE)
+		mem_count(len);
 
 	return m;
 }
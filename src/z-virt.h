@@ -48,9 +48,18 @@ char *string_append(char *s1, const char *s2);
 
 enum {
 	MEM_POISON_ALLOC = 0x00000001,
-	MEM_POISON_FREE  = 0x00000002
+	MEM_POISON_FREE  = 0x00000002,
+	MEM_COUNT_USE    = 0x00000004
 };
 
 extern unsigned int mem_flags;
 
+/**
+ * With MEM_COUNT_USE set, the bytes allocated less the bytes freed, and the
+ * most that has been since mem_peak was last reset.  Blocks allocated before
+ * counting started can take mem_in_use below zero when they are freed.
+ */
+extern int64_t mem_in_use;
+extern int64_t mem_peak;
+
 #endif /* INCLUDED_Z_VIRT_H */